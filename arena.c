@@ -0,0 +1,213 @@
+/**********************************************************************
+
+  arena.c - Region allocator for the element tree of a conversion.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License or the MIT
+  license.  See LICENSE for details.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+ ***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "arena.h"
+
+#define ARENA_BLOCK_SIZE 65536
+
+/* Allocations are rounded up to a multiple of the strictest alignment
+ * needed by the element tree. */
+union arena_align {
+    void   *p;
+    long    l;
+    double  d;
+};
+
+#define ARENA_ALIGN(n) (((n) + sizeof(union arena_align) - 1) & ~(sizeof(union arena_align) - 1))
+
+struct arena_block {
+    struct arena_block *next;
+    size_t              size;   /* Bytes available after the header. */
+    size_t              used;
+    union arena_align   align;  /* Data starts here. */
+};
+
+struct markdown_arena {
+    struct arena_block *blocks; /* Blocks in use; the first is being filled. */
+    struct arena_block *spare;  /* Blocks released by arena_reset. */
+    markdown_arena    **workers;  /* Arenas of the threads of a parallel conversion. */
+    int                 nworkers;
+    parser_context     *context;  /* Kept for the next conversion. */
+    jmp_buf            *out_of_memory;  /* Set by arena_catch. */
+    size_t              memo_limit; /* Bytes its parser may memoize; 0 for the default. */
+    struct arena_stats  stats;
+};
+
+#define BLOCK_DATA(b) ((char *) &(b)->align)
+
+/* markdown_arena_new - create an empty arena, or return NULL if out of
+ * memory */
+markdown_arena * markdown_arena_new(void) {
+    return calloc(1, sizeof(markdown_arena));
+}
+
+/* markdown_arena_set_memo_limit - set the memory that the parser of
+ * each thread of a conversion may use for memoized results */
+void markdown_arena_set_memo_limit(markdown_arena *arena, size_t bytes) {
+    arena->memo_limit = bytes;
+}
+
+static void free_blocks(struct arena_block *b) {
+    struct arena_block *next;
+    while (b != NULL) {
+        next = b->next;
+        free(b);
+        b = next;
+    }
+}
+
+/* markdown_arena_free - free an arena and everything allocated from it */
+void markdown_arena_free(markdown_arena *arena) {
+    int i;
+    for (i = 0; i < arena->nworkers; i++)
+        markdown_arena_free(arena->workers[i]);
+    free(arena->workers);
+    if (arena->context != NULL)
+        free_parser_context(arena->context);
+    free_blocks(arena->blocks);
+    free_blocks(arena->spare);
+    free(arena);
+}
+
+/* new_block - take a spare block with room for size bytes, or allocate one */
+static struct arena_block * new_block(markdown_arena *arena, size_t size) {
+    struct arena_block **prev = &arena->spare;
+    struct arena_block *b;
+    while ((b = *prev) != NULL) {
+        if (b->size >= size) {
+            *prev = b->next;
+            b->used = 0;
+            return b;
+        }
+        prev = &b->next;
+    }
+    if (size < ARENA_BLOCK_SIZE)
+        size = ARENA_BLOCK_SIZE;
+    b = malloc(offsetof(struct arena_block, align) + size);
+    if (b == NULL) {
+        arena_fail(arena);
+        return NULL;
+    }
+    arena->stats.blocks++;
+    b->size = size;
+    b->used = 0;
+    return b;
+}
+
+void * arena_alloc(markdown_arena *arena, size_t size) {
+    struct arena_block *b = arena->blocks;
+    void *result;
+    size = ARENA_ALIGN(size);
+    arena->stats.allocs++;
+    arena->stats.bytes += size;
+    if (b == NULL || b->size - b->used < size) {
+        b = new_block(arena, size);
+        if (b == NULL)
+            return NULL;
+        if (arena->blocks != NULL && size > ARENA_BLOCK_SIZE / 4) {
+            /* Keep filling the current block after a large allocation. */
+            b->next = arena->blocks->next;
+            arena->blocks->next = b;
+        } else {
+            b->next = arena->blocks;
+            arena->blocks = b;
+        }
+    }
+    result = BLOCK_DATA(b) + b->used;
+    b->used += size;
+    return result;
+}
+
+char * arena_strndup(markdown_arena *arena, const char *s, size_t n) {
+    char *result = arena_alloc(arena, n + 1);
+    if (result == NULL)
+        return NULL;
+    memcpy(result, s, n);
+    result[n] = '\0';
+    return result;
+}
+
+char * arena_strdup(markdown_arena *arena, const char *s) {
+    return arena_strndup(arena, s, strlen(s));
+}
+
+void * arena_buffer(markdown_arena *arena, void *ptr, size_t size) {
+    arena->stats.buffers++;
+    return realloc(ptr, size);
+}
+
+parser_context * arena_context(markdown_arena *arena) {
+    if (arena->context == NULL)
+        arena->context = new_parser_context();
+    return arena->context;
+}
+
+size_t arena_memo_limit(markdown_arena *arena) {
+    return arena->memo_limit;
+}
+
+void arena_reset(markdown_arena *arena) {
+    struct arena_block *b;
+    int i;
+    for (i = 0; i < arena->nworkers; i++)
+        arena_reset(arena->workers[i]);
+    while ((b = arena->blocks) != NULL) {
+        arena->blocks = b->next;
+        b->next = arena->spare;
+        arena->spare = b;
+    }
+}
+
+markdown_arena * arena_worker(markdown_arena *arena, int n) {
+    markdown_arena **workers;
+    if (n >= arena->nworkers) {
+        workers = realloc(arena->workers, (n + 1) * sizeof(markdown_arena *));
+        if (workers == NULL)
+            return NULL;
+        arena->workers = workers;
+        while (arena->nworkers <= n) {
+            workers[arena->nworkers] = markdown_arena_new();
+            if (workers[arena->nworkers] == NULL)
+                return NULL;
+            arena->nworkers++;
+        }
+    }
+    return arena->workers[n];
+}
+
+jmp_buf * arena_catch(markdown_arena *arena, jmp_buf *env) {
+    jmp_buf *old = arena->out_of_memory;
+    arena->out_of_memory = env;
+    return old;
+}
+
+void arena_fail(markdown_arena *arena) {
+    if (arena->out_of_memory != NULL)
+        longjmp(*arena->out_of_memory, 1);
+}
+
+void arena_get_stats(markdown_arena *arena, struct arena_stats *stats) {
+    int i;
+    *stats = arena->stats;
+    for (i = 0; i < arena->nworkers; i++) {
+        stats->allocs += arena->workers[i]->stats.allocs;
+        stats->bytes += arena->workers[i]->stats.bytes;
+        stats->blocks += arena->workers[i]->stats.blocks;
+        stats->buffers += arena->workers[i]->stats.buffers;
+    }
+}
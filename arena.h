@@ -0,0 +1,66 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+#include <setjmp.h>
+#include "markdown_peg.h"
+
+/* arena.h - Region allocator for the element tree of a conversion.
+ * Everything allocated from an arena is released at once by
+ * arena_reset, which keeps the arena's blocks for the next conversion.
+ * An allocation that runs out of memory calls arena_fail, and returns
+ * NULL if that returns. */
+
+/* Running totals kept by an arena since it was created. */
+struct arena_stats {
+    unsigned long allocs;   /* Calls to arena_alloc. */
+    unsigned long bytes;    /* Bytes handed out, after alignment. */
+    unsigned long blocks;   /* Blocks obtained from malloc. */
+    unsigned long buffers;  /* Parser buffers obtained or grown. */
+};
+
+/* arena_alloc - allocate size bytes, aligned for any element type */
+void * arena_alloc(markdown_arena *arena, size_t size);
+
+/* arena_strdup - copy a null-terminated string into the arena */
+char * arena_strdup(markdown_arena *arena, const char *s);
+
+/* arena_strndup - copy n bytes of s into the arena, adding a null */
+char * arena_strndup(markdown_arena *arena, const char *s, size_t n);
+
+/* arena_buffer - allocate (ptr NULL) or resize a buffer of the parser.
+ * Unlike the arena's blocks, it lives until it is passed to free.
+ * Returns NULL when out of memory. */
+void * arena_buffer(markdown_arena *arena, void *ptr, size_t size);
+
+/* arena_context - the parser context kept by the arena, created on
+ * first use, or NULL if it cannot be.  It and its buffers are reused by
+ * every conversion made with the arena, and freed with it. */
+parser_context * arena_context(markdown_arena *arena);
+
+/* arena_memo_limit - the limit set by markdown_arena_set_memo_limit,
+ * or 0 if none was set */
+size_t arena_memo_limit(markdown_arena *arena);
+
+/* arena_reset - release everything allocated from the arena and its
+ * worker arenas */
+void arena_reset(markdown_arena *arena);
+
+/* arena_worker - the arena used by worker thread n of a parallel
+ * conversion, or NULL if out of memory.  It belongs to 'arena', and is
+ * reset and freed with it. */
+markdown_arena * arena_worker(markdown_arena *arena, int n);
+
+/* arena_catch - have arena_fail longjmp to env, which the caller has set
+ * with setjmp, or return if env is NULL.  Only the thread that is
+ * allocating from the arena may call it.  Returns the env set before. */
+jmp_buf * arena_catch(markdown_arena *arena, jmp_buf *env);
+
+/* arena_fail - give up the work being done with the arena, which has run
+ * out of memory, by jumping to the env set by arena_catch, if any */
+void arena_fail(markdown_arena *arena);
+
+/* arena_get_stats - the totals of an arena and its worker arenas */
+void arena_get_stats(markdown_arena *arena, struct arena_stats *stats);
+
+#endif
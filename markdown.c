@@ -53,7 +53,8 @@ int main(int argc, char * argv[]) {
     int i;
 
     GString *inputbuf;
-    char *out;              /* string containing processed output */
+    GString *out;           /* processed output */
+    markdown_arena *arena;
 
     FILE *input;
     FILE *output;
@@ -73,6 +74,9 @@ int main(int argc, char * argv[]) {
     static gboolean opt_filter_styles = FALSE;
     static gboolean opt_strike = FALSE;
     static gboolean opt_allext = FALSE;
+    static gboolean opt_defer = FALSE;
+    static gint opt_threads = 1;
+    static gint opt_memo_limit = 0;
 
     static GOptionEntry entries[] =
     {
@@ -82,6 +86,9 @@ int main(int argc, char * argv[]) {
       { "extensions", 'x', 0, G_OPTION_ARG_NONE, &opt_allext, "use all syntax extensions", NULL },
       { "filter-html", 0, 0, G_OPTION_ARG_NONE, &opt_filter_html, "filter out raw HTML (except styles)", NULL },
       { "filter-styles", 0, 0, G_OPTION_ARG_NONE, &opt_filter_styles, "filter out HTML styles", NULL },
+      { "threads", 'j', 0, G_OPTION_ARG_INT, &opt_threads, "parse nested blocks, and parts of 64 KB or more of the document, with N threads (default is 1)", "N" },
+      { "memo-limit", 0, 0, G_OPTION_ARG_INT, &opt_memo_limit, "let the parser of each thread memoize up to MB megabytes, N times that with -j N (default is 256)", "MB" },
+      { "defer-references", 0, 0, G_OPTION_ARG_NONE, &opt_defer, "resolve reference links after parsing (may change output)", NULL },
       { NULL }
     };
 
@@ -131,6 +138,8 @@ int main(int argc, char * argv[]) {
         extensions = extensions | EXT_FILTER_STYLES;
     if (opt_strike)
         extensions = extensions | EXT_STRIKE;
+    if (opt_defer)
+        extensions = extensions | EXT_DEFER_REFERENCES;
 
     if (opt_to == NULL)
         output_format = HTML_FORMAT;
@@ -177,9 +186,17 @@ int main(int argc, char * argv[]) {
        }
     }
 
-    out = markdown_to_string(inputbuf->str, extensions, output_format);
-    fprintf(output, "%s\n", out);
-    free(out);
+    arena = markdown_arena_new();
+    if (arena != NULL && opt_memo_limit > 0)
+        markdown_arena_set_memo_limit(arena, (size_t) opt_memo_limit << 20);
+    out = arena == NULL ? NULL : markdown_to_g_string_parallel(arena, inputbuf->str, extensions, output_format, opt_threads);
+    if (out == NULL) {
+        fprintf(stderr, "%s: out of memory\n", progname);
+        exit(EXIT_FAILURE);
+    }
+    fprintf(output, "%s\n", out->str);
+    g_string_free(out, true);
+    markdown_arena_free(arena);
 
     g_string_free(inputbuf, true);
 
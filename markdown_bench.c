@@ -0,0 +1,393 @@
+/**********************************************************************
+
+  markdown_bench.c - throughput benchmark for peg-markdown.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License or the MIT
+  license.  See LICENSE for details.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+ ***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <glib.h>
+#include "markdown_peg.h"
+#include "arena.h"
+
+/**********************************************************************
+
+  The benchmark generates synthetic documents of a given size, each
+  stressing one part of the grammar, and converts each of them to every
+  output format several times.  For every document and format it
+  reports the throughput of the fastest run, the time spent in each
+  phase of that run, and the arena allocations made by a conversion.
+  The documents are generated from a fixed seed, so runs of different
+  versions of the program can be compared.
+
+ ***********************************************************************/
+
+static unsigned long seed;
+
+/* rnd - a pseudo-random number in [0, n) */
+static int rnd(int n) {
+    seed = seed * 1103515245UL + 12345UL;
+    return (int) ((seed >> 16) % (unsigned long) n);
+}
+
+static const char *words[] = {
+    "the", "parser", "reads", "markdown", "text", "and", "builds", "a", "tree",
+    "of", "elements", "which", "is", "then", "printed", "as", "HTML", "or",
+    "LaTeX", "each", "block", "may", "contain", "inline", "spans", "with",
+    "links", "emphasis", "code", "quotes", "--", "it's", "\"smart\"", "5*3",
+    "snake_case", "<tag>", "AT&T", "x^2", "[note]", "done."
+};
+
+#define NWORDS (sizeof(words) / sizeof(words[0]))
+
+/* add_words - append n random words, with some inline markup */
+static void add_words(GString *doc, int n) {
+    int i;
+    for (i = 0; i < n; i++) {
+        if (i > 0)
+            g_string_append_c(doc, rnd(12) == 0 ? '\n' : ' ');
+        switch (rnd(16)) {
+        case 0:
+            g_string_append_printf(doc, "*%s %s*", words[rnd(NWORDS)], words[rnd(NWORDS)]);
+            break;
+        case 1:
+            g_string_append_printf(doc, "**%s**", words[rnd(NWORDS)]);
+            break;
+        case 2:
+            g_string_append_printf(doc, "`%s()`", words[rnd(NWORDS)]);
+            break;
+        case 3:
+            g_string_append_printf(doc, "[%s](http://example.com/%d \"%s\")", words[rnd(NWORDS)], rnd(1000), words[rnd(NWORDS)]);
+            break;
+        default:
+            g_string_append(doc, words[rnd(NWORDS)]);
+        }
+    }
+}
+
+static void gen_prose(GString *doc, size_t size) {
+    while (doc->len < size) {
+        if (rnd(8) == 0) {
+            g_string_append(doc, rnd(2) ? "## " : "# ");
+            add_words(doc, 3 + rnd(5));
+            g_string_append(doc, "\n\n");
+        }
+        add_words(doc, 40 + rnd(120));
+        g_string_append(doc, "\n\n");
+    }
+}
+
+static void add_list(GString *doc, int depth, int max_depth) {
+    int items = 2 + rnd(4);
+    int ordered = rnd(2);
+    int loose = rnd(3) == 0;
+    int i, j;
+    for (i = 0; i < items; i++) {
+        for (j = 0; j < depth; j++)
+            g_string_append(doc, "    ");
+        if (ordered)
+            g_string_append_printf(doc, "%d.  ", i + 1);
+        else
+            g_string_append(doc, "*   ");
+        add_words(doc, 4 + rnd(12));
+        g_string_append(doc, loose ? "\n\n" : "\n");
+        if (depth + 1 < max_depth && rnd(2))
+            add_list(doc, depth + 1, max_depth);
+    }
+}
+
+static void gen_lists(GString *doc, size_t size) {
+    while (doc->len < size) {
+        add_list(doc, 0, 6);
+        g_string_append(doc, "\n");
+        add_words(doc, 20);
+        g_string_append(doc, "\n\n");
+    }
+}
+
+static void gen_references(GString *doc, size_t size) {
+    int refs = 0;
+    int i;
+    while (doc->len < size / 2) {
+        for (i = 0; i < 10; i++) {
+            add_words(doc, 5 + rnd(10));
+            g_string_append_printf(doc, " [%s %d][ref%d] ", words[rnd(NWORDS)], refs, refs);
+            if (rnd(3) == 0)
+                g_string_append_printf(doc, "[Ref%d] ", rnd(refs + 1));
+            refs++;
+        }
+        g_string_append(doc, "\n\n");
+    }
+    for (i = 0; i < refs && doc->len < size; i++)
+        g_string_append_printf(doc, "[ref%d]: http://example.com/page/%d  \"Title %d\"\n", i, i, i);
+    g_string_append(doc, "\n");
+}
+
+static void gen_code(GString *doc, size_t size) {
+    int lines;
+    int i;
+    while (doc->len < size) {
+        add_words(doc, 20 + rnd(30));
+        g_string_append(doc, "\n\n");
+        lines = 10 + rnd(60);
+        for (i = 0; i < lines; i++)
+            g_string_append_printf(doc, "    for (i = 0; i < %d; i++) { a[i] = b[i] * %d; } /* <%s> & */\n", rnd(100), rnd(10), words[rnd(NWORDS)]);
+        g_string_append(doc, "\n");
+    }
+}
+
+static void gen_html(GString *doc, size_t size) {
+    int rows;
+    int i;
+    while (doc->len < size) {
+        switch (rnd(3)) {
+        case 0:
+            g_string_append(doc, "<div class=\"note\">\n<div>\n<p>");
+            add_words(doc, 20);
+            g_string_append(doc, "</p>\n</div>\n</div>\n\n");
+            break;
+        case 1:
+            rows = 3 + rnd(20);
+            g_string_append(doc, "<table>\n");
+            for (i = 0; i < rows; i++)
+                g_string_append_printf(doc, "<tr><td>%s</td><td align=\"right\">%d</td></tr>\n", words[rnd(NWORDS)], rnd(1000));
+            g_string_append(doc, "</table>\n\n");
+            break;
+        default:
+            g_string_append(doc, "<!-- ");
+            add_words(doc, 10);
+            g_string_append(doc, " -->\n\n");
+            add_words(doc, 20);
+            g_string_append(doc, " <span class=\"x\">");
+            add_words(doc, 5);
+            g_string_append(doc, "</span> <br/>\n\n");
+        }
+    }
+}
+
+static void gen_notes(GString *doc, size_t size) {
+    int notes = 0;
+    int i;
+    while (doc->len < size / 2) {
+        for (i = 0; i < 5; i++) {
+            add_words(doc, 10 + rnd(20));
+            g_string_append_printf(doc, "[^n%d] ", notes++);
+            if (rnd(4) == 0) {
+                g_string_append(doc, "^[");
+                add_words(doc, 6);
+                g_string_append(doc, "] ");
+            }
+        }
+        g_string_append(doc, "\n\n");
+    }
+    for (i = 0; i < notes && doc->len < size; i++) {
+        g_string_append_printf(doc, "[^n%d]: ", i);
+        add_words(doc, 10 + rnd(20));
+        g_string_append(doc, "\n\n");
+        if (rnd(3) == 0) {
+            g_string_append(doc, "    ");
+            add_words(doc, 15);
+            g_string_append(doc, "\n\n");
+        }
+    }
+}
+
+/* gen_emphasis - one paragraph of emphasis that opens and never closes,
+ * so each opener is tried against every delimiter that follows it */
+static void gen_emphasis(GString *doc, size_t size) {
+    static const char *openers[] = { "*", "_", "**", "__" };
+    while (doc->len < size) {
+        g_string_append_printf(doc, "%s%s ", openers[rnd(4)], words[rnd(NWORDS)]);
+        if (rnd(8) == 0)
+            g_string_append(doc, "\n");
+    }
+    g_string_append(doc, "\n\n");
+}
+
+/* gen_ticks - paragraphs with long runs of backticks that no run of
+ * the same length closes, so each backtick of them is tried as an
+ * opener in turn */
+static void gen_ticks(GString *doc, size_t size) {
+    int run = 0;
+    int i;
+    while (doc->len < size) {
+        add_words(doc, 10 + rnd(20));
+        g_string_append_c(doc, ' ');
+        run += 1 + rnd(4096);
+        for (i = 0; i < run % 8192 + 1; i++)
+            g_string_append_c(doc, '`');
+        g_string_append_c(doc, ' ');
+        add_words(doc, 10 + rnd(20));
+        g_string_append(doc, "\n\n");
+    }
+}
+
+static struct {
+    const char *name;
+    void (*generate)(GString *doc, size_t size);
+} corpora[] = {
+    { "prose",      gen_prose },
+    { "lists",      gen_lists },
+    { "references", gen_references },
+    { "code",       gen_code },
+    { "html",       gen_html },
+    { "notes",      gen_notes },
+    { "emphasis",   gen_emphasis },
+    { "ticks",      gen_ticks }
+};
+
+#define NCORPORA (sizeof(corpora) / sizeof(corpora[0]))
+
+static struct {
+    const char *name;
+    int format;
+} formats[] = {
+    { "html",     HTML_FORMAT },
+    { "latex",    LATEX_FORMAT },
+    { "groff-mm", GROFF_MM_FORMAT },
+    { "odf",      ODF_FORMAT }
+};
+
+#define NFORMATS (sizeof(formats) / sizeof(formats[0]))
+
+static double now(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+int main(int argc, char * argv[]) {
+    static gint opt_size = 1024;
+    static gint opt_runs = 5;
+    static gint opt_threads = 1;
+    static gchar *opt_corpus = 0;
+    static gchar *opt_write = 0;
+    static gboolean opt_json = FALSE;
+
+    static GOptionEntry entries[] =
+    {
+      { "size", 's', 0, G_OPTION_ARG_INT, &opt_size, "size of each document in KB (default is 1024)", "KB" },
+      { "runs", 'r', 0, G_OPTION_ARG_INT, &opt_runs, "conversions of each document per format (default is 5)", "N" },
+      { "threads", 'j', 0, G_OPTION_ARG_INT, &opt_threads, "parse with N threads (default is 1)", "N" },
+      { "corpus", 'c', 0, G_OPTION_ARG_STRING, &opt_corpus, "only run the document NAME", "NAME" },
+      { "write", 'w', 0, G_OPTION_ARG_STRING, &opt_write, "write the documents to DIR and exit", "DIR" },
+      { "json", 0, 0, G_OPTION_ARG_NONE, &opt_json, "print results as JSON, one object per line", NULL },
+      { NULL }
+    };
+
+    GError *error = NULL;
+    GOptionContext *context;
+    int extensions = EXT_SMART | EXT_NOTES | EXT_STRIKE;
+    unsigned int c, f;
+    int run;
+
+    context = g_option_context_new ("");
+    g_option_context_add_main_entries (context, entries, NULL);
+    g_option_context_set_description (context, "Documents: prose, lists, references, code, html, notes, emphasis, ticks");
+    if (!g_option_context_parse (context, &argc, &argv, &error)) {
+        g_print ("option parsing failed: %s\n", error->message);
+        exit (1);
+    }
+    g_option_context_free(context);
+    if (opt_runs < 1)
+        opt_runs = 1;
+
+    if (!opt_json && opt_write == NULL)
+        printf("%-10s %-8s %9s %8s %8s %8s %8s %8s %8s %9s %7s\n",
+               "document", "format", "MB/s", "total", "preform", "defs",
+               "blocks", "nested", "print", "allocs", "mallocs");
+
+    for (c = 0; c < NCORPORA; c++) {
+        GString *doc;
+        if (opt_corpus != NULL && strcmp(opt_corpus, corpora[c].name) != 0)
+            continue;
+        seed = 42;
+        doc = g_string_new("");
+        corpora[c].generate(doc, (size_t) opt_size * 1024);
+
+        if (opt_write != NULL) {
+            GString *path = g_string_new("");
+            FILE *out;
+            g_string_append_printf(path, "%s/%s.text", opt_write, corpora[c].name);
+            if ((out = fopen(path->str, "w")) == NULL) {
+                perror(path->str);
+                exit(EXIT_FAILURE);
+            }
+            fwrite(doc->str, 1, doc->len, out);
+            fclose(out);
+            g_string_free(path, TRUE);
+            g_string_free(doc, TRUE);
+            continue;
+        }
+
+        for (f = 0; f < NFORMATS; f++) {
+            markdown_arena *arena = markdown_arena_new();
+            conversion_profile profile, best_profile;
+            struct arena_stats before, after;
+            double start, seconds, best = 0;
+            GString *out;
+
+            if (arena == NULL) {
+                fprintf(stderr, "markdown_bench: out of memory\n");
+                exit(EXIT_FAILURE);
+            }
+            memset(&best_profile, 0, sizeof(best_profile));
+            for (run = 0; run < opt_runs; run++) {
+                arena_get_stats(arena, &before);
+                start = now();
+                out = markdown_convert(arena, doc->str, extensions, formats[f].format, opt_threads, &profile);
+                seconds = now() - start;
+                arena_get_stats(arena, &after);
+                if (out == NULL) {
+                    fprintf(stderr, "markdown_bench: out of memory\n");
+                    exit(EXIT_FAILURE);
+                }
+                g_string_free(out, TRUE);
+                if (run == 0 || seconds < best) {
+                    best = seconds;
+                    best_profile = profile;
+                }
+            }
+            /* after - before is the last conversion.  The arena keeps its
+             * blocks and the parser's context and buffers, so after the
+             * first run a conversion with one thread makes no mallocs.
+             * With more, a context may be handed a segment larger than
+             * any it has parsed, and grow its buffers to fit. */
+
+            if (opt_json)
+                printf("{\"document\": \"%s\", \"format\": \"%s\", \"bytes\": %lu, \"runs\": %d, "
+                       "\"threads\": %d, \"seconds\": %.6f, \"mb_per_s\": %.3f, "
+                       "\"phases\": {\"preformat\": %.6f, \"definitions\": %.6f, "
+                       "\"blocks\": %.6f, \"raw_blocks\": %.6f, \"print\": %.6f}, "
+                       "\"arena_allocs\": %lu, \"arena_bytes\": %lu, \"arena_mallocs\": %lu}\n",
+                       corpora[c].name, formats[f].name, (unsigned long) doc->len, opt_runs,
+                       opt_threads, best, doc->len / best / 1e6,
+                       best_profile.preformat, best_profile.definitions,
+                       best_profile.blocks, best_profile.raw_blocks, best_profile.print,
+                       after.allocs - before.allocs, after.bytes - before.bytes,
+                       (after.blocks + after.buffers) - (before.blocks + before.buffers));
+            else
+                printf("%-10s %-8s %9.2f %8.4f %8.4f %8.4f %8.4f %8.4f %8.4f %9lu %7lu\n",
+                       corpora[c].name, formats[f].name, doc->len / best / 1e6, best,
+                       best_profile.preformat, best_profile.definitions,
+                       best_profile.blocks, best_profile.raw_blocks, best_profile.print,
+                       after.allocs - before.allocs, (after.blocks + after.buffers) - (before.blocks + before.buffers));
+            fflush(stdout);
+            markdown_arena_free(arena);
+        }
+        g_string_free(doc, TRUE);
+    }
+
+    return(EXIT_SUCCESS);
+}
@@ -17,7 +17,10 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include "markdown_peg.h"
+#include "arena.h"
+#include "task_pool.h"
 
 #define TABSTOP 4
 
@@ -97,7 +100,7 @@ static void print_tree(element * elt, int indent) {
             default:                 key = "?";
         }
         if ( elt->key == STR ) {
-            fprintf(stderr, "0x%p: %s   '%s'\n", (void *)elt, key, elt->contents.str);
+            fprintf(stderr, "0x%p: %s   '%.*s'\n", (void *)elt, key, (int) elt->len, elt->contents.str);
         } else {
             fprintf(stderr, "0x%p: %s\n", (void *)elt, key);
         }
@@ -107,72 +110,459 @@ static void print_tree(element * elt, int indent) {
     }
 }
 
+/* parse_raw_block - replace a RAW element with a LIST of the result
+ * of parsing its contents as markdown text. */
+static void parse_raw_block(parser_context *ctx, element *raw, element *references, element *notes) {
+    element **tail;
+    char *contents;
+    char *end;
+    char *chunk_end;
+
+    /* \001 is used to indicate boundaries between nested lists when there
+     * is no blank line.  We split the string by \001 and parse
+     * each nonempty chunk separately. */
+    contents = raw->contents.str;
+    end = contents + raw->len;
+    raw->key = LIST;
+    raw->children = NULL;
+    tail = &raw->children;
+    while (contents < end) {
+        chunk_end = memchr(contents, '\001', end - contents);
+        if (chunk_end == NULL)
+            chunk_end = end;
+        if (chunk_end > contents) {
+            *tail = parse_markdown(ctx, contents, chunk_end - contents, references, notes);
+            while (*tail != NULL)
+                tail = &(*tail)->next;
+        }
+        contents = chunk_end + 1;
+    }
+    raw->contents.str = NULL;
+    raw->len = 0;
+}
+
+/* holds_blocks - true if elt is a list, list item, block quote or note
+ * definition, the elements whose children may be RAW.  The inlines of a
+ * paragraph or heading hold none, however deeply they nest, so the
+ * walks below do not enter them.  Note references and inline notes
+ * hold none either: a reference shares the children of its note, which
+ * are processed from the notes list. */
+static int holds_blocks(element *elt) {
+    switch (elt->key) {
+    case LIST:
+    case BULLETLIST:
+    case ORDEREDLIST:
+    case LISTITEM:
+    case BLOCKQUOTE:
+        return 1;
+    case NOTE:
+        return elt->contents.str != NULL;
+    default:
+        return 0;
+    }
+}
+
 /* process_raw_blocks - traverses an element list, replacing any RAW elements with
  * the result of parsing them as markdown text, and recursing into the children
- * of parent elements.  The result should be a tree of elements without any RAWs. */
-static element * process_raw_blocks(element *input, int extensions, element *references, element *notes) {
+ * of the elements that hold blocks.  The result should be a tree of elements
+ * without any RAWs. */
+static element * process_raw_blocks(parser_context *ctx, element *input, element *references, element *notes) {
     element *current = NULL;
-    element *last_child = NULL;
-    char *contents;
     current = input;
 
     while (current != NULL) {
-        if (current->key == RAW) {
-            /* \001 is used to indicate boundaries between nested lists when there
-             * is no blank line.  We split the string by \001 and parse
-             * each chunk separately. */
-            contents = strtok(current->contents.str, "\001");
-            current->key = LIST;
-            current->children = parse_markdown(contents, extensions, references, notes);
-            last_child = current->children;
-            while ((contents = strtok(NULL, "\001"))) {
-                while (last_child->next != NULL)
-                    last_child = last_child->next;
-                last_child->next = parse_markdown(contents, extensions, references, notes);
-            }
-            free(current->contents.str);
-            current->contents.str = NULL;
-        }
-        if (current->children != NULL)
-            current->children = process_raw_blocks(current->children, extensions, references, notes);
+        if (current->key == RAW)
+            parse_raw_block(ctx, current, references, notes);
+        if (current->children != NULL && holds_blocks(current))
+            current->children = process_raw_blocks(ctx, current->children, references, notes);
         current = current->next;
     }
     return input;
 }
 
-/* markdown_to_gstring - convert markdown text to the output format specified.
- * Returns a GString, which must be freed after use using g_string_free(). */
-GString * markdown_to_g_string(char *text, int extensions, int output_format) {
+/* The contexts of the workers of a parallel conversion, and the arenas
+ * their elements are built in.  A task that runs out of memory gives up,
+ * setting the failed flag of its worker. */
+struct workers {
+    parser_context **contexts;
+    markdown_arena **arenas;
+    int             *failed;
+    int              count;
+};
+
+/* workers_failed - true if a task of the workers ran out of memory */
+static int workers_failed(struct workers *w) {
+    int i;
+    for (i = 0; i < w->count; i++)
+        if (w->failed[i])
+            return 1;
+    return 0;
+}
+
+/* State shared by the workers of a parallel process_raw_blocks. */
+struct raw_job {
+    struct workers  *workers;
+    element         *references;
+    element         *notes;
+};
+
+/* push_raw_blocks - add a task for each RAW element in an element list
+ * and the children of its elements that hold blocks.  The notes list is
+ * processed before the document, and a note reference is not entered,
+ * so every RAW is reached exactly once. */
+static void push_raw_blocks(task_pool *pool, int worker, element *elt) {
+    while (elt != NULL) {
+        if (elt->key == RAW)
+            task_pool_push(pool, worker, elt);
+        else if (elt->children != NULL && holds_blocks(elt))
+            push_raw_blocks(pool, worker, elt->children);
+        elt = elt->next;
+    }
+}
+
+/* run_raw_block - parse one RAW element; the RAWs nested in the result
+ * become tasks of their own. */
+static void run_raw_block(task_pool *pool, int worker, void *task, void *data) {
+    struct raw_job *job = data;
+    element *raw = task;
+    markdown_arena *arena = job->workers->arenas[worker];
+    jmp_buf out_of_memory;
+    jmp_buf *outer;
+
+    outer = arena_catch(arena, &out_of_memory);
+    if (setjmp(out_of_memory) == 0) {
+        parse_raw_block(job->workers->contexts[worker], raw, job->references, job->notes);
+        push_raw_blocks(pool, worker, raw->children);
+    } else {
+        job->workers->failed[worker] = 1;
+    }
+    arena_catch(arena, outer);
+}
+
+/* process_raw_blocks_parallel - as process_raw_blocks, parsing the RAW
+ * elements of the notes list and then of the document with one thread
+ * for each of the workers.  If the pool cannot be made, the first
+ * worker's context parses them all, as with one thread. */
+static element * process_raw_blocks_parallel(struct workers *workers, element *input,
+                                             element *references, element *notes) {
+    struct raw_job job;
+    task_pool *pool;
+
+    job.workers = workers;
+    job.references = references;
+    job.notes = notes;
+
+    pool = task_pool_new(workers->count, run_raw_block, &job);
+    if (pool == NULL) {
+        process_raw_blocks(workers->contexts[0], notes, references, notes);
+        return process_raw_blocks(workers->contexts[0], input, references, notes);
+    }
+    push_raw_blocks(pool, 0, notes);
+    task_pool_run(pool);
+    push_raw_blocks(pool, 0, input);
+    task_pool_run(pool);
+    task_pool_free(pool);
+    if (workers_failed(workers))
+        arena_fail(workers->arenas[0]);
+    return input;
+}
+
+/* Documents are split into segments of at least this many bytes. */
+#define SEGMENT_MIN 65536
+
+/* A stretch of the document whose blocks are parsed by one task. */
+struct doc_segment {
+    size_t   start;
+    size_t   limit;
+    size_t   end;       /* Where the block after the segment's blocks begins. */
+    element *blocks;
+};
+
+/* State shared by the workers of parse_segments. */
+struct segment_job {
+    struct workers  *workers;
+    char            *text;
+    size_t           len;
+    element         *references;
+    element         *notes;
+};
+
+static void run_segment(task_pool *pool, int worker, void *task, void *data) {
+    struct segment_job *job = data;
+    struct doc_segment *seg = task;
+    markdown_arena *arena = job->workers->arenas[worker];
+    jmp_buf out_of_memory;
+    jmp_buf *outer;
+
+    outer = arena_catch(arena, &out_of_memory);
+    if (setjmp(out_of_memory) == 0)
+        seg->blocks = parse_segment(job->workers->contexts[worker], job->text, seg->start, seg->limit, job->len,
+                                    &seg->end, job->references, job->notes);
+    else
+        job->workers->failed[worker] = 1;
+    arena_catch(arena, outer);
+}
+
+/* parse_segments - parse the document as parse_markdown would, splitting
+ * it into segments that are parsed concurrently.  Segments begin at the
+ * block boundaries found by parse_definitions.  A segment's parse is
+ * used only if the previous segment's blocks end exactly where it
+ * begins; otherwise the blocks from there on are parsed again.  If the
+ * segments cannot be listed or the pool cannot be made, the document is
+ * parsed in one piece. */
+static element * parse_segments(struct workers *workers, char *text, size_t len,
+                                element *references, element *notes) {
+    parser_context **contexts = workers->contexts;
+    struct segment_job job;
+    struct doc_segment *segs;
+    struct doc_segment *grown;
+    task_pool *pool;
+    size_t target;
+    size_t pos;
+    size_t limit;
+    size_t end;
+    element *result;
+    element **tail;
+    int *boundaries;
+    int nboundaries;
+    int nsegs;
+    int maxsegs;
+    int b;
+    int i;
+
+    target = len / (4 * workers->count);
+    if (target < SEGMENT_MIN)
+        target = SEGMENT_MIN;
+    boundaries = block_boundaries(contexts[0], &nboundaries);
+    segs = NULL;
+    nsegs = 0;
+    maxsegs = 0;
+    pos = 0;
+    b = 0;
+    while (pos < len) {
+        if (nsegs == maxsegs) {
+            maxsegs = maxsegs ? 2 * maxsegs : 16;
+            grown = realloc(segs, maxsegs * sizeof(struct doc_segment));
+            if (grown == NULL) {
+                nsegs = 0;
+                break;
+            }
+            segs = grown;
+        }
+        segs[nsegs].start = pos;
+        while (b < nboundaries && (size_t) boundaries[b] <= pos + target)
+            b++;
+        pos = b < nboundaries ? (size_t) boundaries[b] : len;
+        segs[nsegs].limit = pos;
+        nsegs++;
+    }
+    if (nsegs < 2) {
+        free(segs);
+        return parse_markdown(contexts[0], text, len, references, notes);
+    }
+
+    job.workers = workers;
+    job.text = text;
+    job.len = len;
+    job.references = references;
+    job.notes = notes;
+    pool = task_pool_new(workers->count, run_segment, &job);
+    if (pool == NULL) {
+        free(segs);
+        return parse_markdown(contexts[0], text, len, references, notes);
+    }
+    for (i = nsegs - 1; i >= 0; i--)
+        task_pool_push(pool, 0, &segs[i]);
+    task_pool_run(pool);
+    task_pool_free(pool);
+    if (workers_failed(workers)) {
+        free(segs);
+        arena_fail(workers->arenas[0]);
+    }
+
+    result = NULL;
+    tail = &result;
+    pos = 0;
+    i = 0;
+    for (;;) {
+        while (i < nsegs && segs[i].start < pos)
+            i++;
+        if (i < nsegs && segs[i].start == pos) {
+            *tail = segs[i].blocks;
+            limit = segs[i].limit;
+            end = segs[i].end;
+            i++;
+        } else {
+            limit = i < nsegs ? segs[i].start : len;
+            *tail = parse_segment(contexts[0], text, pos, limit, len, &end, references, notes);
+        }
+        while (*tail != NULL)
+            tail = &(*tail)->next;
+        if (end < limit || end >= len)
+            break;
+        pos = end;
+    }
+    free(segs);
+    return result;
+}
+
+/* lap - seconds since *t, which is set to now */
+static double lap(struct timespec *t) {
+    struct timespec now;
+    double seconds;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    seconds = (now.tv_sec - t->tv_sec) + (now.tv_nsec - t->tv_nsec) / 1e9;
+    *t = now;
+    return seconds;
+}
+
+/* markdown_convert - convert markdown text as markdown_to_g_string_parallel,
+ * recording the time taken by each phase in 'profile' unless it is NULL. */
+GString * markdown_convert(markdown_arena *arena, char *text, int extensions, int output_format, int threads,
+                           conversion_profile *profile) {
     element *result;
     element *references;
     element *notes;
+    parser_context *ctx;
+    struct workers workers;
     GString *formatted_text;
     GString *out;
+    jmp_buf out_of_memory;
+    jmp_buf *outer;
+    struct timespec t;
+    int i;
+
+    if (profile != NULL)
+        clock_gettime(CLOCK_MONOTONIC, &t);
     out = g_string_new("");
 
     formatted_text = preformat_text(text);
+    if (profile != NULL)
+        profile->preformat = lap(&t);
 
-    references = parse_references(formatted_text->str, extensions);
-    notes = parse_notes(formatted_text->str, extensions, references);
-    result = parse_markdown(formatted_text->str, extensions, references, notes);
+    /* Whatever runs out of memory from here on gives up the conversion. */
+    outer = arena_catch(arena, &out_of_memory);
+    if (setjmp(out_of_memory) != 0) {
+        arena_catch(arena, outer);
+        g_string_free(formatted_text, TRUE);
+        g_string_free(out, TRUE);
+        arena_reset(arena);
+        return NULL;
+    }
 
-    result = process_raw_blocks(result, extensions, references, notes);
+    ctx = use_parser_context(arena, extensions);
+    if (ctx == NULL)
+        arena_fail(arena);
+    index_document(ctx, formatted_text->str, formatted_text->len);
+    references = NULL;
+    notes = NULL;
+    /* Deferred references are resolved from the blocks, but notes must
+     * be known before the parse, and the pass that collects them also
+     * finds where parse_segments may split the document. */
+    if (!(extensions & EXT_DEFER_REFERENCES) || (extensions & EXT_NOTES) || threads > 1) {
+        parse_definitions(ctx, formatted_text->str, &references, &notes);
+        if (extensions & EXT_DEFER_REFERENCES)
+            references = NULL;
+    }
+    if (profile != NULL)
+        profile->definitions = lap(&t);
 
-    g_string_free(formatted_text, TRUE);
+    if (threads > 1) {
+        /* Each thread parses with the context of its own arena.  If the
+         * arenas or contexts of some threads cannot be made, fewer
+         * threads are used. */
+        workers.contexts = arena_alloc(arena, threads * sizeof(parser_context *));
+        workers.arenas = arena_alloc(arena, threads * sizeof(markdown_arena *));
+        workers.failed = arena_alloc(arena, threads * sizeof(int));
+        workers.contexts[0] = ctx;
+        workers.arenas[0] = arena;
+        workers.failed[0] = 0;
+        for (i = 1; i < threads; i++) {
+            workers.arenas[i] = arena_worker(arena, i);
+            if (workers.arenas[i] == NULL)
+                break;
+            workers.contexts[i] = copy_parser_context(ctx, workers.arenas[i]);
+            if (workers.contexts[i] == NULL)
+                break;
+            workers.failed[i] = 0;
+        }
+        threads = workers.count = i;
+    }
+    if (threads > 1) {
+        result = parse_segments(&workers, formatted_text->str, formatted_text->len, references, notes);
+        if (profile != NULL)
+            profile->blocks = lap(&t);
+        result = process_raw_blocks_parallel(&workers, result, references, notes);
+    } else {
+        result = parse_markdown(ctx, formatted_text->str, formatted_text->len, references, notes);
+        if (profile != NULL)
+            profile->blocks = lap(&t);
+        /* A note reference may lie where process_raw_blocks does not
+         * look, such as the label of a link, so notes are processed from
+         * the notes list, as in process_raw_blocks_parallel. */
+        process_raw_blocks(ctx, notes, references, notes);
+        result = process_raw_blocks(ctx, result, references, notes);
+    }
+
+    if (extensions & EXT_DEFER_REFERENCES)
+        resolve_references(ctx, result, notes);
+    if (profile != NULL)
+        profile->raw_blocks = lap(&t);
 
+    /* Strings in the element tree point into formatted_text. */
     print_element_list(out, result, output_format, extensions);
+    if (profile != NULL)
+        profile->print = lap(&t);
 
-    free_element_list(result);
-    free_element_list(references);
+    arena_catch(arena, outer);
+    g_string_free(formatted_text, TRUE);
+    arena_reset(arena);
+    return out;
+}
+
+/* markdown_to_g_string_parallel - convert markdown text to the output format
+ * specified, building the element tree in 'arena'.  Large documents are split
+ * into runs of top-level blocks, and these and the block quotes, list items
+ * and notes within them are parsed by 'threads' threads; with one thread,
+ * everything is parsed by the calling thread.  The arena is reset before
+ * returning, so its memory can be reused by the next conversion.
+ * Returns a GString, which must be freed after use using g_string_free(),
+ * or NULL if out of memory. */
+GString * markdown_to_g_string_parallel(markdown_arena *arena, char *text, int extensions, int output_format, int threads) {
+    return markdown_convert(arena, text, extensions, output_format, threads, NULL);
+}
+
+/* markdown_to_g_string_with_arena - convert markdown text to the output format
+ * specified, building the element tree in 'arena', which is reset before
+ * returning.  Returns a GString, which must be freed after use using
+ * g_string_free(), or NULL if out of memory. */
+GString * markdown_to_g_string_with_arena(markdown_arena *arena, char *text, int extensions, int output_format) {
+    return markdown_to_g_string_parallel(arena, text, extensions, output_format, 1);
+}
+
+/* markdown_to_gstring - convert markdown text to the output format specified.
+ * Returns a GString, which must be freed after use using g_string_free(),
+ * or NULL if out of memory. */
+GString * markdown_to_g_string(char *text, int extensions, int output_format) {
+    markdown_arena *arena;
+    GString *out;
+    arena = markdown_arena_new();
+    if (arena == NULL)
+        return NULL;
+    out = markdown_to_g_string_with_arena(arena, text, extensions, output_format);
+    markdown_arena_free(arena);
     return out;
 }
 
 /* markdown_to_string - convert markdown text to the output format specified.
- * Returns a null-terminated string, which must be freed after use. */
+ * Returns a null-terminated string, which must be freed after use, or NULL
+ * if out of memory. */
 char * markdown_to_string(char *text, int extensions, int output_format) {
     GString *out;
     char *char_out;
     out = markdown_to_g_string(text, extensions, output_format);
+    if (out == NULL)
+        return NULL;
     char_out = out->str;
     g_string_free(out, FALSE);
     return char_out;
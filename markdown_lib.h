@@ -14,7 +14,9 @@ enum markdown_extensions {
     EXT_NOTES            = 0x02,
     EXT_FILTER_HTML      = 0x04,
     EXT_FILTER_STYLES    = 0x08,
-    EXT_STRIKE           = 0x10
+    EXT_STRIKE           = 0x10,
+    /* Not a syntax extension, so not among the bits of 0xFFFFFF. */
+    EXT_DEFER_REFERENCES = 0x1000000
 };
 
 enum markdown_formats {
@@ -24,7 +26,18 @@ enum markdown_formats {
     ODF_FORMAT
 };
 
+/* An arena owns the element tree built during a conversion.  A caller
+ * that converts many documents can pass the same arena to each
+ * conversion, so that its memory is reused instead of reallocated. */
+typedef struct markdown_arena markdown_arena;
+
+markdown_arena * markdown_arena_new(void);
+void markdown_arena_free(markdown_arena *arena);
+void markdown_arena_set_memo_limit(markdown_arena *arena, size_t bytes);
+
 GString * markdown_to_g_string(char *text, int extensions, int output_format);
+GString * markdown_to_g_string_with_arena(markdown_arena *arena, char *text, int extensions, int output_format);
+GString * markdown_to_g_string_parallel(markdown_arena *arena, char *text, int extensions, int output_format, int threads);
 char * markdown_to_string(char *text, int extensions, int output_format);
 
 #ifdef __cplusplus
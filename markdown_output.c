@@ -24,22 +24,33 @@
 #include "markdown_peg.h"
 #include "odf.h"
 
-static int extensions;
-static int odf_type = 0;
+/* printer_context - the state of one call of print_element_list, passed
+ * down to the functions that print its elements */
+typedef struct {
+    int extensions;
+    int odf_type;
+    int padded;             /* Number of newlines after last output.
+                               Starts at 2 so no newlines are needed at start.
+                               */
+    GSList *endnotes;       /* List of endnotes to print after main content. */
+    GSList *open_notes;     /* Contents of the notes being printed inline. */
+    int notenumber;         /* Number of footnote. */
+    bool in_list_item;      /* True if we're parsing contents of a list item. */
+} printer_context;
 
-static void print_html_string(GString *out, char *str, bool obfuscate);
-static void print_html_element_list(GString *out, element *list, bool obfuscate);
-static void print_html_element(GString *out, element *elt, bool obfuscate);
-static void print_latex_string(GString *out, char *str);
-static void print_latex_element_list(GString *out, element *list);
-static void print_latex_element(GString *out, element *elt);
-static void print_groff_string(GString *out, char *str);
-static void print_groff_mm_element_list(GString *out, element *list);
-static void print_groff_mm_element(GString *out, element *elt, int count);
-static void print_odf_code_string(GString *out, char *str);
-static void print_odf_string(GString *out, char *str);
-static void print_odf_element_list(GString *out, element *list);
-static void print_odf_element(GString *out, element *elt);
+static void print_html_string(GString *out, char *str, size_t len, bool obfuscate);
+static void print_html_element_list(printer_context *ctx, GString *out, element *list, bool obfuscate);
+static void print_html_element(printer_context *ctx, GString *out, element *elt, bool obfuscate);
+static void print_latex_string(GString *out, char *str, size_t len);
+static void print_latex_element_list(printer_context *ctx, GString *out, element *list);
+static void print_latex_element(printer_context *ctx, GString *out, element *elt);
+static void print_groff_string(GString *out, char *str, size_t len);
+static void print_groff_mm_element_list(printer_context *ctx, GString *out, element *list);
+static void print_groff_mm_element(printer_context *ctx, GString *out, element *elt, int count);
+static void print_odf_code_string(GString *out, char *str, size_t len);
+static void print_odf_string(GString *out, char *str, size_t len);
+static void print_odf_element_list(printer_context *ctx, GString *out, element *list);
+static void print_odf_element(printer_context *ctx, GString *out, element *elt);
 static bool list_contains_key(element *list, int key);
 
 /**********************************************************************
@@ -48,18 +59,28 @@ static bool list_contains_key(element *list, int key);
 
  ***********************************************************************/
 
-static int padded = 2;      /* Number of newlines after last output.
-                               Starts at 2 so no newlines are needed at start.
-                               */
-
-static GSList *endnotes = NULL; /* List of endnotes to print after main content. */
-static int notenumber = 0;  /* Number of footnote. */
-
 /* pad - add newlines if needed */
-static void pad(GString *out, int num) {
-    while (num-- > padded)
+static void pad(printer_context *ctx, GString *out, int num) {
+    while (num-- > ctx->padded)
         g_string_append_printf(out, "\n");;
-    padded = num;
+    ctx->padded = num;
+}
+
+/* open_note - start printing the note that a note reference elt refers
+ * to in place, as the LaTeX, groff and ODF printers do.  Returns false,
+ * and the reference should be left out, if that note is already being
+ * printed: a note that refers to itself, directly or through other notes,
+ * would be printed without end. */
+static bool open_note(printer_context *ctx, element *elt) {
+    if (g_slist_find(ctx->open_notes, elt->children) != NULL)
+        return false;
+    ctx->open_notes = g_slist_prepend(ctx->open_notes, elt->children);
+    return true;
+}
+
+/* close_note - end printing the note last opened with open_note */
+static void close_note(printer_context *ctx) {
+    ctx->open_notes = g_slist_delete_link(ctx->open_notes, ctx->open_notes);
 }
 
 /* determine whether a certain element is contained within a given list */
@@ -89,8 +110,9 @@ static bool list_contains_key(element *list, int key) {
 
 /* print_html_string - print string, escaping for HTML  
  * If obfuscate selected, convert characters to hex or decimal entities at random */
-static void print_html_string(GString *out, char *str, bool obfuscate) {
-    while (*str != '\0') {
+static void print_html_string(GString *out, char *str, size_t len, bool obfuscate) {
+    char *end = str + len;
+    while (str < end) {
         switch (*str) {
         case '&':
             g_string_append_printf(out, "&amp;");
@@ -119,30 +141,30 @@ static void print_html_string(GString *out, char *str, bool obfuscate) {
 }
 
 /* print_html_element_list - print a list of elements as HTML */
-static void print_html_element_list(GString *out, element *list, bool obfuscate) {
+static void print_html_element_list(printer_context *ctx, GString *out, element *list, bool obfuscate) {
     while (list != NULL) {
-        print_html_element(out, list, obfuscate);
+        print_html_element(ctx, out, list, obfuscate);
         list = list->next;
     }
 }
 
-/* add_endnote - add an endnote to global endnotes list. */
-static void add_endnote(element *elt) {
-    endnotes = g_slist_prepend(endnotes, elt);
+/* add_endnote - add an endnote to the endnotes list. */
+static void add_endnote(printer_context *ctx, element *elt) {
+    ctx->endnotes = g_slist_prepend(ctx->endnotes, elt);
 }
 
 /* print_html_element - print an element as HTML */
-static void print_html_element(GString *out, element *elt, bool obfuscate) {
+static void print_html_element(printer_context *ctx, GString *out, element *elt, bool obfuscate) {
     int lev;
     switch (elt->key) {
     case SPACE:
-        g_string_append_printf(out, "%s", elt->contents.str);
+        g_string_append_len(out, elt->contents.str, elt->len);
         break;
     case LINEBREAK:
         g_string_append_printf(out, "<br/>\n");
         break;
     case STR:
-        print_html_string(out, elt->contents.str, obfuscate);
+        print_html_string(out, elt->contents.str, elt->len, obfuscate);
         break;
     case ELLIPSIS:
         g_string_append_printf(out, "&hellip;");
@@ -158,67 +180,67 @@ static void print_html_element(GString *out, element *elt, bool obfuscate) {
         break;
     case SINGLEQUOTED:
         g_string_append_printf(out, "&lsquo;");
-        print_html_element_list(out, elt->children, obfuscate);
+        print_html_element_list(ctx, out, elt->children, obfuscate);
         g_string_append_printf(out, "&rsquo;");
         break;
     case DOUBLEQUOTED:
         g_string_append_printf(out, "&ldquo;");
-        print_html_element_list(out, elt->children, obfuscate);
+        print_html_element_list(ctx, out, elt->children, obfuscate);
         g_string_append_printf(out, "&rdquo;");
         break;
     case CODE:
         g_string_append_printf(out, "<code>");
-        print_html_string(out, elt->contents.str, obfuscate);
+        print_html_string(out, elt->contents.str, elt->len, obfuscate);
         g_string_append_printf(out, "</code>");
         break;
     case HTML:
-        g_string_append_printf(out, "%s", elt->contents.str);
+        g_string_append_len(out, elt->contents.str, elt->len);
         break;
     case LINK:
         if (strstr(elt->contents.link->url, "mailto:") == elt->contents.link->url)
             obfuscate = true;  /* obfuscate mailto: links */
         g_string_append_printf(out, "<a href=\"");
-        print_html_string(out, elt->contents.link->url, obfuscate);
+        print_html_string(out, elt->contents.link->url, strlen(elt->contents.link->url), obfuscate);
         g_string_append_printf(out, "\"");
         if (strlen(elt->contents.link->title) > 0) {
             g_string_append_printf(out, " title=\"");
-            print_html_string(out, elt->contents.link->title, obfuscate);
+            print_html_string(out, elt->contents.link->title, strlen(elt->contents.link->title), obfuscate);
             g_string_append_printf(out, "\"");
         }
         g_string_append_printf(out, ">");
-        print_html_element_list(out, elt->contents.link->label, obfuscate);
+        print_html_element_list(ctx, out, elt->contents.link->label, obfuscate);
         g_string_append_printf(out, "</a>");
         break;
     case IMAGE:
         g_string_append_printf(out, "<img src=\"");
-        print_html_string(out, elt->contents.link->url, obfuscate);
+        print_html_string(out, elt->contents.link->url, strlen(elt->contents.link->url), obfuscate);
         g_string_append_printf(out, "\" alt=\"");
-        print_html_element_list(out, elt->contents.link->label, obfuscate);
+        print_html_element_list(ctx, out, elt->contents.link->label, obfuscate);
         g_string_append_printf(out, "\"");
         if (strlen(elt->contents.link->title) > 0) {
             g_string_append_printf(out, " title=\"");
-            print_html_string(out, elt->contents.link->title, obfuscate);
+            print_html_string(out, elt->contents.link->title, strlen(elt->contents.link->title), obfuscate);
             g_string_append_printf(out, "\"");
         }
         g_string_append_printf(out, " />");
         break;
     case EMPH:
         g_string_append_printf(out, "<em>");
-        print_html_element_list(out, elt->children, obfuscate);
+        print_html_element_list(ctx, out, elt->children, obfuscate);
         g_string_append_printf(out, "</em>");
         break;
     case STRONG:
         g_string_append_printf(out, "<strong>");
-        print_html_element_list(out, elt->children, obfuscate);
+        print_html_element_list(ctx, out, elt->children, obfuscate);
         g_string_append_printf(out, "</strong>");
         break;
     case STRIKE:
         g_string_append_printf(out, "<del>");
-        print_html_element_list(out, elt->children, obfuscate);
+        print_html_element_list(ctx, out, elt->children, obfuscate);
         g_string_append_printf(out, "</del>");
         break;
     case LIST:
-        print_html_element_list(out, elt->children, obfuscate);
+        print_html_element_list(ctx, out, elt->children, obfuscate);
         break;
     case RAW:
         /* Shouldn't occur - these are handled by process_raw_blocks() */
@@ -226,75 +248,75 @@ static void print_html_element(GString *out, element *elt, bool obfuscate) {
         break;
     case H1: case H2: case H3: case H4: case H5: case H6:
         lev = elt->key - H1 + 1;  /* assumes H1 ... H6 are in order */
-        pad(out, 2);
+        pad(ctx, out, 2);
         g_string_append_printf(out, "<h%1d>", lev);
-        print_html_element_list(out, elt->children, obfuscate);
+        print_html_element_list(ctx, out, elt->children, obfuscate);
         g_string_append_printf(out, "</h%1d>", lev);
-        padded = 0;
+        ctx->padded = 0;
         break;
     case PLAIN:
-        pad(out, 1);
-        print_html_element_list(out, elt->children, obfuscate);
-        padded = 0;
+        pad(ctx, out, 1);
+        print_html_element_list(ctx, out, elt->children, obfuscate);
+        ctx->padded = 0;
         break;
     case PARA:
-        pad(out, 2);
+        pad(ctx, out, 2);
         g_string_append_printf(out, "<p>");
-        print_html_element_list(out, elt->children, obfuscate);
+        print_html_element_list(ctx, out, elt->children, obfuscate);
         g_string_append_printf(out, "</p>");
-        padded = 0;
+        ctx->padded = 0;
         break;
     case HRULE:
-        pad(out, 2);
+        pad(ctx, out, 2);
         g_string_append_printf(out, "<hr />");
-        padded = 0;
+        ctx->padded = 0;
         break;
     case HTMLBLOCK:
-        pad(out, 2);
-        g_string_append_printf(out, "%s", elt->contents.str);
-        padded = 0;
+        pad(ctx, out, 2);
+        g_string_append_len(out, elt->contents.str, elt->len);
+        ctx->padded = 0;
         break;
     case VERBATIM:
-        pad(out, 2);
+        pad(ctx, out, 2);
         g_string_append_printf(out, "%s", "<pre><code>");
-        print_html_string(out, elt->contents.str, obfuscate);
+        print_html_string(out, elt->contents.str, elt->len, obfuscate);
         g_string_append_printf(out, "%s", "</code></pre>");
-        padded = 0;
+        ctx->padded = 0;
         break;
     case BULLETLIST:
-        pad(out, 2);
+        pad(ctx, out, 2);
         g_string_append_printf(out, "%s", "<ul>");
-        padded = 0;
-        print_html_element_list(out, elt->children, obfuscate);
-        pad(out, 1);
+        ctx->padded = 0;
+        print_html_element_list(ctx, out, elt->children, obfuscate);
+        pad(ctx, out, 1);
         g_string_append_printf(out, "%s", "</ul>");
-        padded = 0;
+        ctx->padded = 0;
         break;
     case ORDEREDLIST:
-        pad(out, 2);
+        pad(ctx, out, 2);
         g_string_append_printf(out, "%s", "<ol>");
-        padded = 0;
-        print_html_element_list(out, elt->children, obfuscate);
-        pad(out, 1);
+        ctx->padded = 0;
+        print_html_element_list(ctx, out, elt->children, obfuscate);
+        pad(ctx, out, 1);
         g_string_append_printf(out, "</ol>");
-        padded = 0;
+        ctx->padded = 0;
         break;
     case LISTITEM:
-        pad(out, 1);
+        pad(ctx, out, 1);
         g_string_append_printf(out, "<li>");
-        padded = 2;
-        print_html_element_list(out, elt->children, obfuscate);
+        ctx->padded = 2;
+        print_html_element_list(ctx, out, elt->children, obfuscate);
         g_string_append_printf(out, "</li>");
-        padded = 0;
+        ctx->padded = 0;
         break;
     case BLOCKQUOTE:
-        pad(out, 2);
+        pad(ctx, out, 2);
         g_string_append_printf(out, "<blockquote>\n");
-        padded = 2;
-        print_html_element_list(out, elt->children, obfuscate);
-        pad(out, 1);
+        ctx->padded = 2;
+        print_html_element_list(ctx, out, elt->children, obfuscate);
+        pad(ctx, out, 1);
         g_string_append_printf(out, "</blockquote>");
-        padded = 0;
+        ctx->padded = 0;
         break;
     case REFERENCE:
         /* Nonprinting */
@@ -303,10 +325,10 @@ static void print_html_element(GString *out, element *elt, bool obfuscate) {
         /* if contents.str == 0, then print note; else ignore, since this
          * is a note block that has been incorporated into the notes list */
         if (elt->contents.str == 0) {
-            add_endnote(elt);
-            ++notenumber;
+            add_endnote(ctx, elt);
+            ++ctx->notenumber;
             g_string_append_printf(out, "<a class=\"noteref\" id=\"fnref%d\" href=\"#fn%d\" title=\"Jump to note %d\">[%d]</a>",
-                notenumber, notenumber, notenumber, notenumber);
+                ctx->notenumber, ctx->notenumber, ctx->notenumber, ctx->notenumber);
         }
         break;
     default: 
@@ -315,29 +337,29 @@ static void print_html_element(GString *out, element *elt, bool obfuscate) {
     }
 }
 
-static void print_html_endnotes(GString *out) {
+static void print_html_endnotes(printer_context *ctx, GString *out) {
     int counter = 0;
     GSList *note;
     element *note_elt;
-    if (endnotes == NULL) 
+    if (ctx->endnotes == NULL) 
         return;
-    note = g_slist_reverse(endnotes);
+    note = g_slist_reverse(ctx->endnotes);
     g_string_append_printf(out, "<hr/>\n<ol id=\"notes\">");
     while (note != NULL) {
         note_elt = note->data;
         counter++;
-        pad(out, 1);
+        pad(ctx, out, 1);
         g_string_append_printf(out, "<li id=\"fn%d\">\n", counter);
-        padded = 2;
-        print_html_element_list(out, note_elt->children, false);
+        ctx->padded = 2;
+        print_html_element_list(ctx, out, note_elt->children, false);
         g_string_append_printf(out, " <a href=\"#fnref%d\" title=\"Jump back to reference\">[back]</a>", counter);
-        pad(out, 1);
+        pad(ctx, out, 1);
         g_string_append_printf(out, "</li>");
         note = note->next;
     }
-    pad(out, 1);
+    pad(ctx, out, 1);
     g_string_append_printf(out, "</ol>");
-    g_slist_free(endnotes);
+    g_slist_free(ctx->endnotes);
 }
 
 /**********************************************************************
@@ -347,8 +369,9 @@ static void print_html_endnotes(GString *out) {
  ***********************************************************************/
 
 /* print_latex_string - print string, escaping for LaTeX */
-static void print_latex_string(GString *out, char *str) {
-    while (*str != '\0') {
+static void print_latex_string(GString *out, char *str, size_t len) {
+    char *end = str + len;
+    while (str < end) {
         switch (*str) {
           case '{': case '}': case '$': case '%':
           case '&': case '_': case '#':
@@ -380,26 +403,26 @@ static void print_latex_string(GString *out, char *str) {
 }
 
 /* print_latex_element_list - print a list of elements as LaTeX */
-static void print_latex_element_list(GString *out, element *list) {
+static void print_latex_element_list(printer_context *ctx, GString *out, element *list) {
     while (list != NULL) {
-        print_latex_element(out, list);
+        print_latex_element(ctx, out, list);
         list = list->next;
     }
 }
 
 /* print_latex_element - print an element as LaTeX */
-static void print_latex_element(GString *out, element *elt) {
+static void print_latex_element(printer_context *ctx, GString *out, element *elt) {
     int lev;
     int i;
     switch (elt->key) {
     case SPACE:
-        g_string_append_printf(out, "%s", elt->contents.str);
+        g_string_append_len(out, elt->contents.str, elt->len);
         break;
     case LINEBREAK:
         g_string_append_printf(out, "\\\\\n");
         break;
     case STR:
-        print_latex_string(out, elt->contents.str);
+        print_latex_string(out, elt->contents.str, elt->len);
         break;
     case ELLIPSIS:
         g_string_append_printf(out, "\\ldots{}");
@@ -415,17 +438,17 @@ static void print_latex_element(GString *out, element *elt) {
         break;
     case SINGLEQUOTED:
         g_string_append_printf(out, "`");
-        print_latex_element_list(out, elt->children);
+        print_latex_element_list(ctx, out, elt->children);
         g_string_append_printf(out, "'");
         break;
     case DOUBLEQUOTED:
         g_string_append_printf(out, "``");
-        print_latex_element_list(out, elt->children);
+        print_latex_element_list(ctx, out, elt->children);
         g_string_append_printf(out, "''");
         break;
     case CODE:
         g_string_append_printf(out, "\\texttt{");
-        print_latex_string(out, elt->contents.str);
+        print_latex_string(out, elt->contents.str, elt->len);
         g_string_append_printf(out, "}");
         break;
     case HTML:
@@ -433,7 +456,7 @@ static void print_latex_element(GString *out, element *elt) {
         break;
     case LINK:
         g_string_append_printf(out, "\\href{%s}{", elt->contents.link->url);
-        print_latex_element_list(out, elt->contents.link->label);
+        print_latex_element_list(ctx, out, elt->contents.link->label);
         g_string_append_printf(out, "}");
         break;
     case IMAGE:
@@ -441,112 +464,113 @@ static void print_latex_element(GString *out, element *elt) {
         break;
     case EMPH:
         g_string_append_printf(out, "\\emph{");
-        print_latex_element_list(out, elt->children);
+        print_latex_element_list(ctx, out, elt->children);
         g_string_append_printf(out, "}");
         break;
     case STRONG:
         g_string_append_printf(out, "\\textbf{");
-        print_latex_element_list(out, elt->children);
+        print_latex_element_list(ctx, out, elt->children);
         g_string_append_printf(out, "}");
         break;
     case STRIKE:
         g_string_append_printf(out, "\\sout{");
-        print_latex_element_list(out, elt->children);
+        print_latex_element_list(ctx, out, elt->children);
         g_string_append_printf(out, "}");
         break;
     case LIST:
-        print_latex_element_list(out, elt->children);
+        print_latex_element_list(ctx, out, elt->children);
         break;
     case RAW:
         /* Shouldn't occur - these are handled by process_raw_blocks() */
         assert(elt->key != RAW);
         break;
     case H1: case H2: case H3:
-        pad(out, 2);
+        pad(ctx, out, 2);
         lev = elt->key - H1 + 1;  /* assumes H1 ... H6 are in order */
         g_string_append_printf(out, "\\");
         for (i = elt->key; i > H1; i--)
             g_string_append_printf(out, "sub");
         g_string_append_printf(out, "section{");
-        print_latex_element_list(out, elt->children);
+        print_latex_element_list(ctx, out, elt->children);
         g_string_append_printf(out, "}");
-        padded = 0;
+        ctx->padded = 0;
         break;
     case H4: case H5: case H6:
-        pad(out, 2);
+        pad(ctx, out, 2);
         g_string_append_printf(out, "\\noindent\\textbf{");
-        print_latex_element_list(out, elt->children);
+        print_latex_element_list(ctx, out, elt->children);
         g_string_append_printf(out, "}");
-        padded = 0;
+        ctx->padded = 0;
         break;
     case PLAIN:
-        pad(out, 1);
-        print_latex_element_list(out, elt->children);
-        padded = 0;
+        pad(ctx, out, 1);
+        print_latex_element_list(ctx, out, elt->children);
+        ctx->padded = 0;
         break;
     case PARA:
-        pad(out, 2);
-        print_latex_element_list(out, elt->children);
-        padded = 0;
+        pad(ctx, out, 2);
+        print_latex_element_list(ctx, out, elt->children);
+        ctx->padded = 0;
         break;
     case HRULE:
-        pad(out, 2);
+        pad(ctx, out, 2);
         g_string_append_printf(out, "\\begin{center}\\rule{3in}{0.4pt}\\end{center}\n");
-        padded = 0;
+        ctx->padded = 0;
         break;
     case HTMLBLOCK:
         /* don't print HTML block */
         break;
     case VERBATIM:
-        pad(out, 1);
+        pad(ctx, out, 1);
         g_string_append_printf(out, "\\begin{verbatim}\n");
-        print_latex_string(out, elt->contents.str);
+        print_latex_string(out, elt->contents.str, elt->len);
         g_string_append_printf(out, "\n\\end{verbatim}");
-        padded = 0;
+        ctx->padded = 0;
         break;
     case BULLETLIST:
-        pad(out, 1);
+        pad(ctx, out, 1);
         g_string_append_printf(out, "\\begin{itemize}");
-        padded = 0;
-        print_latex_element_list(out, elt->children);
-        pad(out, 1);
+        ctx->padded = 0;
+        print_latex_element_list(ctx, out, elt->children);
+        pad(ctx, out, 1);
         g_string_append_printf(out, "\\end{itemize}");
-        padded = 0;
+        ctx->padded = 0;
         break;
     case ORDEREDLIST:
-        pad(out, 1);
+        pad(ctx, out, 1);
         g_string_append_printf(out, "\\begin{enumerate}");
-        padded = 0;
-        print_latex_element_list(out, elt->children);
-        pad(out, 1);
+        ctx->padded = 0;
+        print_latex_element_list(ctx, out, elt->children);
+        pad(ctx, out, 1);
         g_string_append_printf(out, "\\end{enumerate}");
-        padded = 0;
+        ctx->padded = 0;
         break;
     case LISTITEM:
-        pad(out, 1);
+        pad(ctx, out, 1);
         g_string_append_printf(out, "\\item ");
-        padded = 2;
-        print_latex_element_list(out, elt->children);
+        ctx->padded = 2;
+        print_latex_element_list(ctx, out, elt->children);
         g_string_append_printf(out, "\n");
         break;
     case BLOCKQUOTE:
-        pad(out, 1);
+        pad(ctx, out, 1);
         g_string_append_printf(out, "\\begin{quote}");
-        padded = 0;
-        print_latex_element_list(out, elt->children);
-        pad(out, 1);
+        ctx->padded = 0;
+        print_latex_element_list(ctx, out, elt->children);
+        pad(ctx, out, 1);
         g_string_append_printf(out, "\\end{quote}");
-        padded = 0;
+        ctx->padded = 0;
         break;
     case NOTE:
         /* if contents.str == 0, then print note; else ignore, since this
          * is a note block that has been incorporated into the notes list */
-        if (elt->contents.str == 0) {
+        if (elt->contents.str == 0 && open_note(ctx, elt)) {
             g_string_append_printf(out, "\\footnote{");
-            padded = 2;
-            print_latex_element_list(out, elt->children);
+            ctx->padded = 2;
+            print_latex_element_list(ctx, out, elt->children);
             g_string_append_printf(out, "}");
-            padded = 0; 
+            ctx->padded = 0; 
+            close_note(ctx);
         }
         break;
     case REFERENCE:
@@ -564,17 +588,16 @@ static void print_latex_element(GString *out, element *elt) {
 
  ***********************************************************************/
 
-static bool in_list_item = false; /* True if we're parsing contents of a list item. */
-
 /* print_groff_string - print string, escaping for groff */
-static void print_groff_string(GString *out, char *str) {
+static void print_groff_string(GString *out, char *str, size_t len) {
+    char *end = str + len;
     /* escape dots if it is the first character */
-    if (*str == '.') {
+    if (len > 0 && *str == '.') {
         g_string_append_printf(out, "\\[char46]");
         str++;
     }
 
-    while (*str != '\0') {
+    while (str < end) {
         switch (*str) {
         case '\\':
             g_string_append_printf(out, "\\e");
@@ -587,31 +610,31 @@ static void print_groff_string(GString *out, char *str) {
 }
 
 /* print_groff_mm_element_list - print a list of elements as groff ms */
-static void print_groff_mm_element_list(GString *out, element *list) {
+static void print_groff_mm_element_list(printer_context *ctx, GString *out, element *list) {
     int count = 1;
     while (list != NULL) {
-        print_groff_mm_element(out, list, count);
+        print_groff_mm_element(ctx, out, list, count);
         list = list->next;
         count++;
     }
 }
 
 /* print_groff_mm_element - print an element as groff ms */
-static void print_groff_mm_element(GString *out, element *elt, int count) {
+static void print_groff_mm_element(printer_context *ctx, GString *out, element *elt, int count) {
     int lev;
     switch (elt->key) {
     case SPACE:
-        g_string_append_printf(out, "%s", elt->contents.str);
-        padded = 0;
+        g_string_append_len(out, elt->contents.str, elt->len);
+        ctx->padded = 0;
         break;
     case LINEBREAK:
-        pad(out, 1);
+        pad(ctx, out, 1);
         g_string_append_printf(out, ".br\n");
-        padded = 0;
+        ctx->padded = 0;
         break;
     case STR:
-        print_groff_string(out, elt->contents.str);
-        padded = 0;
+        print_groff_string(out, elt->contents.str, elt->len);
+        ctx->padded = 0;
         break;
     case ELLIPSIS:
         g_string_append_printf(out, "...");
@@ -627,56 +650,56 @@ static void print_groff_mm_element(GString *out, element *elt, int count) {
         break;
     case SINGLEQUOTED:
         g_string_append_printf(out, "`");
-        print_groff_mm_element_list(out, elt->children);
+        print_groff_mm_element_list(ctx, out, elt->children);
         g_string_append_printf(out, "'");
         break;
     case DOUBLEQUOTED:
         g_string_append_printf(out, "\\[lq]");
-        print_groff_mm_element_list(out, elt->children);
+        print_groff_mm_element_list(ctx, out, elt->children);
         g_string_append_printf(out, "\\[rq]");
         break;
     case CODE:
         g_string_append_printf(out, "\\fC");
-        print_groff_string(out, elt->contents.str);
+        print_groff_string(out, elt->contents.str, elt->len);
         g_string_append_printf(out, "\\fR");
-        padded = 0;
+        ctx->padded = 0;
         break;
     case HTML:
         /* don't print HTML */
         break;
     case LINK:
-        print_groff_mm_element_list(out, elt->contents.link->label);
+        print_groff_mm_element_list(ctx, out, elt->contents.link->label);
         g_string_append_printf(out, " (%s)", elt->contents.link->url);
-        padded = 0;
+        ctx->padded = 0;
         break;
     case IMAGE:
         g_string_append_printf(out, "[IMAGE: ");
-        print_groff_mm_element_list(out, elt->contents.link->label);
+        print_groff_mm_element_list(ctx, out, elt->contents.link->label);
         g_string_append_printf(out, "]");
-        padded = 0;
+        ctx->padded = 0;
         /* not supported */
         break;
     case EMPH:
         g_string_append_printf(out, "\\fI");
-        print_groff_mm_element_list(out, elt->children);
+        print_groff_mm_element_list(ctx, out, elt->children);
         g_string_append_printf(out, "\\fR");
-        padded = 0;
+        ctx->padded = 0;
         break;
     case STRONG:
         g_string_append_printf(out, "\\fB");
-        print_groff_mm_element_list(out, elt->children);
+        print_groff_mm_element_list(ctx, out, elt->children);
         g_string_append_printf(out, "\\fR");
-        padded = 0;
+        ctx->padded = 0;
         break;
     case STRIKE:
         g_string_append_printf(out, "\\c\n.ST \"");
-        print_groff_mm_element_list(out, elt->children);
+        print_groff_mm_element_list(ctx, out, elt->children);
         g_string_append_printf(out, "\"");
-        pad(out, 1);
+        pad(ctx, out, 1);
         break;
     case LIST:
-        print_groff_mm_element_list(out, elt->children);
-        padded = 0;
+        print_groff_mm_element_list(ctx, out, elt->children);
+        ctx->padded = 0;
         break;
     case RAW:
         /* Shouldn't occur - these are handled by process_raw_blocks() */
@@ -684,85 +707,86 @@ static void print_groff_mm_element(GString *out, element *elt, int count) {
         break;
     case H1: case H2: case H3: case H4: case H5: case H6:
         lev = elt->key - H1 + 1;
-        pad(out, 1);
+        pad(ctx, out, 1);
         g_string_append_printf(out, ".H %d \"", lev);
-        print_groff_mm_element_list(out, elt->children);
+        print_groff_mm_element_list(ctx, out, elt->children);
         g_string_append_printf(out, "\"");
-        padded = 0;
+        ctx->padded = 0;
         break;
     case PLAIN:
-        pad(out, 1);
-        print_groff_mm_element_list(out, elt->children);
-        padded = 0;
+        pad(ctx, out, 1);
+        print_groff_mm_element_list(ctx, out, elt->children);
+        ctx->padded = 0;
         break;
     case PARA:
-        pad(out, 1);
-        if (!in_list_item || count != 1)
+        pad(ctx, out, 1);
+        if (!ctx->in_list_item || count != 1)
             g_string_append_printf(out, ".P\n");
-        print_groff_mm_element_list(out, elt->children);
-        padded = 0;
+        print_groff_mm_element_list(ctx, out, elt->children);
+        ctx->padded = 0;
         break;
     case HRULE:
-        pad(out, 1);
+        pad(ctx, out, 1);
         g_string_append_printf(out, "\\l'\\n(.lu*8u/10u'");
-        padded = 0;
+        ctx->padded = 0;
         break;
     case HTMLBLOCK:
         /* don't print HTML block */
         break;
     case VERBATIM:
-        pad(out, 1);
+        pad(ctx, out, 1);
         g_string_append_printf(out, ".VERBON 2\n");
-        print_groff_string(out, elt->contents.str);
+        print_groff_string(out, elt->contents.str, elt->len);
         g_string_append_printf(out, ".VERBOFF");
-        padded = 0;
+        ctx->padded = 0;
         break;
     case BULLETLIST:
-        pad(out, 1);
+        pad(ctx, out, 1);
         g_string_append_printf(out, ".BL");
-        padded = 0;
-        print_groff_mm_element_list(out, elt->children);
-        pad(out, 1);
+        ctx->padded = 0;
+        print_groff_mm_element_list(ctx, out, elt->children);
+        pad(ctx, out, 1);
         g_string_append_printf(out, ".LE 1");
-        padded = 0;
+        ctx->padded = 0;
         break;
     case ORDEREDLIST:
-        pad(out, 1);
+        pad(ctx, out, 1);
         g_string_append_printf(out, ".AL");
-        padded = 0;
-        print_groff_mm_element_list(out, elt->children);
-        pad(out, 1);
+        ctx->padded = 0;
+        print_groff_mm_element_list(ctx, out, elt->children);
+        pad(ctx, out, 1);
         g_string_append_printf(out, ".LE 1");
-        padded = 0;
+        ctx->padded = 0;
         break;
     case LISTITEM:
-        pad(out, 1);
+        pad(ctx, out, 1);
         g_string_append_printf(out, ".LI\n");
-        in_list_item = true;
-        padded = 2;
-        print_groff_mm_element_list(out, elt->children);
-        in_list_item = false;
+        ctx->in_list_item = true;
+        ctx->padded = 2;
+        print_groff_mm_element_list(ctx, out, elt->children);
+        ctx->in_list_item = false;
         break;
     case BLOCKQUOTE:
-        pad(out, 1);
+        pad(ctx, out, 1);
         g_string_append_printf(out, ".DS I\n");
-        padded = 2;
-        print_groff_mm_element_list(out, elt->children);
-        pad(out, 1);
+        ctx->padded = 2;
+        print_groff_mm_element_list(ctx, out, elt->children);
+        pad(ctx, out, 1);
         g_string_append_printf(out, ".DE");
-        padded = 0;
+        ctx->padded = 0;
         break;
     case NOTE:
         /* if contents.str == 0, then print note; else ignore, since this
          * is a note block that has been incorporated into the notes list */
-        if (elt->contents.str == 0) {
+        if (elt->contents.str == 0 && open_note(ctx, elt)) {
             g_string_append_printf(out, "\\*F\n");
             g_string_append_printf(out, ".FS\n");
-            padded = 2;
-            print_groff_mm_element_list(out, elt->children);
-            pad(out, 1);
+            ctx->padded = 2;
+            print_groff_mm_element_list(ctx, out, elt->children);
+            pad(ctx, out, 1);
             g_string_append_printf(out, ".FE\n");
-            padded = 1; 
+            ctx->padded = 1; 
+            close_note(ctx);
         }
         break;
     case REFERENCE:
@@ -782,9 +806,10 @@ static void print_groff_mm_element(GString *out, element *elt, int count) {
 
 /* print_odf_code_string - print string, escaping for HTML and saving newlines 
 */
-static void print_odf_code_string(GString *out, char *str) {
+static void print_odf_code_string(GString *out, char *str, size_t len) {
+    char *end = str + len;
     char *tmp;
-    while (*str != '\0') {
+    while (str < end) {
         switch (*str) {
         case '&':
             g_string_append_printf(out, "&amp;");
@@ -804,11 +829,11 @@ static void print_odf_code_string(GString *out, char *str) {
         case ' ':
             tmp = str;
             tmp++;
-            if (*tmp == ' ') {
+            if (tmp < end && *tmp == ' ') {
                 tmp++;
-                if (*tmp == ' ') {
+                if (tmp < end && *tmp == ' ') {
                     tmp++;
-                    if (*tmp == ' ') {
+                    if (tmp < end && *tmp == ' ') {
                         g_string_append_printf(out, "<text:tab/>");
                         str = tmp;
                     } else {
@@ -829,9 +854,11 @@ static void print_odf_code_string(GString *out, char *str) {
 }
 
 /* print_odf_string - print string, escaping for HTML and saving newlines */
-static void print_odf_string(GString *out, char *str) {
+static void print_odf_string(GString *out, char *str, size_t len) {
+    char *start = str;
+    char *end = str + len;
     char *tmp;
-    while (*str != '\0') {
+    while (str < end) {
         switch (*str) {
         case '&':
             g_string_append_printf(out, "&amp;");
@@ -848,9 +875,9 @@ static void print_odf_string(GString *out, char *str) {
         case '\n':
             tmp = str;
             tmp--;
-            if (*tmp == ' ') {
+            if (tmp >= start && *tmp == ' ') {
                 tmp--;
-                if (*tmp == ' ') {
+                if (tmp >= start && *tmp == ' ') {
                     g_string_append_printf(out, "<text:line-break/>");
                 } else {
                     g_string_append_printf(out, "\n");
@@ -862,11 +889,11 @@ static void print_odf_string(GString *out, char *str) {
         case ' ':
             tmp = str;
             tmp++;
-            if (*tmp == ' ') {
+            if (tmp < end && *tmp == ' ') {
                 tmp++;
-                if (*tmp == ' ') {
+                if (tmp < end && *tmp == ' ') {
                     tmp++;
-                    if (*tmp == ' ') {
+                    if (tmp < end && *tmp == ' ') {
                         g_string_append_printf(out, "<text:tab/>");
                         str = tmp;
                     } else {
@@ -887,26 +914,26 @@ static void print_odf_string(GString *out, char *str) {
 }
 
 /* print_odf_element_list - print an element list as ODF */
-static void print_odf_element_list(GString *out, element *list) {
+static void print_odf_element_list(printer_context *ctx, GString *out, element *list) {
     while (list != NULL) {
-        print_odf_element(out, list);
+        print_odf_element(ctx, out, list);
         list = list->next;
     }
 }
 
 /* print_odf_element - print an element as ODF */
-static void print_odf_element(GString *out, element *elt) {
+static void print_odf_element(printer_context *ctx, GString *out, element *elt) {
     int lev;
     int old_type = 0;
     switch (elt->key) {
     case SPACE:
-        g_string_append_printf(out, "%s", elt->contents.str);
+        g_string_append_len(out, elt->contents.str, elt->len);
         break;
     case LINEBREAK:
         g_string_append_printf(out, "<text:line-break/>");
         break;
     case STR:
-        print_html_string(out, elt->contents.str, 0);
+        print_html_string(out, elt->contents.str, elt->len, 0);
         break;
     case ELLIPSIS:
         g_string_append_printf(out, "&hellip;");
@@ -922,62 +949,62 @@ static void print_odf_element(GString *out, element *elt) {
         break;
     case SINGLEQUOTED:
         g_string_append_printf(out, "&lsquo;");
-        print_odf_element_list(out, elt->children);
+        print_odf_element_list(ctx, out, elt->children);
         g_string_append_printf(out, "&rsquo;");
         break;
     case DOUBLEQUOTED:
         g_string_append_printf(out, "&ldquo;");
-        print_odf_element_list(out, elt->children);
+        print_odf_element_list(ctx, out, elt->children);
         g_string_append_printf(out, "&rdquo;");
         break;
     case CODE:
         g_string_append_printf(out, "<text:span text:style-name=\"Source_20_Text\">");
-        print_html_string(out, elt->contents.str, 0);
+        print_html_string(out, elt->contents.str, elt->len, 0);
         g_string_append_printf(out, "</text:span>");
         break;
     case HTML:
         break;
     case LINK:
         g_string_append_printf(out, "<text:a xlink:type=\"simple\" xlink:href=\"");
-        print_html_string(out, elt->contents.link->url, 0);
+        print_html_string(out, elt->contents.link->url, strlen(elt->contents.link->url), 0);
         g_string_append_printf(out, "\"");
         if (strlen(elt->contents.link->title) > 0) {
             g_string_append_printf(out, " office:name=\"");
-            print_html_string(out, elt->contents.link->title, 0);
+            print_html_string(out, elt->contents.link->title, strlen(elt->contents.link->title), 0);
             g_string_append_printf(out, "\"");
         }
         g_string_append_printf(out, ">");
-        print_odf_element_list(out, elt->contents.link->label);
+        print_odf_element_list(ctx, out, elt->contents.link->label);
         g_string_append_printf(out, "</text:a>");
         break;
     case IMAGE:
         g_string_append_printf(out, "<draw:frame text:anchor-type=\"as-char\"\ndraw:z-index=\"0\" draw:style-name=\"fr1\" svg:width=\"95%%\"");
         g_string_append_printf(out, ">\n<draw:text-box><text:p><draw:frame text:anchor-type=\"as-char\" draw:z-index=\"1\" ");
         g_string_append_printf(out, "><draw:image xlink:href=\"");
-        print_odf_string(out, elt->contents.link->url);
+        print_odf_string(out, elt->contents.link->url, strlen(elt->contents.link->url));
         g_string_append_printf(out,"\" xlink:type=\"simple\" xlink:show=\"embed\" xlink:actuate=\"onLoad\" draw:filter-name=\"&lt;All formats&gt;\"/>\n</draw:frame></text:p>");
         g_string_append_printf(out, "</draw:text-box></draw:frame>\n");
         break;
     case EMPH:
         g_string_append_printf(out,
             "<text:span text:style-name=\"MMD-Italic\">");
-        print_odf_element_list(out, elt->children);
+        print_odf_element_list(ctx, out, elt->children);
         g_string_append_printf(out, "</text:span>");
         break;
     case STRONG:
         g_string_append_printf(out,
             "<text:span text:style-name=\"MMD-Bold\">");
-        print_odf_element_list(out, elt->children);
+        print_odf_element_list(ctx, out, elt->children);
         g_string_append_printf(out, "</text:span>");
         break;
     case STRIKE:
         g_string_append_printf(out,
             "<text:span text:style-name=\"StrikeThrough\">");
-        print_odf_element_list(out, elt->children);
+        print_odf_element_list(ctx, out, elt->children);
         g_string_append_printf(out, "</text:span>");
         break;
     case LIST:
-        print_odf_element_list(out, elt->children);
+        print_odf_element_list(ctx, out, elt->children);
         break;
     case RAW:
         /* Shouldn't occur - these are handled by process_raw_blocks() */
@@ -986,17 +1013,17 @@ static void print_odf_element(GString *out, element *elt) {
     case H1: case H2: case H3: case H4: case H5: case H6:
         lev = elt->key - H1 + 1;  /* assumes H1 ... H6 are in order */
         g_string_append_printf(out, "<text:h text:outline-level=\"%d\">", lev);
-        print_odf_element_list(out, elt->children);
+        print_odf_element_list(ctx, out, elt->children);
         g_string_append_printf(out, "</text:h>\n");
-        padded = 0;
+        ctx->padded = 0;
         break;
     case PLAIN:
-        print_odf_element_list(out, elt->children);
-        padded = 0;
+        print_odf_element_list(ctx, out, elt->children);
+        ctx->padded = 0;
         break;
     case PARA:
         g_string_append_printf(out, "<text:p");
-        switch (odf_type) {
+        switch (ctx->odf_type) {
             case BLOCKQUOTE:
                 g_string_append_printf(out," text:style-name=\"Quotations\"");
                 break;
@@ -1018,7 +1045,7 @@ static void print_odf_element(GString *out, element *elt) {
                 break;
         }
         g_string_append_printf(out, ">");
-        print_odf_element_list(out, elt->children);
+        print_odf_element_list(ctx, out, elt->children);
         g_string_append_printf(out, "</text:p>\n");
         break;
     case HRULE:
@@ -1027,52 +1054,51 @@ static void print_odf_element(GString *out, element *elt) {
     case HTMLBLOCK:
         /* don't print HTML block */
         /* but do print HTML comments for raw ODF */
-        if (strncmp(elt->contents.str,"<!--",4) == 0) {
+        if (elt->len >= 7 && strncmp(elt->contents.str,"<!--",4) == 0) {
             /* trim "-->" from end */
-            elt->contents.str[strlen(elt->contents.str)-3] = '\0';
-            g_string_append_printf(out, "%s", &elt->contents.str[4]);
+            g_string_append_len(out, &elt->contents.str[4], elt->len - 7);
         }
         break;
     case VERBATIM:
-        old_type = odf_type;
-        odf_type = VERBATIM;
+        old_type = ctx->odf_type;
+        ctx->odf_type = VERBATIM;
         g_string_append_printf(out, "<text:p text:style-name=\"Preformatted Text\">");
-        print_odf_code_string(out, elt->contents.str);
+        print_odf_code_string(out, elt->contents.str, elt->len);
         g_string_append_printf(out, "</text:p>\n");
-        odf_type = old_type;
+        ctx->odf_type = old_type;
         break;
     case BULLETLIST:
-        if ((odf_type == BULLETLIST) ||
-            (odf_type == ORDEREDLIST)) {
+        if ((ctx->odf_type == BULLETLIST) ||
+            (ctx->odf_type == ORDEREDLIST)) {
             /* I think this was made unnecessary by another change.
             Same for ORDEREDLIST below */
             /*  g_string_append_printf(out, "</text:p>"); */
         }
-        old_type = odf_type;
-        odf_type = BULLETLIST;
+        old_type = ctx->odf_type;
+        ctx->odf_type = BULLETLIST;
         g_string_append_printf(out, "%s", "<text:list>");
-        print_odf_element_list(out, elt->children);
+        print_odf_element_list(ctx, out, elt->children);
         g_string_append_printf(out, "%s", "</text:list>");
-        odf_type = old_type;
+        ctx->odf_type = old_type;
         break;
     case ORDEREDLIST:
-        if ((odf_type == BULLETLIST) ||
-            (odf_type == ORDEREDLIST)) {
+        if ((ctx->odf_type == BULLETLIST) ||
+            (ctx->odf_type == ORDEREDLIST)) {
             /* g_string_append_printf(out, "</text:p>"); */
         }
-        old_type = odf_type;
-        odf_type = ORDEREDLIST;
+        old_type = ctx->odf_type;
+        ctx->odf_type = ORDEREDLIST;
         g_string_append_printf(out, "%s", "<text:list>\n");
-        print_odf_element_list(out, elt->children);
+        print_odf_element_list(ctx, out, elt->children);
         g_string_append_printf(out, "%s", "</text:list>\n");
-        odf_type = old_type;
+        ctx->odf_type = old_type;
         break;
     case LISTITEM:
         g_string_append_printf(out, "<text:list-item>\n");
         if (elt->children->children->key != PARA) {
             g_string_append_printf(out, "<text:p text:style-name=\"P2\">");
         }
-        print_odf_element_list(out, elt->children);
+        print_odf_element_list(ctx, out, elt->children);
 
         if ((list_contains_key(elt->children,BULLETLIST) ||
             (list_contains_key(elt->children,ORDEREDLIST)))) {
@@ -1084,24 +1110,25 @@ static void print_odf_element(GString *out, element *elt) {
         g_string_append_printf(out, "</text:list-item>\n");
         break;
     case BLOCKQUOTE:
-        old_type = odf_type;
-        odf_type = BLOCKQUOTE;
-        print_odf_element_list(out, elt->children);
-        odf_type = old_type;
+        old_type = ctx->odf_type;
+        ctx->odf_type = BLOCKQUOTE;
+        print_odf_element_list(ctx, out, elt->children);
+        ctx->odf_type = old_type;
         break;
     case REFERENCE:
         break;
     case NOTE:
-        old_type = odf_type;
-        odf_type = NOTE;
+        old_type = ctx->odf_type;
+        ctx->odf_type = NOTE;
         /* if contents.str == 0 then print; else ignore - like above */
-        if (elt->contents.str == 0) {
+        if (elt->contents.str == 0 && open_note(ctx, elt)) {
             g_string_append_printf(out, "<text:note text:id=\"\" text:note-class=\"footnote\"><text:note-body>\n");
-            print_odf_element_list(out, elt->children);
+            print_odf_element_list(ctx, out, elt->children);
             g_string_append_printf(out, "</text:note-body>\n</text:note>\n");
+            close_note(ctx);
        }
         elt->children = NULL;
-        odf_type = old_type;
+        ctx->odf_type = old_type;
         break;
         break;  default:
         fprintf(stderr, "print_odf_element encountered unknown element key = %d\n", elt->key);
@@ -1116,34 +1143,38 @@ static void print_odf_element(GString *out, element *elt) {
  ***********************************************************************/
 
 void print_element_list(GString *out, element *elt, int format, int exts) {
-    /* Initialize globals */
-    endnotes = NULL;
-    notenumber = 0;
+    printer_context printer;
+    printer_context *ctx = &printer;
 
-    extensions = exts;
-    padded = 2;  /* set padding to 2, so no extra blank lines at beginning */
+    ctx->extensions = exts;
+    ctx->odf_type = 0;
+    ctx->padded = 2;  /* set padding to 2, so no extra blank lines at beginning */
+    ctx->endnotes = NULL;
+    ctx->open_notes = NULL;
+    ctx->notenumber = 0;
+    ctx->in_list_item = false;
     switch (format) {
     case HTML_FORMAT:
-        print_html_element_list(out, elt, false);
-        if (endnotes != NULL) {
-            pad(out, 2);
-            print_html_endnotes(out);
+        print_html_element_list(ctx, out, elt, false);
+        if (ctx->endnotes != NULL) {
+            pad(ctx, out, 2);
+            print_html_endnotes(ctx, out);
         }
         break;
     case LATEX_FORMAT:
-        print_latex_element_list(out, elt);
+        print_latex_element_list(ctx, out, elt);
         break;
     case GROFF_MM_FORMAT:
-        if (extensions & EXT_STRIKE) {
+        if (ctx->extensions & EXT_STRIKE) {
           g_string_append_printf(out,
               ".de ST\n.nr width \\w'\\\\$1'\n\\Z@\\v'-.25m'\\l'\\\\n[width]u'@\\\\$1\\c\n..\n.\n");
         }
-        print_groff_mm_element_list(out, elt);
+        print_groff_mm_element_list(ctx, out, elt);
         break;
     case ODF_FORMAT:
         print_odf_header(out);
         g_string_append_printf(out, "<office:body>\n<office:text>\n");
-        if (elt != NULL) print_odf_element_list(out,elt);
+        if (elt != NULL) print_odf_element_list(ctx, out,elt);
         print_odf_footer(out);
         break;
     default:
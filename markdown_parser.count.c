@@ -0,0 +1,7080 @@
+/* A recursive-descent parser generated by peg 0.1.9 */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define YYRULECOUNT 137
+#define YYMEMOCOUNT 9
+
+/**********************************************************************
+
+  markdown_parser.leg - markdown parser in C using a PEG grammar.
+  (c) 2008 John MacFarlane (jgm at berkeley dot edu).
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License or the MIT
+  license.  See LICENSE for details.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+ ***********************************************************************/
+
+#include <stdbool.h>
+#include <assert.h>
+#include "markdown_peg.h"
+#include "utility_functions.h"
+#include "parsing_functions.h"
+#include "arena.h"
+
+#if defined(__GNUC__) && defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__GNUC__) && defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+
+
+/**********************************************************************
+
+  Definitions for leg parser generator.
+  YY_BUFFER_INPUT makes the parser work directly on the string passed
+  to yysetbuffer, so no input is copied or refilled during the parse.
+  YY_BUFFER_TEXT passes actions a yytext that points into that string,
+  so it is not null-terminated: use yyleng, and mk_str_slice to keep it.
+  YY_CTX_LOCAL keeps all parser state, including the lists below, in
+  a yycontext owned by the caller, so conversions can run concurrently.
+  YY_MEMO_DEPTH bounds the nesting of Inlines to what the stack holds;
+  a block that goes deeper is parsed again once the Inlines nested in it
+  are memoized, or if that needs more than the memo limit, with the
+  inlines that nest left as text (see BlockTry).
+
+ ***********************************************************************/
+
+
+
+# define YYSTYPE element *
+#ifdef __DEBUG__
+# define YY_DEBUG 1
+#endif
+
+#define YY_BUFFER_INPUT
+#define YY_BUFFER_TEXT
+#define YY_MEMO_DEPTH 20000
+
+/* The parser's buffers are kept with its context, across conversions;
+ * the arena counts their allocations. */
+#define YY_MALLOC(C, N)     arena_buffer((C)->arena, NULL, (N))
+#define YY_REALLOC(C, P, N) arena_buffer((C)->arena, (P), (N))
+
+/* bracket_index - where the scan of a Label from each position stops;
+ * see label_closes */
+typedef struct {
+    struct bracket *slots;  /* Hashed on position; size is a power of 2. */
+    int size;
+    int count;              /* Slots used by the parse numbered gen. */
+    int gen;
+    int *path;              /* Positions passed by the scans in progress. */
+    int top;
+    int max;
+} bracket_index;
+
+/* tick_index - the runs of backticks between a position and the next
+ * blank line; see code_span */
+typedef struct {
+    struct tick_run *runs;  /* Sorted by length, then by position. */
+    int count;
+    int max;
+    int gen;                /* Parse the runs were found in. */
+    int from;               /* Start of the text searched. */
+    int to;                 /* The next blank line, or the end. */
+    int run_gen;            /* Parse the run below was found in. */
+    int run_from;           /* The run of backticks looked at last, */
+    int run_to;             /* so a scan within it need not count it again. */
+} tick_index;
+
+/* line_index - the lines of a text, found as far as the parse has
+ * looked, or all of them; see find_line */
+typedef struct {
+    struct line *lines;     /* In order. */
+    int count;
+    int max;
+    char *text;
+    int length;
+    int scanned;            /* End of the last line found. */
+} line_index;
+
+/* boundary_list - offsets where top-level blocks may begin; see
+ * note_boundary */
+typedef struct {
+    int *offsets;           /* In increasing order. */
+    int count;
+    int max;
+} boundary_list;
+
+#define HTML_BLOCK_TAGS 36  /* Entries of html_block_tags. */
+
+/* html_index - the open and close tags of HTML blocks found so far in
+ * the text parsed; see html_block */
+typedef struct {
+    struct html_tag *tags;  /* In order of position. */
+    int count;
+    int max;
+    int gen;                /* Parse the tags were found in. */
+    int scanned;            /* End of the text searched. */
+    int open[HTML_BLOCK_TAGS];  /* Last unclosed open tag of each name. */
+    int comment_gen;        /* Parse the comment close below was found in. */
+    int comment_from;       /* The first "-->" from here */
+    int comment_close;      /* begins here, or at the limit if there is none. */
+} html_index;
+
+#define YY_CTX_LOCAL
+#define YY_CTX_MEMBERS \
+    element *references;    /* List of link references found. */ \
+    element *notes;         /* List of footnotes found. */ \
+    label_index *reference_index;  /* references, hashed on their labels. */ \
+    label_index *note_index;       /* notes, hashed on their labels. */ \
+    element *parse_result;  /* Results of parse. */ \
+    char *segment_end;      /* End of the segment parsed by parse_segment. */ \
+    bracket_index brackets; /* Where the scans of Label stop. */ \
+    int note_close_gen;     /* Parse the scan below was made in. */ \
+    int note_close_from;    /* The scan of a note label from here */ \
+    int note_close_at;      /* stopped here; see note_label_closes. */ \
+    tick_index ticks;       /* Runs of backticks, for Code. */ \
+    bool loose_list;        /* Set by the actions of a loose List. */ \
+    html_index html;        /* Block tags, for HtmlBlock. */ \
+    line_index lines;       /* Lines of a text that is not the document. */ \
+    line_index document_lines;  /* Filled by index_document. */ \
+    line_index *document;   /* Lines of the document, shared with copies. */ \
+    line_index *text_lines; /* Lines of the text parsed: one of the above. */ \
+    int line_offset;        /* Of the text parsed in text_lines. */ \
+    int line_hint;          /* The line found last. */ \
+    boundary_list boundaries;  /* Found by parse_definitions. */ \
+    int syntax_extensions;  /* Syntax extensions selected. */ \
+    int parse;              /* Counts parses, for the indexes of the text. */ \
+    int block_start;        /* Where the block being parsed begins. */ \
+    int block_filled;       /* Where the Inlines memoized for it end. */ \
+    int flat_inlines;       /* Inlines left as text, one of the levels below. */ \
+    bool normal[256];       /* Bytes that are a NormalChar with them. */ \
+    markdown_arena *arena;  /* Owner of the elements built by actions. */
+
+/* extension - true if extension is selected in the current parse */
+#define extension(ext) (ctx->syntax_extensions & (ext))
+
+/* blank_until - true if s is at or past end, or only blank lines lie
+ * between them */
+static bool blank_until(char *s, char *end) {
+    for (; s < end; s++)
+        if (*s != ' ' && *s != '\t' && *s != '\n' && *s != '\r')
+            return false;
+    return true;
+}
+
+static bool label_closes(parser_context *ctx);
+static bool note_label_closes(parser_context *ctx);
+static bool code_span(parser_context *ctx);
+static bool html_block(parser_context *ctx);
+static bool html_script(parser_context *ctx);
+static bool html_comment(parser_context *ctx);
+static bool note_boundary(parser_context *ctx);
+static bool line_blank(parser_context *ctx);
+static bool line_end(parser_context *ctx);
+static char underlined(parser_context *ctx);
+static bool nonindent_space(parser_context *ctx);
+static bool indent(parser_context *ctx);
+static bool rule_line(parser_context *ctx);
+static bool normal_chars(parser_context *ctx);
+static bool after_smart_mark(parser_context *ctx);
+static element * smart_str(parser_context *ctx, element *str, element *list);
+static element * defer_link(parser_context *ctx, element *text, element *label, element *literal);
+static bool begin_block(parser_context *ctx);
+static bool retry_block(parser_context *ctx, int (*rule)(parser_context *));
+static bool flatten_block(parser_context *ctx, int level);
+static element * parse_blocks(parser_context *ctx, char *string, size_t len);
+
+/* Levels of flat_inlines: which inlines that nest are left as text. */
+#define NESTED_INLINES  0   /* None. */
+#define FLAT_EMPHASIS   1   /* Emphasis, strong emphasis and strike-through. */
+#define FLAT_INLINES    2   /* Those, links, images, inline notes and quotes. */
+
+/* nested_emphasis - true unless emphasis is left as text */
+#define nested_emphasis() (ctx->flat_inlines < FLAT_EMPHASIS)
+
+/* nested_inlines - true unless links, inline notes and quotes are left as text */
+#define nested_inlines() (ctx->flat_inlines < FLAT_INLINES)
+
+/* at_segment_end - true if parse_segment should stop before the next block */
+#define at_segment_end() (ctx->segment_end != NULL && blank_until(ctx->buf + ctx->pos, ctx->segment_end))
+
+
+
+/**********************************************************************
+
+  PEG grammar and parser actions for markdown syntax.
+
+ ***********************************************************************/
+
+
+#ifndef YY_LOCAL
+#define YY_LOCAL(T)	static T
+#endif
+#ifndef YY_ACTION
+#define YY_ACTION(T)	static T
+#endif
+#ifndef YY_RULE
+#define YY_RULE(T)	static T
+#endif
+#ifndef YY_PARSE
+#define YY_PARSE(T)	T
+#endif
+#ifndef YYPARSE
+#define YYPARSE		yyparse
+#endif
+#ifndef YYPARSEFROM
+#define YYPARSEFROM	yyparsefrom
+#endif
+#ifndef YYSETBUFFER
+#define YYSETBUFFER	yysetbuffer
+#endif
+#ifndef YYMEMOREPORT
+#define YYMEMOREPORT	yymemoreport
+#endif
+#ifndef YYRELEASE
+#define YYRELEASE	yyrelease
+#endif
+#ifndef YY_INPUT
+#define YY_INPUT(buf, result, max_size)			\
+  {							\
+    int yyc= getchar();					\
+    result= (EOF == yyc) ? 0 : (*(buf)= yyc, 1);	\
+    yyprintf((stderr, "<%c>", yyc));			\
+  }
+#endif
+#ifndef YY_MALLOC
+#define YY_MALLOC(C, N)		malloc(N)
+#endif
+#ifndef YY_REALLOC
+#define YY_REALLOC(C, P, N)	realloc(P, N)
+#endif
+#ifndef YY_FREE
+#define YY_FREE(C, P)		free(P)
+#endif
+#ifndef YY_BEGIN
+#define YY_BEGIN	( ctx->begin= ctx->pos, 1)
+#endif
+#ifndef YY_END
+#define YY_END		( ctx->end= ctx->pos, 1)
+#endif
+long yyevents;
+static void yyreport(void) __attribute__((destructor));
+static void yyreport(void) { if (getenv("YYCOUNT")) fprintf(stderr, "events %ld\n", yyevents); }
+#define yyprintf(args) (yyevents++)
+#ifndef YYSTYPE
+#define YYSTYPE	int
+#endif
+
+#ifndef YY_PART
+
+typedef struct _yycontext yycontext;
+typedef void (*yyaction)(yycontext *ctx, char *yytext, int yyleng);
+typedef struct _yythunk { int begin, end;  yyaction  action;  struct _yythunk *next; } yythunk;
+
+#if YYMEMOCOUNT
+#ifndef YY_MEMO_SIZE
+#define YY_MEMO_SIZE	16384
+#endif
+#ifndef YY_MEMO_SHARE
+#define YY_MEMO_SHARE	16
+#endif
+#ifndef YY_MEMO_LIMIT
+#define YY_MEMO_LIMIT	(256L << 20)
+#endif
+#ifndef YY_MEMO_DEPTH
+#define YY_MEMO_DEPTH	0
+#endif
+typedef struct _yymemo { int memo, pos, gen, ok, next, marked, begin, end;  yythunk *thunks;  int thunkslen, thunkcount; } yymemo;
+typedef struct _yyshared { struct _yyshared *next;  int size, used;  yythunk *thunks; } yyshared;
+#endif
+
+struct _yycontext {
+  char     *buf;
+  int       buflen;
+  int       pos;
+  int       limit;
+  char     *text;
+  int       textlen;
+  int       begin;
+  int       end;
+  int       textmax;
+  yythunk  *thunks;
+  int       thunkslen;
+  int       thunkpos;
+  YYSTYPE   yy;
+  YYSTYPE  *val;
+  YYSTYPE  *vals;
+  int       valslen;
+  int       nomem;
+#if YYMEMOCOUNT
+  yymemo   *memos;
+  int       memosize;
+  long      memobytes;
+  long      sharedbytes;
+  long      memolimit;
+  int       memokeep;
+  long      keptbytes;
+  int       keptfrom;
+  int       keptto;
+  int       memodepth;
+  int       memogen;
+  int       marked;
+  yyshared *shared;
+  yyshared *spare;
+  yyshared *mark;
+  long      memohits[YYMEMOCOUNT];
+  long      memomisses[YYMEMOCOUNT];
+#endif
+#ifdef YY_CTX_MEMBERS
+  YY_CTX_MEMBERS
+#endif
+};
+
+#ifdef YY_CTX_LOCAL
+#define YY_CTX_PARAM_	yycontext *yyctx,
+#define YY_CTX_PARAM	yycontext *yyctx
+#define YY_CTX_ARG_	yyctx,
+#define YY_CTX_ARG	yyctx
+#else
+#define YY_CTX_PARAM_
+#define YY_CTX_PARAM
+#define YY_CTX_ARG_
+#define YY_CTX_ARG
+yycontext yyctx0;
+yycontext *yyctx= &yyctx0;
+#endif
+
+YY_LOCAL(int) yyrefill(yycontext *ctx)
+{
+#ifdef YY_BUFFER_INPUT
+  return 0;
+#else
+  int yyn;
+  while (ctx->buflen - ctx->pos < 512)
+    {
+      char *buf= (char *)YY_REALLOC(ctx, ctx->buf, ctx->buflen * 2);
+      if (!buf)
+	{
+	  ctx->nomem= 1;
+	  return 0;
+	}
+      ctx->buf= buf;
+      ctx->buflen *= 2;
+    }
+  YY_INPUT((ctx->buf + ctx->pos), yyn, (ctx->buflen - ctx->pos));
+  if (!yyn) return 0;
+  ctx->limit += yyn;
+  return 1;
+#endif
+}
+
+YY_LOCAL(int) yypeek(yycontext *ctx)
+{
+  if (ctx->pos >= ctx->limit && !yyrefill(ctx)) return -1;
+  return (unsigned char)ctx->buf[ctx->pos];
+}
+
+YY_LOCAL(int) yyfirst(int c, unsigned char *bits)
+{
+  return c >= 0 && (bits[c >> 3] & (1 << (c & 7)));
+}
+
+YY_LOCAL(int) yymatchDot(yycontext *ctx)
+{
+  if (ctx->pos >= ctx->limit && !yyrefill(ctx)) return 0;
+  ++ctx->pos;
+  return 1;
+}
+
+YY_LOCAL(int) yymatchChar(yycontext *ctx, int c)
+{
+  if (ctx->pos >= ctx->limit && !yyrefill(ctx)) return 0;
+  if ((unsigned char)ctx->buf[ctx->pos] == c)
+    {
+      ++ctx->pos;
+      yyprintf((stderr, "  ok   yymatchChar(ctx, %c) @ %s\n", c, ctx->buf+ctx->pos));
+      return 1;
+    }
+  yyprintf((stderr, "  fail yymatchChar(ctx, %c) @ %s\n", c, ctx->buf+ctx->pos));
+  return 0;
+}
+
+YY_LOCAL(int) yymatchString(yycontext *ctx, char *s)
+{
+  int yysav= ctx->pos;
+  while (*s)
+    {
+      if (ctx->pos >= ctx->limit && !yyrefill(ctx)) return 0;
+      if (ctx->buf[ctx->pos] != *s)
+        {
+          ctx->pos= yysav;
+          return 0;
+        }
+      ++s;
+      ++ctx->pos;
+    }
+  return 1;
+}
+
+YY_LOCAL(int) yymatchClass(yycontext *ctx, unsigned char *bits)
+{
+  int c;
+  if (ctx->pos >= ctx->limit && !yyrefill(ctx)) return 0;
+  c= (unsigned char)ctx->buf[ctx->pos];
+  if (bits[c >> 3] & (1 << (c & 7)))
+    {
+      ++ctx->pos;
+      yyprintf((stderr, "  ok   yymatchClass @ %s\n", ctx->buf+ctx->pos));
+      return 1;
+    }
+  yyprintf((stderr, "  fail yymatchClass @ %s\n", ctx->buf+ctx->pos));
+  return 0;
+}
+
+YY_LOCAL(void) yyDo(yycontext *ctx, yyaction action, int begin, int end)
+{
+  while (ctx->thunkpos >= ctx->thunkslen)
+    {
+      yythunk *thunks= (yythunk *)YY_REALLOC(ctx, ctx->thunks, sizeof(yythunk) * ctx->thunkslen * 2);
+      if (!thunks)
+	{
+	  ctx->nomem= 1;
+	  return;
+	}
+      ctx->thunks= thunks;
+      ctx->thunkslen *= 2;
+    }
+  ctx->thunks[ctx->thunkpos].begin=  begin;
+  ctx->thunks[ctx->thunkpos].end=    end;
+  ctx->thunks[ctx->thunkpos].action= action;
+  ++ctx->thunkpos;
+}
+
+#ifdef YY_BUFFER_TEXT
+#define YY_TEXT_LENGTH(C)	((C)->end > (C)->begin ? (C)->end - (C)->begin : 0)
+#define YY_TEXT_POINTER(C)	((C)->buf + (C)->begin)
+#else
+#define YY_TEXT_LENGTH(C)	yyText((C), (C)->begin, (C)->end)
+#define YY_TEXT_POINTER(C)	((C)->text)
+
+YY_LOCAL(int) yyText(yycontext *ctx, int begin, int end)
+{
+  int yyleng= end - begin;
+  if (yyleng <= 0)
+    yyleng= 0;
+  else
+    {
+      while (ctx->textlen < (yyleng + 1))
+	{
+	  char *text= (char *)YY_REALLOC(ctx, ctx->text, ctx->textlen * 2);
+	  if (!text)
+	    {
+	      ctx->nomem= 1;
+	      ctx->text[0]= '\0';
+	      return 0;
+	    }
+	  ctx->text= text;
+	  ctx->textlen *= 2;
+	}
+      memcpy(ctx->text, ctx->buf + begin, yyleng);
+    }
+  ctx->text[yyleng]= '\0';
+  return yyleng;
+}
+#endif
+
+YY_LOCAL(void) yyDoThunk(yycontext *ctx, yythunk *thunk, int pos)
+{
+#ifdef YY_BUFFER_TEXT
+  int yyleng= thunk->end ? (thunk->end > thunk->begin ? thunk->end - thunk->begin : 0) : thunk->begin;
+  char *yytext= ctx->buf + thunk->begin;
+#else
+  int yyleng= thunk->end ? yyText(ctx, thunk->begin, thunk->end) : thunk->begin;
+  char *yytext= ctx->text;
+#endif
+  int i;
+  if (!thunk->action)
+    {
+      for (i= 0;  i < thunk->begin && !ctx->nomem;  ++i)
+	yyDoThunk(ctx, thunk->next + i, i);
+      return;
+    }
+  yyprintf((stderr, "DO [%d] %p %.*s\n", pos, thunk->action, thunk->end ? yyleng : 0, yytext));
+  thunk->action(ctx, yytext, yyleng);
+}
+
+YY_LOCAL(void) yyDone(yycontext *ctx)
+{
+  int pos;
+  for (pos= 0;  pos < ctx->thunkpos && !ctx->nomem;  ++pos)
+    yyDoThunk(ctx, &ctx->thunks[pos], pos);
+  ctx->thunkpos= 0;
+}
+
+YY_LOCAL(void) yyCommit(yycontext *ctx)
+{
+#ifdef YY_BUFFER_INPUT
+  ctx->buf += ctx->pos;
+  ctx->limit -= ctx->pos;
+#else
+  if ((ctx->limit -= ctx->pos))
+    {
+      memmove(ctx->buf, ctx->buf + ctx->pos, ctx->limit);
+    }
+#endif
+  ctx->begin -= ctx->pos;
+  ctx->end -= ctx->pos;
+  ctx->pos= ctx->thunkpos= 0;
+#if YYMEMOCOUNT
+  ++ctx->memogen;
+  ctx->sharedbytes= 0;
+  ctx->mark= 0;
+  while (ctx->shared)
+    {
+      yyshared *next= ctx->shared->next;
+      ctx->shared->next= ctx->spare;
+      ctx->spare= ctx->shared;
+      ctx->shared= next;
+    }
+#endif
+}
+
+YY_LOCAL(int) yyAccept(yycontext *ctx, int tp0)
+{
+  if (tp0)
+    {
+      fprintf(stderr, "accept denied at %d\n", tp0);
+      return 0;
+    }
+  else
+    {
+      yyDone(ctx);
+      yyCommit(ctx);
+    }
+  return 1;
+}
+
+#if YYMEMOCOUNT
+
+YY_LOCAL(int) yyRecall(yycontext *ctx, int memo)
+{
+  yymemo *m= &ctx->memos[(ctx->pos * YYMEMOCOUNT + memo) & (ctx->memosize - 1)];
+  if (ctx->nomem)
+    return 0;		/* the parse is being abandoned */
+  if (m->gen != ctx->memogen || m->pos != ctx->pos || m->memo != memo)
+    {
+      if (YY_MEMO_DEPTH && ctx->memodepth >= YY_MEMO_DEPTH)
+	{
+	  ctx->nomem= 2;	/* nested too deeply for the stack */
+	  return 0;
+	}
+      ++ctx->memodepth;
+      ++ctx->memomisses[memo];
+      return -1;
+    }
+  while (ctx->thunkpos + m->thunkcount >= ctx->thunkslen)
+    {
+      yythunk *thunks= (yythunk *)YY_REALLOC(ctx, ctx->thunks, sizeof(yythunk) * ctx->thunkslen * 2);
+      if (!thunks)
+	{
+	  ctx->nomem= 1;
+	  return 0;
+	}
+      ctx->thunks= thunks;
+      ctx->thunkslen *= 2;
+    }
+  ++ctx->memohits[memo];
+  if (m->thunkcount)
+    memcpy(ctx->thunks + ctx->thunkpos, m->thunks, sizeof(yythunk) * m->thunkcount);
+  ctx->thunkpos += m->thunkcount;
+  ctx->pos= m->next;
+  if (m->marked & 1) ctx->begin= m->begin;
+  if (m->marked & 2) ctx->end= m->end;
+  ctx->marked |= m->marked;
+  yyprintf((stderr, "  memo %d @ %s\n", memo, ctx->buf+ctx->pos));
+  return m->ok;
+}
+
+/* Whether the memo table and the shared actions may take bytes more:
+ * they may take up to memolimit if the caller has set it, or else
+ * YY_MEMO_LIMIT.  While memokeep is set they take what they need, and
+ * yyKeepRoom holds the outcomes kept to the limit instead. */
+
+YY_LOCAL(int) yyMemoRoom(yycontext *ctx, long bytes)
+{
+  return ctx->memokeep || ctx->memobytes + ctx->sharedbytes + bytes <= (ctx->memolimit ? ctx->memolimit : YY_MEMO_LIMIT);
+}
+
+/* Whether an outcome at pos that scheduled count actions may be kept
+ * with the ones kept since yyparse() began, or since the last
+ * yyResume(): together they may need up to the limit, for a table with
+ * room for every memoized rule at each position they span, and the old
+ * half of it while it is doubled, for their actions and for those
+ * shared.  The count does not depend on the size of the table or on the
+ * outcomes recorded before, so whether a parse fits does not either. */
+
+YY_LOCAL(int) yyKeepRoom(yycontext *ctx, int pos, int count)
+{
+  int len= 4;
+  if (count > YY_MEMO_SHARE)
+    {
+      ctx->keptbytes += sizeof(yythunk) * count;
+      count= 1;
+    }
+  while (len < count) len *= 2;
+  if (count)
+    ctx->keptbytes += sizeof(yythunk) * len;
+  if (ctx->keptfrom < 0 || pos < ctx->keptfrom) ctx->keptfrom= pos;
+  if (ctx->keptto < pos) ctx->keptto= pos;
+  return ctx->keptbytes + 3L * sizeof(yymemo) * YYMEMOCOUNT * (ctx->keptto - ctx->keptfrom + 1)
+    <= (ctx->memolimit ? ctx->memolimit : YY_MEMO_LIMIT);
+}
+
+/* Thunks of a long result are moved to storage that lasts until the
+ * next commit, and replaced by one thunk that runs them.  Results that
+ * contain it, and every recall of it, then copy only that thunk. */
+
+YY_LOCAL(void) yyShare(yycontext *ctx, int thunkpos)
+{
+  int count= ctx->thunkpos - thunkpos;
+  yyshared *s= ctx->shared, **spare= &ctx->spare;
+  if (!s || s->used + count > s->size)
+    {
+      while ((s= *spare) && s->size < count)
+	spare= &s->next;
+      if (!yyMemoRoom(ctx, sizeof(yythunk) * (s ? s->size : count > 4096 ? count : 4096)))
+	return;		/* the thunks stay where they are */
+      if (s)
+	*spare= s->next;
+      else
+	{
+	  int size= count > 4096 ? count : 4096;
+	  yythunk *thunks= (yythunk *)YY_MALLOC(ctx, sizeof(yythunk) * size);
+	  if (!thunks || !(s= (yyshared *)YY_MALLOC(ctx, sizeof(yyshared))))
+	    {
+	      YY_FREE(ctx, thunks);
+	      return;	/* the thunks stay where they are */
+	    }
+	  s->size= size;
+	  s->thunks= thunks;
+	}
+      s->used= 0;
+      s->next= ctx->shared;
+      ctx->sharedbytes += sizeof(yythunk) * s->size;
+      ctx->shared= s;
+    }
+  memcpy(s->thunks + s->used, ctx->thunks + thunkpos, sizeof(yythunk) * count);
+  ctx->thunks[thunkpos].begin=  count;
+  ctx->thunks[thunkpos].end=    0;
+  ctx->thunks[thunkpos].action= 0;
+  ctx->thunks[thunkpos].next=   s->thunks + s->used;
+  ctx->thunkpos= thunkpos + 1;
+  s->used += count;
+}
+
+/* A result that would replace one recorded further on means that the
+ * parse has backtracked across more text than the table covers, and
+ * will want the results it is losing again.  The table is doubled
+ * instead, for as long as it fits within the limit with the old table,
+ * which is freed only once its results are copied.  While memokeep is
+ * set no result of the parse is replaced: the table is doubled until
+ * the new one has a place of its own. */
+
+YY_LOCAL(int) yyMemoGrow(yycontext *ctx)
+{
+  int size= ctx->memosize, i;
+  yymemo *memos;
+  if (!yyMemoRoom(ctx, sizeof(yymemo) * size * 2)
+      || !(memos= (yymemo *)YY_MALLOC(ctx, sizeof(yymemo) * size * 2)))
+    return 0;
+  for (i= 0;  i < size;  ++i)
+    {
+      yymemo *m= &ctx->memos[i];
+      int high= (m->pos * YYMEMOCOUNT + m->memo) & size;
+      memos[i | high]= *m;
+      memset(&memos[i | (size & ~high)], 0, sizeof(yymemo));
+    }
+  YY_FREE(ctx, ctx->memos);
+  ctx->memos= memos;
+  ctx->memosize= size * 2;
+  ctx->memobytes += sizeof(yymemo) * size;
+  return 1;
+}
+
+YY_LOCAL(int) yyMemo(yycontext *ctx, int memo, int pos, int thunkpos, int marked, int ok)
+{
+  yymemo *m= &ctx->memos[(pos * YYMEMOCOUNT + memo) & (ctx->memosize - 1)];
+  int count;
+  --ctx->memodepth;
+  if (ctx->memokeep && !yyKeepRoom(ctx, pos, ctx->thunkpos - thunkpos))
+    {
+      ctx->nomem= 1;
+      ctx->marked |= marked;
+      return ok;
+    }
+  if (m->gen == ctx->memogen && m->pos > pos)
+    {
+      yyMemoGrow(ctx);
+      m= &ctx->memos[(pos * YYMEMOCOUNT + memo) & (ctx->memosize - 1)];
+    }
+  while (ctx->memokeep && m->gen == ctx->memogen)
+    {
+      if (!yyMemoGrow(ctx))
+	{
+	  ctx->nomem= 1;
+	  ctx->marked |= marked;
+	  return ok;
+	}
+      m= &ctx->memos[(pos * YYMEMOCOUNT + memo) & (ctx->memosize - 1)];
+    }
+  if (ctx->thunkpos - thunkpos > YY_MEMO_SHARE)
+    yyShare(ctx, thunkpos);
+  count= ctx->thunkpos - thunkpos;
+  m->gen= ctx->memogen - 1;
+  if (m->thunkslen < count)
+    {
+      int len= m->thunkslen ? m->thunkslen : 4;
+      yythunk *thunks;
+      while (len < count) len *= 2;
+      if (!yyMemoRoom(ctx, sizeof(yythunk) * (len - m->thunkslen)))
+	thunks= 0;
+      else
+	thunks= (yythunk *)YY_REALLOC(ctx, m->thunks, sizeof(yythunk) * len);
+      if (!thunks)
+	{
+	  if (ctx->memokeep)
+	    ctx->nomem= 1;
+	  ctx->marked |= marked;
+	  return ok;		/* not recorded */
+	}
+      ctx->memobytes += sizeof(yythunk) * (len - m->thunkslen);
+      m->thunks= thunks;
+      m->thunkslen= len;
+    }
+  if (count)
+    memcpy(m->thunks, ctx->thunks + thunkpos, sizeof(yythunk) * count);
+  m->thunkcount= count;
+  m->memo= memo;
+  m->pos= pos;
+  m->gen= ctx->memogen;
+  m->ok= ok;
+  m->next= ctx->pos;
+  m->marked= ctx->marked;
+  m->begin= ctx->begin;
+  m->end= ctx->end;
+  ctx->marked |= marked;
+  return ok;
+}
+
+/* A parse abandoned for want of memory (nomem is 1) or of stack (nomem
+ * is 2) can be resumed by the grammar, to try the input that ran out
+ * another way: yyMark records where the attempt begins, and yyResume,
+ * once it has failed, forgets every outcome recorded and takes back the
+ * actions kept since the mark. */
+
+YY_LOCAL(void) yyMark(yycontext *ctx)
+{
+  ctx->mark= ctx->shared;
+}
+
+YY_LOCAL(int) yyResume(yycontext *ctx)
+{
+  if (!ctx->nomem)
+    return 0;
+  ++ctx->memogen;
+  while (ctx->shared && ctx->shared != ctx->mark)
+    {
+      yyshared *next= ctx->shared->next;
+      ctx->sharedbytes -= sizeof(yythunk) * ctx->shared->size;
+      ctx->shared->next= ctx->spare;
+      ctx->spare= ctx->shared;
+      ctx->shared= next;
+    }
+  ctx->keptbytes= 0;
+  ctx->keptfrom= ctx->keptto= -1;
+  ctx->nomem= 0;
+  return 1;
+}
+
+#endif
+
+YY_LOCAL(void) yyPush(yycontext *ctx, char *text, int count)
+{
+  long offset= ctx->val - ctx->vals + count;
+  while (ctx->valslen <= offset)
+    {
+      YYSTYPE *vals= (YYSTYPE *)YY_REALLOC(ctx, ctx->vals, sizeof(YYSTYPE) * ctx->valslen * 2);
+      if (!vals)
+	{
+	  ctx->nomem= 1;
+	  return;
+	}
+      ctx->vals= vals;
+      ctx->valslen *= 2;
+    }
+  ctx->val= ctx->vals + offset;
+}
+YY_LOCAL(void) yyPop(yycontext *ctx, char *text, int count)   { ctx->val -= count; }
+YY_LOCAL(void) yySet(yycontext *ctx, char *text, int count)   { ctx->val[count]= ctx->yy; }
+
+#endif /* YY_PART */
+
+#define	YYACCEPT	yyAccept(ctx, yythunkpos0)
+
+YY_RULE(int) yy_RawNoteBlock(yycontext *ctx); /* 137 */
+YY_RULE(int) yy_RawNoteReference(yycontext *ctx); /* 136 */
+YY_RULE(int) yy_DoubleQuoteEnd(yycontext *ctx); /* 135 */
+YY_RULE(int) yy_DoubleQuoteStart(yycontext *ctx); /* 134 */
+YY_RULE(int) yy_SingleQuoteEnd(yycontext *ctx); /* 133 */
+YY_RULE(int) yy_SingleQuoteStart(yycontext *ctx); /* 132 */
+YY_RULE(int) yy_Apostrophe(yycontext *ctx); /* 131 */
+YY_RULE(int) yy_DoubleQuoted(yycontext *ctx); /* 130 */
+YY_RULE(int) yy_SingleQuoted(yycontext *ctx); /* 129 */
+YY_RULE(int) yy_Ellipsis(yycontext *ctx); /* 128 */
+YY_RULE(int) yy_RawLine(yycontext *ctx); /* 127 */
+YY_RULE(int) yy_ExtendedSpecialChar(yycontext *ctx); /* 126 */
+YY_RULE(int) yy_AlphanumericAscii(yycontext *ctx); /* 125 */
+YY_RULE(int) yy_Quoted(yycontext *ctx); /* 124 */
+YY_RULE(int) yy_HtmlTag(yycontext *ctx); /* 123 */
+YY_RULE(int) yy_SkipBlock(yycontext *ctx); /* 122 */
+YY_RULE(int) yy_Definition(yycontext *ctx); /* 121 */
+YY_RULE(int) yy_DefinitionTry(yycontext *ctx); /* 120 */
+YY_RULE(int) yy_Definitions(yycontext *ctx); /* 119 */
+YY_RULE(int) yy_EmptyTitle(yycontext *ctx); /* 118 */
+YY_RULE(int) yy_RefTitleParens(yycontext *ctx); /* 117 */
+YY_RULE(int) yy_RefTitleDouble(yycontext *ctx); /* 116 */
+YY_RULE(int) yy_RefTitleSingle(yycontext *ctx); /* 115 */
+YY_RULE(int) yy_RefTitle(yycontext *ctx); /* 114 */
+YY_RULE(int) yy_RefSrc(yycontext *ctx); /* 113 */
+YY_RULE(int) yy_AutoLinkEmail(yycontext *ctx); /* 112 */
+YY_RULE(int) yy_AutoLinkUrl(yycontext *ctx); /* 111 */
+YY_RULE(int) yy_TitleDouble(yycontext *ctx); /* 110 */
+YY_RULE(int) yy_TitleSingle(yycontext *ctx); /* 109 */
+YY_RULE(int) yy_Nonspacechar(yycontext *ctx); /* 108 */
+YY_RULE(int) yy_Title(yycontext *ctx); /* 107 */
+YY_RULE(int) yy_Source(yycontext *ctx); /* 106 */
+YY_RULE(int) yy_ReferenceLinkSingle(yycontext *ctx); /* 105 */
+YY_RULE(int) yy_ReferenceLinkDouble(yycontext *ctx); /* 104 */
+YY_RULE(int) yy_AutoLink(yycontext *ctx); /* 103 */
+YY_RULE(int) yy_ReferenceLink(yycontext *ctx); /* 102 */
+YY_RULE(int) yy_ExplicitLink(yycontext *ctx); /* 101 */
+YY_RULE(int) yy_StrongUl(yycontext *ctx); /* 100 */
+YY_RULE(int) yy_StrongStar(yycontext *ctx); /* 99 */
+YY_RULE(int) yy_Whitespace(yycontext *ctx); /* 98 */
+YY_RULE(int) yy_EmphUl(yycontext *ctx); /* 97 */
+YY_RULE(int) yy_EmphStar(yycontext *ctx); /* 96 */
+YY_RULE(int) yy_StarLine(yycontext *ctx); /* 95 */
+YY_RULE(int) yy_UlLine(yycontext *ctx); /* 94 */
+YY_RULE(int) yy_SpecialChar(yycontext *ctx); /* 93 */
+YY_RULE(int) yy_Eof(yycontext *ctx); /* 92 */
+YY_RULE(int) yy_NormalEndline(yycontext *ctx); /* 91 */
+YY_RULE(int) yy_TerminalEndline(yycontext *ctx); /* 90 */
+YY_RULE(int) yy_LineBreak(yycontext *ctx); /* 89 */
+YY_RULE(int) yy_CharEntity(yycontext *ctx); /* 88 */
+YY_RULE(int) yy_DecEntity(yycontext *ctx); /* 87 */
+YY_RULE(int) yy_HexEntity(yycontext *ctx); /* 86 */
+YY_RULE(int) yy_AposChunk(yycontext *ctx); /* 85 */
+YY_RULE(int) yy_Alphanumeric(yycontext *ctx); /* 84 */
+YY_RULE(int) yy_StrChunk(yycontext *ctx); /* 83 */
+YY_RULE(int) yy_NormalChars(yycontext *ctx); /* 82 */
+YY_RULE(int) yy_Symbol(yycontext *ctx); /* 81 */
+YY_RULE(int) yy_Smart(yycontext *ctx); /* 80 */
+YY_RULE(int) yy_EscapedChar(yycontext *ctx); /* 79 */
+YY_RULE(int) yy_Entity(yycontext *ctx); /* 78 */
+YY_RULE(int) yy_RawHtml(yycontext *ctx); /* 77 */
+YY_RULE(int) yy_Code(yycontext *ctx); /* 76 */
+YY_RULE(int) yy_InlineNote(yycontext *ctx); /* 75 */
+YY_RULE(int) yy_NoteReference(yycontext *ctx); /* 74 */
+YY_RULE(int) yy_Link(yycontext *ctx); /* 73 */
+YY_RULE(int) yy_Image(yycontext *ctx); /* 72 */
+YY_RULE(int) yy_Strike(yycontext *ctx); /* 71 */
+YY_RULE(int) yy_Emph(yycontext *ctx); /* 70 */
+YY_RULE(int) yy_Strong(yycontext *ctx); /* 69 */
+YY_RULE(int) yy_Space(yycontext *ctx); /* 68 */
+YY_RULE(int) yy_UlOrStarLine(yycontext *ctx); /* 67 */
+YY_RULE(int) yy_Str(yycontext *ctx); /* 66 */
+YY_RULE(int) yy_InStyleTags(yycontext *ctx); /* 65 */
+YY_RULE(int) yy_StyleClose(yycontext *ctx); /* 64 */
+YY_RULE(int) yy_HtmlAttribute(yycontext *ctx); /* 63 */
+YY_RULE(int) yy_Spnl(yycontext *ctx); /* 62 */
+YY_RULE(int) yy_StyleOpen(yycontext *ctx); /* 61 */
+YY_RULE(int) yy_HtmlComment(yycontext *ctx); /* 60 */
+YY_RULE(int) yy_HtmlScript(yycontext *ctx); /* 59 */
+YY_RULE(int) yy_HtmlBlockInTags(yycontext *ctx); /* 58 */
+YY_RULE(int) yy_OptionallyIndentedLine(yycontext *ctx); /* 57 */
+YY_RULE(int) yy_Indent(yycontext *ctx); /* 56 */
+YY_RULE(int) yy_ListBlockLine(yycontext *ctx); /* 55 */
+YY_RULE(int) yy_ListContinuationBlock(yycontext *ctx); /* 54 */
+YY_RULE(int) yy_ListBlock(yycontext *ctx); /* 53 */
+YY_RULE(int) yy_Enumerator(yycontext *ctx); /* 52 */
+YY_RULE(int) yy_ListItem(yycontext *ctx); /* 51 */
+YY_RULE(int) yy_List(yycontext *ctx); /* 50 */
+YY_RULE(int) yy_Spacechar(yycontext *ctx); /* 49 */
+YY_RULE(int) yy_Bullet(yycontext *ctx); /* 48 */
+YY_RULE(int) yy_VerbatimChunk(yycontext *ctx); /* 47 */
+YY_RULE(int) yy_IndentedLine(yycontext *ctx); /* 46 */
+YY_RULE(int) yy_NonblankIndentedLine(yycontext *ctx); /* 45 */
+YY_RULE(int) yy_Line(yycontext *ctx); /* 44 */
+YY_RULE(int) yy_BlockQuoteRaw(yycontext *ctx); /* 43 */
+YY_RULE(int) yy_SetextBottom2(yycontext *ctx); /* 42 */
+YY_RULE(int) yy_SetextBottom1(yycontext *ctx); /* 41 */
+YY_RULE(int) yy_SetextHeading2(yycontext *ctx); /* 40 */
+YY_RULE(int) yy_SetextHeading1(yycontext *ctx); /* 39 */
+YY_RULE(int) yy_SetextHeading(yycontext *ctx); /* 38 */
+YY_RULE(int) yy_AtxHeading(yycontext *ctx); /* 37 */
+YY_RULE(int) yy_AtxStart(yycontext *ctx); /* 36 */
+YY_RULE(int) yy_Sp(yycontext *ctx); /* 35 */
+YY_RULE(int) yy_Newline(yycontext *ctx); /* 34 */
+YY_RULE(int) yy_AtxInline(yycontext *ctx); /* 33 */
+YY_RULE(int) yy_NonindentSpace(yycontext *ctx); /* 32 */
+YY_RULE(int) yy_Inlines(yycontext *ctx); /* 31 */
+YY_RULE(int) yy_Plain(yycontext *ctx); /* 30 */
+YY_RULE(int) yy_Para(yycontext *ctx); /* 29 */
+YY_RULE(int) yy_StyleBlock(yycontext *ctx); /* 28 */
+YY_RULE(int) yy_HtmlBlock(yycontext *ctx); /* 27 */
+YY_RULE(int) yy_BulletList(yycontext *ctx); /* 26 */
+YY_RULE(int) yy_OrderedList(yycontext *ctx); /* 25 */
+YY_RULE(int) yy_Heading(yycontext *ctx); /* 24 */
+YY_RULE(int) yy_HorizontalRule(yycontext *ctx); /* 23 */
+YY_RULE(int) yy_Reference(yycontext *ctx); /* 22 */
+YY_RULE(int) yy_Note(yycontext *ctx); /* 21 */
+YY_RULE(int) yy_Verbatim(yycontext *ctx); /* 20 */
+YY_RULE(int) yy_BlockQuote(yycontext *ctx); /* 19 */
+YY_RULE(int) yy_BlockBody(yycontext *ctx); /* 18 */
+YY_RULE(int) yy_BlockTry(yycontext *ctx); /* 17 */
+YY_RULE(int) yy_BlankLine(yycontext *ctx); /* 16 */
+YY_RULE(int) yy_Block(yycontext *ctx); /* 15 */
+YY_RULE(int) yy_SegmentEnd(yycontext *ctx); /* 14 */
+YY_RULE(int) yy_StartList(yycontext *ctx); /* 13 */
+YY_RULE(int) yy_Blocks(yycontext *ctx); /* 12 */
+YY_RULE(int) yy_BOM(yycontext *ctx); /* 11 */
+YY_RULE(int) yy_Doc(yycontext *ctx); /* 10 */
+YY_RULE(int) yy_StrikeTail(yycontext *ctx); /* 9 */
+YY_RULE(int) yy_StrongUlTail(yycontext *ctx); /* 8 */
+YY_RULE(int) yy_StrongStarTail(yycontext *ctx); /* 7 */
+YY_RULE(int) yy_EmphUlTail(yycontext *ctx); /* 6 */
+YY_RULE(int) yy_EmphStarTail(yycontext *ctx); /* 5 */
+YY_RULE(int) yy_SourceContents(yycontext *ctx); /* 4 */
+YY_RULE(int) yy_Endline(yycontext *ctx); /* 3 */
+YY_RULE(int) yy_Label(yycontext *ctx); /* 2 */
+YY_RULE(int) yy_Inline(yycontext *ctx); /* 1 */
+
+YY_ACTION(void) yy_3_RawNoteBlock(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_3_RawNoteBlock\n"));
+     yy = mk_str_from_list(ctx->arena, a, true);
+                    yy->key = RAW;
+                ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_2_RawNoteBlock(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_RawNoteBlock\n"));
+   a = cons(mk_str_slice(ctx->arena, yytext, yyleng), a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_1_RawNoteBlock(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_RawNoteBlock\n"));
+   a = cons(yy, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_2_InlineNote(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_InlineNote\n"));
+   yy = mk_list(ctx->arena, NOTE, a);
+                  yy->contents.str = 0; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_1_InlineNote(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_InlineNote\n"));
+   a = cons(yy, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_3_Note(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define ref ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_3_Note\n"));
+     yy = mk_list(ctx->arena, NOTE, a);
+                    yy->contents.str = ref->contents.str;
+                    yy->len = ref->len;
+                ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+#undef ref
+}
+YY_ACTION(void) yy_2_Note(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define ref ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_Note\n"));
+   a = cons(yy, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+#undef ref
+}
+YY_ACTION(void) yy_1_Note(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define ref ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_Note\n"));
+   a = cons(yy, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+#undef ref
+}
+YY_ACTION(void) yy_1_RawNoteReference(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_RawNoteReference\n"));
+   yy = mk_str_slice(ctx->arena, yytext, yyleng); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_1_NoteReference(yycontext *ctx, char *yytext, int yyleng)
+{
+#define ref ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_NoteReference\n"));
+     element *match;
+                    if (find_note(&match, ref, ctx->note_index)) {
+                        yy = mk_element(ctx->arena, NOTE);
+                        assert(match->children != NULL);
+                        yy->children = match->children;
+                        yy->contents.str = 0;
+                    } else {
+                        char *s;
+                        s = arena_alloc(ctx->arena, ref->len + 4);
+                        sprintf(s, "[^%.*s]", (int) ref->len, ref->contents.str);
+                        yy = mk_str(ctx->arena, s);
+                    }
+                ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef ref
+}
+YY_ACTION(void) yy_2_DoubleQuoted(yycontext *ctx, char *yytext, int yyleng)
+{
+#define b ctx->val[-1]
+#define a ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_DoubleQuoted\n"));
+   yy = mk_list(ctx->arena, DOUBLEQUOTED, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_DoubleQuoted(yycontext *ctx, char *yytext, int yyleng)
+{
+#define b ctx->val[-1]
+#define a ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_DoubleQuoted\n"));
+   a = cons(b, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_SingleQuoted(yycontext *ctx, char *yytext, int yyleng)
+{
+#define b ctx->val[-1]
+#define a ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_SingleQuoted\n"));
+   yy = mk_list(ctx->arena, SINGLEQUOTED, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_SingleQuoted(yycontext *ctx, char *yytext, int yyleng)
+{
+#define b ctx->val[-1]
+#define a ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_SingleQuoted\n"));
+   a = cons(b, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_Ellipsis(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_Ellipsis\n"));
+   yy = mk_element(ctx->arena, ELLIPSIS); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_1_Apostrophe(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_Apostrophe\n"));
+   yy = mk_element(ctx->arena, APOSTROPHE); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_1_Line(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_Line\n"));
+   yy = mk_str_slice(ctx->arena, yytext, yyleng); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_1_StartList(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_StartList\n"));
+   yy = NULL; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_1_RawHtml(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_RawHtml\n"));
+     if (extension(EXT_FILTER_HTML)) {
+                    yy = mk_list(ctx->arena, LIST, NULL);
+                } else {
+                    yy = mk_str_slice(ctx->arena, yytext, yyleng);
+                    yy->key = HTML;
+                }
+            ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_1_Code(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_Code\n"));
+   yy = mk_str_slice(ctx->arena, yytext, yyleng); yy->key = CODE; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_1_Definition(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_Definition\n"));
+   yy = NULL; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_2_Definitions(yycontext *ctx, char *yytext, int yyleng)
+{
+#define b ctx->val[-1]
+#define n ctx->val[-2]
+#define a ctx->val[-3]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_Definitions\n"));
+   ctx->references = reverse(a); ctx->notes = reverse(n); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef b
+#undef n
+#undef a
+}
+YY_ACTION(void) yy_1_Definitions(yycontext *ctx, char *yytext, int yyleng)
+{
+#define b ctx->val[-1]
+#define n ctx->val[-2]
+#define a ctx->val[-3]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_Definitions\n"));
+     if (b != NULL && b->key == REFERENCE)
+                        a = cons(b, a);
+                    else if (b != NULL)
+                        n = cons(b, n);
+                ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef b
+#undef n
+#undef a
+}
+YY_ACTION(void) yy_1_RefTitle(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_RefTitle\n"));
+   yy = mk_str_slice(ctx->arena, yytext, yyleng); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_1_RefSrc(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_RefSrc\n"));
+   yy = mk_str_slice(ctx->arena, yytext, yyleng); 
+           yy->key = HTML; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_2_Label(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_Label\n"));
+   yy = mk_list(ctx->arena, LIST, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_1_Label(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_Label\n"));
+   a = cons(yy, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_1_Reference(yycontext *ctx, char *yytext, int yyleng)
+{
+#define t ctx->val[-1]
+#define s ctx->val[-2]
+#define l ctx->val[-3]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_Reference\n"));
+   yy = mk_link(ctx->arena, l->children, arena_strndup(ctx->arena, s->contents.str, s->len),
+                           arena_strndup(ctx->arena, t->contents.str, t->len));
+              yy->key = REFERENCE; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef t
+#undef s
+#undef l
+}
+YY_ACTION(void) yy_1_AutoLinkEmail(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_AutoLinkEmail\n"));
+     char *mailto = arena_alloc(ctx->arena, yyleng + 8);
+                    sprintf(mailto, "mailto:%.*s", yyleng, yytext);
+                    yy = mk_link(ctx->arena, mk_str_slice(ctx->arena, yytext, yyleng), mailto, "");
+                ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_1_AutoLinkUrl(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_AutoLinkUrl\n"));
+     yy = mk_link(ctx->arena, mk_str_slice(ctx->arena, yytext, yyleng),
+                                 arena_strndup(ctx->arena, yytext, yyleng), ""); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_1_Title(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_Title\n"));
+   yy = mk_str_slice(ctx->arena, yytext, yyleng); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_1_Source(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_Source\n"));
+   yy = mk_str_slice(ctx->arena, yytext, yyleng); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_1_ExplicitLink(yycontext *ctx, char *yytext, int yyleng)
+{
+#define t ctx->val[-1]
+#define s ctx->val[-2]
+#define l ctx->val[-3]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_ExplicitLink\n"));
+   yy = mk_link(ctx->arena, l->children, arena_strndup(ctx->arena, s->contents.str, s->len),
+                               arena_strndup(ctx->arena, t->contents.str, t->len)); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef t
+#undef s
+#undef l
+}
+YY_ACTION(void) yy_1_ReferenceLinkSingle(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_ReferenceLinkSingle\n"));
+     link match;
+                           if (!extension(EXT_DEFER_REFERENCES) && find_reference(&match, a->children, ctx->reference_index)) {
+                               yy = mk_link(ctx->arena, a->children, match.url, match.title);
+                           }
+                           else {
+                               element *result;
+                               result = mk_element(ctx->arena, LIST);
+                               result->children = cons(mk_str(ctx->arena, "["), cons(a, cons(mk_str(ctx->arena, "]"), mk_str_slice(ctx->arena, yytext, yyleng))));
+                               yy = result;
+                               if (extension(EXT_DEFER_REFERENCES))
+                                   yy = defer_link(ctx, a->children, a->children, result);
+                           }
+                       ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_1_ReferenceLinkDouble(yycontext *ctx, char *yytext, int yyleng)
+{
+#define b ctx->val[-1]
+#define a ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_ReferenceLinkDouble\n"));
+     link match;
+                           if (!extension(EXT_DEFER_REFERENCES) && find_reference(&match, b->children, ctx->reference_index)) {
+                               yy = mk_link(ctx->arena, a->children, match.url, match.title);
+                           } else {
+                               element *result;
+                               result = mk_element(ctx->arena, LIST);
+                               result->children = cons(mk_str(ctx->arena, "["), cons(a, cons(mk_str(ctx->arena, "]"), cons(mk_str_slice(ctx->arena, yytext, yyleng),
+                                                   cons(mk_str(ctx->arena, "["), cons(b, mk_str(ctx->arena, "]")))))));
+                               yy = result;
+                               if (extension(EXT_DEFER_REFERENCES))
+                                   yy = defer_link(ctx, a->children, b->children, result);
+                           }
+                       ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_Image(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_Image\n"));
+   if (yy->key == LINK) {
+              yy->key = IMAGE;
+          } else {
+              element *result;
+              result = yy;
+              yy->children = cons(mk_str(ctx->arena, "!"), result->children);
+          } ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_2_StrikeTail(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define b ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_StrikeTail\n"));
+   yy = NULL; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+#undef b
+}
+YY_ACTION(void) yy_1_StrikeTail(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define b ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_StrikeTail\n"));
+   yy = cons(b, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+#undef b
+}
+YY_ACTION(void) yy_1_Strike(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define b ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_Strike\n"));
+   yy = mk_element(ctx->arena, STRIKE);
+           yy->children = cons(b, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+#undef b
+}
+YY_ACTION(void) yy_2_StrongUlTail(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define b ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_StrongUlTail\n"));
+   yy = NULL; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+#undef b
+}
+YY_ACTION(void) yy_1_StrongUlTail(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define b ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_StrongUlTail\n"));
+   yy = cons(b, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+#undef b
+}
+YY_ACTION(void) yy_1_StrongUl(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define b ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_StrongUl\n"));
+   yy = mk_element(ctx->arena, STRONG);
+                  yy->children = cons(b, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+#undef b
+}
+YY_ACTION(void) yy_2_StrongStarTail(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define b ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_StrongStarTail\n"));
+   yy = NULL; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+#undef b
+}
+YY_ACTION(void) yy_1_StrongStarTail(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define b ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_StrongStarTail\n"));
+   yy = cons(b, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+#undef b
+}
+YY_ACTION(void) yy_1_StrongStar(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define b ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_StrongStar\n"));
+   yy = mk_element(ctx->arena, STRONG);
+                  yy->children = cons(b, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+#undef b
+}
+YY_ACTION(void) yy_3_EmphUlTail(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define b ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_3_EmphUlTail\n"));
+   yy = NULL; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+#undef b
+}
+YY_ACTION(void) yy_2_EmphUlTail(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define b ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_EmphUlTail\n"));
+   yy = cons(b, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+#undef b
+}
+YY_ACTION(void) yy_1_EmphUlTail(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define b ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_EmphUlTail\n"));
+   yy = cons(b, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+#undef b
+}
+YY_ACTION(void) yy_1_EmphUl(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define b ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_EmphUl\n"));
+   yy = mk_element(ctx->arena, EMPH);
+              yy->children = cons(b, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+#undef b
+}
+YY_ACTION(void) yy_3_EmphStarTail(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define b ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_3_EmphStarTail\n"));
+   yy = NULL; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+#undef b
+}
+YY_ACTION(void) yy_2_EmphStarTail(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define b ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_EmphStarTail\n"));
+   yy = cons(b, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+#undef b
+}
+YY_ACTION(void) yy_1_EmphStarTail(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define b ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_EmphStarTail\n"));
+   yy = cons(b, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+#undef b
+}
+YY_ACTION(void) yy_1_EmphStar(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define b ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_EmphStar\n"));
+   yy = mk_element(ctx->arena, EMPH);
+              yy->children = cons(b, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+#undef b
+}
+YY_ACTION(void) yy_1_UlOrStarLine(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_UlOrStarLine\n"));
+   yy = mk_str_slice(ctx->arena, yytext, yyleng); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_1_Symbol(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_Symbol\n"));
+   yy = mk_str_slice(ctx->arena, yytext, yyleng); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_1_LineBreak(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_LineBreak\n"));
+   yy = mk_element(ctx->arena, LINEBREAK); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_1_TerminalEndline(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_TerminalEndline\n"));
+   yy = NULL; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_1_NormalEndline(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_NormalEndline\n"));
+   yy = mk_str(ctx->arena, "\n");
+                    yy->key = SPACE; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_1_Entity(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_Entity\n"));
+   yy = mk_str_slice(ctx->arena, yytext, yyleng); yy->key = HTML; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_1_EscapedChar(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_EscapedChar\n"));
+   yy = mk_str_slice(ctx->arena, yytext, yyleng); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_1_AposChunk(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_AposChunk\n"));
+   yy = mk_element(ctx->arena, APOSTROPHE); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_1_StrChunk(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_StrChunk\n"));
+   yy = mk_str_slice(ctx->arena, yytext, yyleng); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_3_Str(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_3_Str\n"));
+   if (a->next == NULL) { yy = a; } else { yy = mk_list(ctx->arena, LIST, a); } ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_2_Str(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_Str\n"));
+   a = smart_str(ctx, yy, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_1_Str(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_Str\n"));
+   a = smart_str(ctx, mk_str_slice(ctx->arena, yytext, yyleng), a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_1_Space(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_Space\n"));
+   yy = mk_str(ctx->arena, " ");
+          yy->key = SPACE; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_3_Inlines(yycontext *ctx, char *yytext, int yyleng)
+{
+#define c ctx->val[-1]
+#define a ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_3_Inlines\n"));
+   yy = mk_list(ctx->arena, LIST, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef c
+#undef a
+}
+YY_ACTION(void) yy_2_Inlines(yycontext *ctx, char *yytext, int yyleng)
+{
+#define c ctx->val[-1]
+#define a ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_Inlines\n"));
+   a = cons(c, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef c
+#undef a
+}
+YY_ACTION(void) yy_1_Inlines(yycontext *ctx, char *yytext, int yyleng)
+{
+#define c ctx->val[-1]
+#define a ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_Inlines\n"));
+   a = cons(yy, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef c
+#undef a
+}
+YY_ACTION(void) yy_1_StyleBlock(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_StyleBlock\n"));
+     if (extension(EXT_FILTER_STYLES)) {
+                        yy = mk_list(ctx->arena, LIST, NULL);
+                    } else {
+                        yy = mk_str_slice(ctx->arena, yytext, yyleng);
+                        yy->key = HTMLBLOCK;
+                    }
+                ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_1_HtmlBlock(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_HtmlBlock\n"));
+     if (extension(EXT_FILTER_HTML)) {
+                    yy = mk_list(ctx->arena, LIST, NULL);
+                } else {
+                    yy = mk_str_slice(ctx->arena, yytext, yyleng);
+                    yy->key = HTMLBLOCK;
+                }
+            ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_1_OrderedList(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_OrderedList\n"));
+   yy->key = ORDEREDLIST; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_3_ListContinuationBlock(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_3_ListContinuationBlock\n"));
+    yy = mk_str_from_list(ctx->arena, a, false); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_2_ListContinuationBlock(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_ListContinuationBlock\n"));
+   a = cons(yy, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_1_ListContinuationBlock(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_ListContinuationBlock\n"));
+     if (yyleng == 0) {
+                                   a = cons(mk_str(ctx->arena, "\001"), a); /* block separator */
+                              } else {
+                                   a = cons(mk_str_slice(ctx->arena, yytext, yyleng), a);
+                                   ctx->loose_list = true;
+                              } ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_3_ListBlock(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_3_ListBlock\n"));
+   yy = mk_str_from_list(ctx->arena, a, false); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_2_ListBlock(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_ListBlock\n"));
+   a = cons(yy, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_1_ListBlock(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_ListBlock\n"));
+   a = cons(yy, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_3_ListItem(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_3_ListItem\n"));
+    yy = mk_element(ctx->arena, LISTITEM);
+               yy->children = a;
+            ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_2_ListItem(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_ListItem\n"));
+   a = cons(yy, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_1_ListItem(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_ListItem\n"));
+   a = cons(yy, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_6_List(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_6_List\n"));
+     element *li;
+                for (li = a; li != NULL; li = li->next) {
+                    if (ctx->loose_list)   /* In loose list, \n\n added to end of each element */
+                        li->children = cons(mk_str(ctx->arena, "\n\n"), li->children);
+                    li->children = mk_str_from_list(ctx->arena, li->children, false);
+                    li->children->key = RAW;
+                }
+                yy = mk_list(ctx->arena, LIST, a);
+            ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_5_List(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_5_List\n"));
+   ctx->loose_list = true; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_4_List(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_4_List\n"));
+   a = cons(yy, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_3_List(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_3_List\n"));
+   ctx->loose_list = true; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_2_List(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_List\n"));
+   a = cons(yy, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_1_List(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_List\n"));
+   ctx->loose_list = false; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_1_BulletList(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_BulletList\n"));
+   yy->key = BULLETLIST; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_1_HorizontalRule(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_HorizontalRule\n"));
+   yy = mk_element(ctx->arena, HRULE); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_2_Verbatim(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_Verbatim\n"));
+   yy = mk_str_from_list(ctx->arena, a, false);
+                 yy->key = VERBATIM; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_1_Verbatim(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_Verbatim\n"));
+   a = cons(yy, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_3_VerbatimChunk(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_3_VerbatimChunk\n"));
+   yy = mk_str_from_list(ctx->arena, a, false); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_2_VerbatimChunk(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_VerbatimChunk\n"));
+   a = cons(yy, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_1_VerbatimChunk(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_VerbatimChunk\n"));
+   a = cons(mk_str(ctx->arena, "\n"), a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_4_BlockQuoteRaw(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_4_BlockQuoteRaw\n"));
+     yy = mk_str_from_list(ctx->arena, a, true);
+                     yy->key = RAW;
+                 ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_3_BlockQuoteRaw(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_3_BlockQuoteRaw\n"));
+   a = cons(mk_str(ctx->arena, "\n"), a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_2_BlockQuoteRaw(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_BlockQuoteRaw\n"));
+   a = cons(yy, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_1_BlockQuoteRaw(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_BlockQuoteRaw\n"));
+   a = cons(yy, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_1_BlockQuote(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_BlockQuote\n"));
+    yy = mk_element(ctx->arena, BLOCKQUOTE);
+                yy->children = a;
+             ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_2_SetextHeading2(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_SetextHeading2\n"));
+   yy = mk_list(ctx->arena, H2, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_1_SetextHeading2(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_SetextHeading2\n"));
+   a = cons(yy, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_2_SetextHeading1(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_SetextHeading1\n"));
+   yy = mk_list(ctx->arena, H1, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_1_SetextHeading1(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_SetextHeading1\n"));
+   a = cons(yy, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_2_AtxHeading(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define s ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_AtxHeading\n"));
+   yy = mk_list(ctx->arena, s->key, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+#undef s
+}
+YY_ACTION(void) yy_1_AtxHeading(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define s ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_AtxHeading\n"));
+   a = cons(yy, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+#undef s
+}
+YY_ACTION(void) yy_1_AtxStart(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_AtxStart\n"));
+   yy = mk_element(ctx->arena, H1 + (yyleng - 1)); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_1_Plain(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_Plain\n"));
+   yy = a; yy->key = PLAIN; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_3_Para(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_3_Para\n"));
+   yy = a; yy->key = PARA; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_2_Para(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_Para\n"));
+   yy = a; yy->key = PLAIN; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_1_Para(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_Para\n"));
+   yy = a; yy->key = PARA; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_2_Blocks(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_Blocks\n"));
+   ctx->parse_result = reverse(a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+YY_ACTION(void) yy_1_Blocks(yycontext *ctx, char *yytext, int yyleng)
+{
+#define a ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_Blocks\n"));
+   a = cons(yy, a); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef a
+}
+
+static const char *yymemonames[]= {
+  "Inline",
+  "Label",
+  "Endline",
+  "SourceContents",
+  "EmphStarTail",
+  "EmphUlTail",
+  "StrongStarTail",
+  "StrongUlTail",
+  "StrikeTail",
+};
+
+YY_RULE(int) yy_RawNoteBlock(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "RawNoteBlock"));  if (!yy_StartList(ctx)) goto l1;  yyDo(ctx, yySet, -1, 0);
+  {  int yypos4= ctx->pos, yythunkpos4= ctx->thunkpos;  if (!yy_BlankLine(ctx)) goto l4;  goto l1;
+  l4:;	  ctx->pos= yypos4; ctx->thunkpos= yythunkpos4;
+  }  if (!yy_OptionallyIndentedLine(ctx)) goto l1;  yyDo(ctx, yy_1_RawNoteBlock, ctx->begin, ctx->end);
+  l2:;	
+  {  int yypos3= ctx->pos, yythunkpos3= ctx->thunkpos;
+  {  int yypos5= ctx->pos, yythunkpos5= ctx->thunkpos;  if (!yy_BlankLine(ctx)) goto l5;  goto l3;
+  l5:;	  ctx->pos= yypos5; ctx->thunkpos= yythunkpos5;
+  }  if (!yy_OptionallyIndentedLine(ctx)) goto l3;  yyDo(ctx, yy_1_RawNoteBlock, ctx->begin, ctx->end);  goto l2;
+  l3:;	  ctx->pos= yypos3; ctx->thunkpos= yythunkpos3;
+  }  if (!(YY_BEGIN)) goto l1;  ctx->marked |= 1;
+  l6:;	
+  {  int yypos7= ctx->pos, yythunkpos7= ctx->thunkpos;  if (!yy_BlankLine(ctx)) goto l7;  goto l6;
+  l7:;	  ctx->pos= yypos7; ctx->thunkpos= yythunkpos7;
+  }  if (!(YY_END)) goto l1;  ctx->marked |= 2;  yyDo(ctx, yy_2_RawNoteBlock, ctx->begin, ctx->end);  yyDo(ctx, yy_3_RawNoteBlock, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "RawNoteBlock", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 1, 0);
+  return 1;
+  l1:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RawNoteBlock", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_RawNoteReference(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "RawNoteReference"));  if (!yymatchString(ctx, "[^")) goto l8;  if (!( note_label_closes(ctx) )) goto l8;  if (!(YY_BEGIN)) goto l8;  ctx->marked |= 1;
+  {  int yypos11= ctx->pos, yythunkpos11= ctx->thunkpos;  if (!yy_Newline(ctx)) goto l11;  goto l8;
+  l11:;	  ctx->pos= yypos11; ctx->thunkpos= yythunkpos11;
+  }
+  {  int yypos12= ctx->pos, yythunkpos12= ctx->thunkpos;  if (!yymatchChar(ctx, ']')) goto l12;  goto l8;
+  l12:;	  ctx->pos= yypos12; ctx->thunkpos= yythunkpos12;
+  }  if (!yymatchDot(ctx)) goto l8;
+  l9:;	
+  {  int yypos10= ctx->pos, yythunkpos10= ctx->thunkpos;
+  {  int yypos13= ctx->pos, yythunkpos13= ctx->thunkpos;  if (!yy_Newline(ctx)) goto l13;  goto l10;
+  l13:;	  ctx->pos= yypos13; ctx->thunkpos= yythunkpos13;
+  }
+  {  int yypos14= ctx->pos, yythunkpos14= ctx->thunkpos;  if (!yymatchChar(ctx, ']')) goto l14;  goto l10;
+  l14:;	  ctx->pos= yypos14; ctx->thunkpos= yythunkpos14;
+  }  if (!yymatchDot(ctx)) goto l10;  goto l9;
+  l10:;	  ctx->pos= yypos10; ctx->thunkpos= yythunkpos10;
+  }  if (!(YY_END)) goto l8;  ctx->marked |= 2;  if (!yymatchChar(ctx, ']')) goto l8;  yyDo(ctx, yy_1_RawNoteReference, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "RawNoteReference", ctx->buf+ctx->pos));
+  return 1;
+  l8:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RawNoteReference", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_DoubleQuoteEnd(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "DoubleQuoteEnd"));  if (!yymatchChar(ctx, '"')) goto l15;
+  yyprintf((stderr, "  ok   %s @ %s\n", "DoubleQuoteEnd", ctx->buf+ctx->pos));
+  return 1;
+  l15:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DoubleQuoteEnd", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_DoubleQuoteStart(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "DoubleQuoteStart"));  if (!yymatchChar(ctx, '"')) goto l16;
+  yyprintf((stderr, "  ok   %s @ %s\n", "DoubleQuoteStart", ctx->buf+ctx->pos));
+  return 1;
+  l16:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DoubleQuoteStart", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_SingleQuoteEnd(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "SingleQuoteEnd"));  if (!yymatchChar(ctx, '\'')) goto l17;
+  {  int yypos18= ctx->pos, yythunkpos18= ctx->thunkpos;  if (!yy_Alphanumeric(ctx)) goto l18;  goto l17;
+  l18:;	  ctx->pos= yypos18; ctx->thunkpos= yythunkpos18;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "SingleQuoteEnd", ctx->buf+ctx->pos));
+  return 1;
+  l17:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SingleQuoteEnd", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_SingleQuoteStart(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "SingleQuoteStart"));  if (!yymatchChar(ctx, '\'')) goto l19;
+  {  int yypos20= ctx->pos, yythunkpos20= ctx->thunkpos;
+  {  int yypos23= ctx->pos, yythunkpos23= ctx->thunkpos;  int yyc24= yypeek(ctx);
+  switch (yyc24)
+    {
+     case 9: case 32:  goto l21;
+     case 10: case 13:  goto l22;
+    default:  goto l20;
+    }
+  l21:;	  if (!yy_Spacechar(ctx)) goto l25;  goto l23;
+  l25:;	  ctx->pos= yypos23; ctx->thunkpos= yythunkpos23;
+  l22:;	  if (!yyfirst(yyc24, (unsigned char *)"\000\044\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l20;  if (!yy_Newline(ctx)) goto l20;
+  }
+  l23:;	  goto l19;
+  l20:;	  ctx->pos= yypos20; ctx->thunkpos= yythunkpos20;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "SingleQuoteStart", ctx->buf+ctx->pos));
+  return 1;
+  l19:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SingleQuoteStart", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Apostrophe(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "Apostrophe"));  if (!yymatchChar(ctx, '\'')) goto l26;  yyDo(ctx, yy_1_Apostrophe, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Apostrophe", ctx->buf+ctx->pos));
+  return 1;
+  l26:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Apostrophe", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_DoubleQuoted(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "DoubleQuoted"));  if (!( nested_inlines() )) goto l27;  if (!yy_DoubleQuoteStart(ctx)) goto l27;  if (!yy_StartList(ctx)) goto l27;  yyDo(ctx, yySet, -2, 0);
+  {  int yypos30= ctx->pos, yythunkpos30= ctx->thunkpos;  if (!yy_DoubleQuoteEnd(ctx)) goto l30;  goto l27;
+  l30:;	  ctx->pos= yypos30; ctx->thunkpos= yythunkpos30;
+  }  if (!yy_Inline(ctx)) goto l27;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_1_DoubleQuoted, ctx->begin, ctx->end);
+  l28:;	
+  {  int yypos29= ctx->pos, yythunkpos29= ctx->thunkpos;
+  {  int yypos31= ctx->pos, yythunkpos31= ctx->thunkpos;  if (!yy_DoubleQuoteEnd(ctx)) goto l31;  goto l29;
+  l31:;	  ctx->pos= yypos31; ctx->thunkpos= yythunkpos31;
+  }  if (!yy_Inline(ctx)) goto l29;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_1_DoubleQuoted, ctx->begin, ctx->end);  goto l28;
+  l29:;	  ctx->pos= yypos29; ctx->thunkpos= yythunkpos29;
+  }  if (!yy_DoubleQuoteEnd(ctx)) goto l27;  yyDo(ctx, yy_2_DoubleQuoted, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "DoubleQuoted", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 2, 0);
+  return 1;
+  l27:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DoubleQuoted", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_SingleQuoted(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "SingleQuoted"));  if (!( nested_inlines() )) goto l32;  if (!yy_SingleQuoteStart(ctx)) goto l32;  if (!yy_StartList(ctx)) goto l32;  yyDo(ctx, yySet, -2, 0);
+  {  int yypos35= ctx->pos, yythunkpos35= ctx->thunkpos;  if (!yy_SingleQuoteEnd(ctx)) goto l35;  goto l32;
+  l35:;	  ctx->pos= yypos35; ctx->thunkpos= yythunkpos35;
+  }  if (!yy_Inline(ctx)) goto l32;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_1_SingleQuoted, ctx->begin, ctx->end);
+  l33:;	
+  {  int yypos34= ctx->pos, yythunkpos34= ctx->thunkpos;
+  {  int yypos36= ctx->pos, yythunkpos36= ctx->thunkpos;  if (!yy_SingleQuoteEnd(ctx)) goto l36;  goto l34;
+  l36:;	  ctx->pos= yypos36; ctx->thunkpos= yythunkpos36;
+  }  if (!yy_Inline(ctx)) goto l34;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_1_SingleQuoted, ctx->begin, ctx->end);  goto l33;
+  l34:;	  ctx->pos= yypos34; ctx->thunkpos= yythunkpos34;
+  }  if (!yy_SingleQuoteEnd(ctx)) goto l32;  yyDo(ctx, yy_2_SingleQuoted, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "SingleQuoted", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 2, 0);
+  return 1;
+  l32:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SingleQuoted", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Ellipsis(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "Ellipsis"));  if (!yymatchString(ctx, ". . .")) goto l37;  yyDo(ctx, yy_1_Ellipsis, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Ellipsis", ctx->buf+ctx->pos));
+  return 1;
+  l37:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Ellipsis", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_RawLine(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "RawLine"));
+  {  int yypos41= ctx->pos, yythunkpos41= ctx->thunkpos;  if (!(YY_BEGIN)) goto l42;  ctx->marked |= 1;
+  {  int yypos43= ctx->pos, yythunkpos43= ctx->thunkpos;  if (!yymatchDot(ctx)) goto l42;  ctx->pos= yypos43; ctx->thunkpos= yythunkpos43;
+  }  if (!( line_end(ctx) )) goto l42;  if (!yy_Newline(ctx)) goto l42;  if (!(YY_END)) goto l42;  ctx->marked |= 2;  goto l41;
+  l42:;	  ctx->pos= yypos41; ctx->thunkpos= yythunkpos41;  if (!(YY_BEGIN)) goto l38;  ctx->marked |= 1;  if (!yymatchDot(ctx)) goto l38;
+  l44:;	
+  {  int yypos45= ctx->pos, yythunkpos45= ctx->thunkpos;  if (!yymatchDot(ctx)) goto l45;  goto l44;
+  l45:;	  ctx->pos= yypos45; ctx->thunkpos= yythunkpos45;
+  }  if (!(YY_END)) goto l38;  ctx->marked |= 2;  if (!yy_Eof(ctx)) goto l38;
+  }
+  l41:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "RawLine", ctx->buf+ctx->pos));
+  return 1;
+  l38:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RawLine", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_ExtendedSpecialChar(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "ExtendedSpecialChar"));
+  {  int yypos49= ctx->pos, yythunkpos49= ctx->thunkpos;  if (!( extension(EXT_SMART) )) goto l50;  if (!yymatchChar(ctx, '.')) goto l50;  goto l49;
+  l50:;	  ctx->pos= yypos49; ctx->thunkpos= yythunkpos49;  if (!( extension(EXT_NOTES) )) goto l46;  if (!yymatchChar(ctx, '^')) goto l46;
+  }
+  l49:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "ExtendedSpecialChar", ctx->buf+ctx->pos));
+  return 1;
+  l46:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ExtendedSpecialChar", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_AlphanumericAscii(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "AlphanumericAscii"));  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l51;
+  yyprintf((stderr, "  ok   %s @ %s\n", "AlphanumericAscii", ctx->buf+ctx->pos));
+  return 1;
+  l51:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AlphanumericAscii", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Quoted(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "Quoted"));
+  {  int yypos55= ctx->pos, yythunkpos55= ctx->thunkpos;  int yyc56= yypeek(ctx);
+  switch (yyc56)
+    {
+     case 34:  goto l53;
+     case 39:  goto l54;
+    default:  goto l52;
+    }
+  l53:;	  if (!yymatchChar(ctx, '"')) goto l57;
+  l58:;	
+  {  int yypos59= ctx->pos, yythunkpos59= ctx->thunkpos;
+  {  int yypos60= ctx->pos, yythunkpos60= ctx->thunkpos;  if (!yymatchChar(ctx, '"')) goto l60;  goto l59;
+  l60:;	  ctx->pos= yypos60; ctx->thunkpos= yythunkpos60;
+  }  if (!yymatchDot(ctx)) goto l59;  goto l58;
+  l59:;	  ctx->pos= yypos59; ctx->thunkpos= yythunkpos59;
+  }  if (!yymatchChar(ctx, '"')) goto l57;  goto l55;
+  l57:;	  ctx->pos= yypos55; ctx->thunkpos= yythunkpos55;
+  l54:;	  if (!yyfirst(yyc56, (unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l52;  if (!yymatchChar(ctx, '\'')) goto l52;
+  l61:;	
+  {  int yypos62= ctx->pos, yythunkpos62= ctx->thunkpos;
+  {  int yypos63= ctx->pos, yythunkpos63= ctx->thunkpos;  if (!yymatchChar(ctx, '\'')) goto l63;  goto l62;
+  l63:;	  ctx->pos= yypos63; ctx->thunkpos= yythunkpos63;
+  }  if (!yymatchDot(ctx)) goto l62;  goto l61;
+  l62:;	  ctx->pos= yypos62; ctx->thunkpos= yythunkpos62;
+  }  if (!yymatchChar(ctx, '\'')) goto l52;
+  }
+  l55:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Quoted", ctx->buf+ctx->pos));
+  return 1;
+  l52:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Quoted", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_HtmlTag(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlTag"));  if (!yymatchChar(ctx, '<')) goto l64;  if (!yy_Spnl(ctx)) goto l64;
+  {  int yypos65= ctx->pos, yythunkpos65= ctx->thunkpos;  if (!yymatchChar(ctx, '/')) goto l65;  goto l66;
+  l65:;	  ctx->pos= yypos65; ctx->thunkpos= yythunkpos65;
+  }
+  l66:;	  if (!yy_AlphanumericAscii(ctx)) goto l64;
+  l67:;	
+  {  int yypos68= ctx->pos, yythunkpos68= ctx->thunkpos;  if (!yy_AlphanumericAscii(ctx)) goto l68;  goto l67;
+  l68:;	  ctx->pos= yypos68; ctx->thunkpos= yythunkpos68;
+  }  if (!yy_Spnl(ctx)) goto l64;
+  l69:;	
+  {  int yypos70= ctx->pos, yythunkpos70= ctx->thunkpos;  if (!yy_HtmlAttribute(ctx)) goto l70;  goto l69;
+  l70:;	  ctx->pos= yypos70; ctx->thunkpos= yythunkpos70;
+  }
+  {  int yypos71= ctx->pos, yythunkpos71= ctx->thunkpos;  if (!yymatchChar(ctx, '/')) goto l71;  goto l72;
+  l71:;	  ctx->pos= yypos71; ctx->thunkpos= yythunkpos71;
+  }
+  l72:;	  if (!yy_Spnl(ctx)) goto l64;  if (!yymatchChar(ctx, '>')) goto l64;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlTag", ctx->buf+ctx->pos));
+  return 1;
+  l64:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlTag", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_SkipBlock(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "SkipBlock"));
+  {  int yypos78= ctx->pos, yythunkpos78= ctx->thunkpos;  int yyc79= yypeek(ctx);
+  switch (yyc79)
+    {
+     case 60:  goto l74;
+    default:  goto l75;
+    }
+  l74:;	  if (!yy_HtmlBlock(ctx)) goto l80;  goto l78;
+  l80:;	  ctx->pos= yypos78; ctx->thunkpos= yythunkpos78;
+  l75:;	
+  {  int yypos84= ctx->pos, yythunkpos84= ctx->thunkpos;  if (!yymatchChar(ctx, '#')) goto l84;  goto l81;
+  l84:;	  ctx->pos= yypos84; ctx->thunkpos= yythunkpos84;
+  }
+  {  int yypos85= ctx->pos, yythunkpos85= ctx->thunkpos;  if (!yy_SetextBottom1(ctx)) goto l85;  goto l81;
+  l85:;	  ctx->pos= yypos85; ctx->thunkpos= yythunkpos85;
+  }
+  {  int yypos86= ctx->pos, yythunkpos86= ctx->thunkpos;  if (!yy_SetextBottom2(ctx)) goto l86;  goto l81;
+  l86:;	  ctx->pos= yypos86; ctx->thunkpos= yythunkpos86;
+  }
+  {  int yypos87= ctx->pos, yythunkpos87= ctx->thunkpos;  if (!yy_BlankLine(ctx)) goto l87;  goto l81;
+  l87:;	  ctx->pos= yypos87; ctx->thunkpos= yythunkpos87;
+  }  if (!yy_RawLine(ctx)) goto l81;
+  l82:;	
+  {  int yypos83= ctx->pos, yythunkpos83= ctx->thunkpos;
+  {  int yypos88= ctx->pos, yythunkpos88= ctx->thunkpos;  if (!yymatchChar(ctx, '#')) goto l88;  goto l83;
+  l88:;	  ctx->pos= yypos88; ctx->thunkpos= yythunkpos88;
+  }
+  {  int yypos89= ctx->pos, yythunkpos89= ctx->thunkpos;  if (!yy_SetextBottom1(ctx)) goto l89;  goto l83;
+  l89:;	  ctx->pos= yypos89; ctx->thunkpos= yythunkpos89;
+  }
+  {  int yypos90= ctx->pos, yythunkpos90= ctx->thunkpos;  if (!yy_SetextBottom2(ctx)) goto l90;  goto l83;
+  l90:;	  ctx->pos= yypos90; ctx->thunkpos= yythunkpos90;
+  }
+  {  int yypos91= ctx->pos, yythunkpos91= ctx->thunkpos;  if (!yy_BlankLine(ctx)) goto l91;  goto l83;
+  l91:;	  ctx->pos= yypos91; ctx->thunkpos= yythunkpos91;
+  }  if (!yy_RawLine(ctx)) goto l83;  goto l82;
+  l83:;	  ctx->pos= yypos83; ctx->thunkpos= yythunkpos83;
+  }
+  l92:;	
+  {  int yypos93= ctx->pos, yythunkpos93= ctx->thunkpos;  if (!yy_BlankLine(ctx)) goto l93;  goto l92;
+  l93:;	  ctx->pos= yypos93; ctx->thunkpos= yythunkpos93;
+  }  goto l78;
+  l81:;	  ctx->pos= yypos78; ctx->thunkpos= yythunkpos78;  if (!yyfirst(yyc79, (unsigned char *)"\000\046\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l77;  if (!yy_BlankLine(ctx)) goto l94;
+  l95:;	
+  {  int yypos96= ctx->pos, yythunkpos96= ctx->thunkpos;  if (!yy_BlankLine(ctx)) goto l96;  goto l95;
+  l96:;	  ctx->pos= yypos96; ctx->thunkpos= yythunkpos96;
+  }  goto l78;
+  l94:;	  ctx->pos= yypos78; ctx->thunkpos= yythunkpos78;
+  l77:;	  if (!yy_RawLine(ctx)) goto l73;
+  }
+  l78:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "SkipBlock", ctx->buf+ctx->pos));
+  return 1;
+  l73:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SkipBlock", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Definition(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "Definition"));
+  {  int yypos101= ctx->pos, yythunkpos101= ctx->thunkpos;  int yyc102= yypeek(ctx);
+  switch (yyc102)
+    {
+     case 32: case 91:  goto l98;
+    default:  goto l99;
+    }
+  l98:;	  if (!yy_Reference(ctx)) goto l103;  goto l101;
+  l103:;	  ctx->pos= yypos101; ctx->thunkpos= yythunkpos101;
+  l99:;	  if (!yy_Note(ctx)) goto l104;  goto l101;
+  l104:;	  ctx->pos= yypos101; ctx->thunkpos= yythunkpos101;  if (!yy_SkipBlock(ctx)) goto l97;  yyDo(ctx, yy_1_Definition, ctx->begin, ctx->end);
+  }
+  l101:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Definition", ctx->buf+ctx->pos));
+  return 1;
+  l97:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Definition", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_DefinitionTry(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "DefinitionTry"));
+  {  int yypos110= ctx->pos, yythunkpos110= ctx->thunkpos;  if (!yy_Definition(ctx)) goto l111;  if (!( !ctx->nomem )) goto l111;  goto l110;
+  l111:;	  ctx->pos= yypos110; ctx->thunkpos= yythunkpos110;  if (!( retry_block(ctx, yy_Definition) )) goto l112;  if (!yy_Definition(ctx)) goto l112;  if (!( !ctx->nomem )) goto l112;  goto l110;
+  l112:;	  ctx->pos= yypos110; ctx->thunkpos= yythunkpos110;  if (!( flatten_block(ctx, FLAT_EMPHASIS) )) goto l113;  if (!yy_Definition(ctx)) goto l113;  if (!( !ctx->nomem )) goto l113;  goto l110;
+  l113:;	  ctx->pos= yypos110; ctx->thunkpos= yythunkpos110;  if (!( flatten_block(ctx, FLAT_INLINES) )) goto l105;  if (!yy_Definition(ctx)) goto l105;  if (!( !ctx->nomem )) goto l105;
+  }
+  l110:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "DefinitionTry", ctx->buf+ctx->pos));
+  return 1;
+  l105:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DefinitionTry", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Definitions(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 3, 0);
+  yyprintf((stderr, "%s\n", "Definitions"));  if (!yy_StartList(ctx)) goto l114;  yyDo(ctx, yySet, -3, 0);  if (!yy_StartList(ctx)) goto l114;  yyDo(ctx, yySet, -2, 0);
+  l115:;	
+  {  int yypos116= ctx->pos, yythunkpos116= ctx->thunkpos;  if (!( note_boundary(ctx) )) goto l116;  if (!( begin_block(ctx) )) goto l116;  if (!yy_DefinitionTry(ctx)) goto l116;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_1_Definitions, ctx->begin, ctx->end);  goto l115;
+  l116:;	  ctx->pos= yypos116; ctx->thunkpos= yythunkpos116;
+  }  yyDo(ctx, yy_2_Definitions, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Definitions", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 3, 0);
+  return 1;
+  l114:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Definitions", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_EmptyTitle(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "EmptyTitle"));  if (!(YY_BEGIN)) goto l117;  ctx->marked |= 1;  if (!yymatchString(ctx, "")) goto l117;  if (!(YY_END)) goto l117;  ctx->marked |= 2;
+  yyprintf((stderr, "  ok   %s @ %s\n", "EmptyTitle", ctx->buf+ctx->pos));
+  return 1;
+  l117:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EmptyTitle", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_RefTitleParens(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "RefTitleParens"));  if (!yy_Spnl(ctx)) goto l118;  if (!yymatchChar(ctx, '(')) goto l118;  if (!(YY_BEGIN)) goto l118;  ctx->marked |= 1;
+  l119:;	
+  {  int yypos120= ctx->pos, yythunkpos120= ctx->thunkpos;
+  {  int yypos121= ctx->pos, yythunkpos121= ctx->thunkpos;
+  {  int yypos124= ctx->pos, yythunkpos124= ctx->thunkpos;  int yyc125= yypeek(ctx);
+  switch (yyc125)
+    {
+     case 41:  goto l122;
+     case 10: case 13:  goto l123;
+    default:  goto l121;
+    }
+  l122:;	  if (!yymatchChar(ctx, ')')) goto l126;  if (!yy_Sp(ctx)) goto l126;  if (!yy_Newline(ctx)) goto l126;  goto l124;
+  l126:;	  ctx->pos= yypos124; ctx->thunkpos= yythunkpos124;
+  l123:;	  if (!yyfirst(yyc125, (unsigned char *)"\000\044\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l121;  if (!yy_Newline(ctx)) goto l121;
+  }
+  l124:;	  goto l120;
+  l121:;	  ctx->pos= yypos121; ctx->thunkpos= yythunkpos121;
+  }  if (!yymatchDot(ctx)) goto l120;  goto l119;
+  l120:;	  ctx->pos= yypos120; ctx->thunkpos= yythunkpos120;
+  }  if (!(YY_END)) goto l118;  ctx->marked |= 2;  if (!yymatchChar(ctx, ')')) goto l118;
+  yyprintf((stderr, "  ok   %s @ %s\n", "RefTitleParens", ctx->buf+ctx->pos));
+  return 1;
+  l118:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RefTitleParens", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_RefTitleDouble(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "RefTitleDouble"));  if (!yy_Spnl(ctx)) goto l127;  if (!yymatchChar(ctx, '"')) goto l127;  if (!(YY_BEGIN)) goto l127;  ctx->marked |= 1;
+  l128:;	
+  {  int yypos129= ctx->pos, yythunkpos129= ctx->thunkpos;
+  {  int yypos130= ctx->pos, yythunkpos130= ctx->thunkpos;
+  {  int yypos133= ctx->pos, yythunkpos133= ctx->thunkpos;  int yyc134= yypeek(ctx);
+  switch (yyc134)
+    {
+     case 34:  goto l131;
+     case 10: case 13:  goto l132;
+    default:  goto l130;
+    }
+  l131:;	  if (!yymatchChar(ctx, '"')) goto l135;  if (!yy_Sp(ctx)) goto l135;  if (!yy_Newline(ctx)) goto l135;  goto l133;
+  l135:;	  ctx->pos= yypos133; ctx->thunkpos= yythunkpos133;
+  l132:;	  if (!yyfirst(yyc134, (unsigned char *)"\000\044\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l130;  if (!yy_Newline(ctx)) goto l130;
+  }
+  l133:;	  goto l129;
+  l130:;	  ctx->pos= yypos130; ctx->thunkpos= yythunkpos130;
+  }  if (!yymatchDot(ctx)) goto l129;  goto l128;
+  l129:;	  ctx->pos= yypos129; ctx->thunkpos= yythunkpos129;
+  }  if (!(YY_END)) goto l127;  ctx->marked |= 2;  if (!yymatchChar(ctx, '"')) goto l127;
+  yyprintf((stderr, "  ok   %s @ %s\n", "RefTitleDouble", ctx->buf+ctx->pos));
+  return 1;
+  l127:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RefTitleDouble", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_RefTitleSingle(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "RefTitleSingle"));  if (!yy_Spnl(ctx)) goto l136;  if (!yymatchChar(ctx, '\'')) goto l136;  if (!(YY_BEGIN)) goto l136;  ctx->marked |= 1;
+  l137:;	
+  {  int yypos138= ctx->pos, yythunkpos138= ctx->thunkpos;
+  {  int yypos139= ctx->pos, yythunkpos139= ctx->thunkpos;
+  {  int yypos142= ctx->pos, yythunkpos142= ctx->thunkpos;  int yyc143= yypeek(ctx);
+  switch (yyc143)
+    {
+     case 39:  goto l140;
+     case 10: case 13:  goto l141;
+    default:  goto l139;
+    }
+  l140:;	  if (!yymatchChar(ctx, '\'')) goto l144;  if (!yy_Sp(ctx)) goto l144;  if (!yy_Newline(ctx)) goto l144;  goto l142;
+  l144:;	  ctx->pos= yypos142; ctx->thunkpos= yythunkpos142;
+  l141:;	  if (!yyfirst(yyc143, (unsigned char *)"\000\044\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l139;  if (!yy_Newline(ctx)) goto l139;
+  }
+  l142:;	  goto l138;
+  l139:;	  ctx->pos= yypos139; ctx->thunkpos= yythunkpos139;
+  }  if (!yymatchDot(ctx)) goto l138;  goto l137;
+  l138:;	  ctx->pos= yypos138; ctx->thunkpos= yythunkpos138;
+  }  if (!(YY_END)) goto l136;  ctx->marked |= 2;  if (!yymatchChar(ctx, '\'')) goto l136;
+  yyprintf((stderr, "  ok   %s @ %s\n", "RefTitleSingle", ctx->buf+ctx->pos));
+  return 1;
+  l136:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RefTitleSingle", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_RefTitle(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "RefTitle"));
+  {  int yypos150= ctx->pos, yythunkpos150= ctx->thunkpos;  int yyc151= yypeek(ctx);
+  switch (yyc151)
+    {
+     case 9: case 10: case 13: case 32: case 39:  goto l146;
+     case 34:  goto l147;
+     case 40:  goto l148;
+    default:  goto l149;
+    }
+  l146:;	  if (!yy_RefTitleSingle(ctx)) goto l152;  goto l150;
+  l152:;	  ctx->pos= yypos150; ctx->thunkpos= yythunkpos150;
+  l147:;	  if (!yyfirst(yyc151, (unsigned char *)"\000\046\000\000\005\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l148;  if (!yy_RefTitleDouble(ctx)) goto l153;  goto l150;
+  l153:;	  ctx->pos= yypos150; ctx->thunkpos= yythunkpos150;
+  l148:;	  if (!yyfirst(yyc151, (unsigned char *)"\000\046\000\000\001\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l149;  if (!yy_RefTitleParens(ctx)) goto l154;  goto l150;
+  l154:;	  ctx->pos= yypos150; ctx->thunkpos= yythunkpos150;
+  l149:;	  if (!yy_EmptyTitle(ctx)) goto l145;
+  }
+  l150:;	  yyDo(ctx, yy_1_RefTitle, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "RefTitle", ctx->buf+ctx->pos));
+  return 1;
+  l145:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RefTitle", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_RefSrc(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "RefSrc"));  if (!(YY_BEGIN)) goto l155;  ctx->marked |= 1;  if (!yy_Nonspacechar(ctx)) goto l155;
+  l156:;	
+  {  int yypos157= ctx->pos, yythunkpos157= ctx->thunkpos;  if (!yy_Nonspacechar(ctx)) goto l157;  goto l156;
+  l157:;	  ctx->pos= yypos157; ctx->thunkpos= yythunkpos157;
+  }  if (!(YY_END)) goto l155;  ctx->marked |= 2;  yyDo(ctx, yy_1_RefSrc, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "RefSrc", ctx->buf+ctx->pos));
+  return 1;
+  l155:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RefSrc", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_AutoLinkEmail(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "AutoLinkEmail"));  if (!yymatchChar(ctx, '<')) goto l158;
+  {  int yypos159= ctx->pos, yythunkpos159= ctx->thunkpos;  if (!yymatchString(ctx, "mailto:")) goto l159;  goto l160;
+  l159:;	  ctx->pos= yypos159; ctx->thunkpos= yythunkpos159;
+  }
+  l160:;	  if (!(YY_BEGIN)) goto l158;  ctx->marked |= 1;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\062\350\377\003\376\377\377\207\376\377\377\107\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l158;
+  l161:;	
+  {  int yypos162= ctx->pos, yythunkpos162= ctx->thunkpos;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\062\350\377\003\376\377\377\207\376\377\377\107\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l162;  goto l161;
+  l162:;	  ctx->pos= yypos162; ctx->thunkpos= yythunkpos162;
+  }  if (!yymatchChar(ctx, '@')) goto l158;
+  {  int yypos165= ctx->pos, yythunkpos165= ctx->thunkpos;  if (!yy_Newline(ctx)) goto l165;  goto l158;
+  l165:;	  ctx->pos= yypos165; ctx->thunkpos= yythunkpos165;
+  }
+  {  int yypos166= ctx->pos, yythunkpos166= ctx->thunkpos;  if (!yymatchChar(ctx, '>')) goto l166;  goto l158;
+  l166:;	  ctx->pos= yypos166; ctx->thunkpos= yythunkpos166;
+  }  if (!yymatchDot(ctx)) goto l158;
+  l163:;	
+  {  int yypos164= ctx->pos, yythunkpos164= ctx->thunkpos;
+  {  int yypos167= ctx->pos, yythunkpos167= ctx->thunkpos;  if (!yy_Newline(ctx)) goto l167;  goto l164;
+  l167:;	  ctx->pos= yypos167; ctx->thunkpos= yythunkpos167;
+  }
+  {  int yypos168= ctx->pos, yythunkpos168= ctx->thunkpos;  if (!yymatchChar(ctx, '>')) goto l168;  goto l164;
+  l168:;	  ctx->pos= yypos168; ctx->thunkpos= yythunkpos168;
+  }  if (!yymatchDot(ctx)) goto l164;  goto l163;
+  l164:;	  ctx->pos= yypos164; ctx->thunkpos= yythunkpos164;
+  }  if (!(YY_END)) goto l158;  ctx->marked |= 2;  if (!yymatchChar(ctx, '>')) goto l158;  yyDo(ctx, yy_1_AutoLinkEmail, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "AutoLinkEmail", ctx->buf+ctx->pos));
+  return 1;
+  l158:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AutoLinkEmail", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_AutoLinkUrl(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "AutoLinkUrl"));  if (!yymatchChar(ctx, '<')) goto l169;  if (!(YY_BEGIN)) goto l169;  ctx->marked |= 1;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l169;
+  l170:;	
+  {  int yypos171= ctx->pos, yythunkpos171= ctx->thunkpos;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l171;  goto l170;
+  l171:;	  ctx->pos= yypos171; ctx->thunkpos= yythunkpos171;
+  }  if (!yymatchString(ctx, "://")) goto l169;
+  {  int yypos174= ctx->pos, yythunkpos174= ctx->thunkpos;  if (!yy_Newline(ctx)) goto l174;  goto l169;
+  l174:;	  ctx->pos= yypos174; ctx->thunkpos= yythunkpos174;
+  }
+  {  int yypos175= ctx->pos, yythunkpos175= ctx->thunkpos;  if (!yymatchChar(ctx, '>')) goto l175;  goto l169;
+  l175:;	  ctx->pos= yypos175; ctx->thunkpos= yythunkpos175;
+  }  if (!yymatchDot(ctx)) goto l169;
+  l172:;	
+  {  int yypos173= ctx->pos, yythunkpos173= ctx->thunkpos;
+  {  int yypos176= ctx->pos, yythunkpos176= ctx->thunkpos;  if (!yy_Newline(ctx)) goto l176;  goto l173;
+  l176:;	  ctx->pos= yypos176; ctx->thunkpos= yythunkpos176;
+  }
+  {  int yypos177= ctx->pos, yythunkpos177= ctx->thunkpos;  if (!yymatchChar(ctx, '>')) goto l177;  goto l173;
+  l177:;	  ctx->pos= yypos177; ctx->thunkpos= yythunkpos177;
+  }  if (!yymatchDot(ctx)) goto l173;  goto l172;
+  l173:;	  ctx->pos= yypos173; ctx->thunkpos= yythunkpos173;
+  }  if (!(YY_END)) goto l169;  ctx->marked |= 2;  if (!yymatchChar(ctx, '>')) goto l169;  yyDo(ctx, yy_1_AutoLinkUrl, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "AutoLinkUrl", ctx->buf+ctx->pos));
+  return 1;
+  l169:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AutoLinkUrl", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_TitleDouble(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "TitleDouble"));  if (!yymatchChar(ctx, '"')) goto l178;  if (!(YY_BEGIN)) goto l178;  ctx->marked |= 1;
+  l179:;	
+  {  int yypos180= ctx->pos, yythunkpos180= ctx->thunkpos;
+  {  int yypos181= ctx->pos, yythunkpos181= ctx->thunkpos;  if (!yymatchChar(ctx, '"')) goto l181;  if (!yy_Sp(ctx)) goto l181;
+  {  int yypos184= ctx->pos, yythunkpos184= ctx->thunkpos;  int yyc185= yypeek(ctx);
+  switch (yyc185)
+    {
+     case 41:  goto l182;
+     case 10: case 13:  goto l183;
+    default:  goto l181;
+    }
+  l182:;	  if (!yymatchChar(ctx, ')')) goto l186;  goto l184;
+  l186:;	  ctx->pos= yypos184; ctx->thunkpos= yythunkpos184;
+  l183:;	  if (!yyfirst(yyc185, (unsigned char *)"\000\044\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l181;  if (!yy_Newline(ctx)) goto l181;
+  }
+  l184:;	  goto l180;
+  l181:;	  ctx->pos= yypos181; ctx->thunkpos= yythunkpos181;
+  }  if (!yymatchDot(ctx)) goto l180;  goto l179;
+  l180:;	  ctx->pos= yypos180; ctx->thunkpos= yythunkpos180;
+  }  if (!(YY_END)) goto l178;  ctx->marked |= 2;  if (!yymatchChar(ctx, '"')) goto l178;
+  yyprintf((stderr, "  ok   %s @ %s\n", "TitleDouble", ctx->buf+ctx->pos));
+  return 1;
+  l178:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TitleDouble", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_TitleSingle(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "TitleSingle"));  if (!yymatchChar(ctx, '\'')) goto l187;  if (!(YY_BEGIN)) goto l187;  ctx->marked |= 1;
+  l188:;	
+  {  int yypos189= ctx->pos, yythunkpos189= ctx->thunkpos;
+  {  int yypos190= ctx->pos, yythunkpos190= ctx->thunkpos;  if (!yymatchChar(ctx, '\'')) goto l190;  if (!yy_Sp(ctx)) goto l190;
+  {  int yypos193= ctx->pos, yythunkpos193= ctx->thunkpos;  int yyc194= yypeek(ctx);
+  switch (yyc194)
+    {
+     case 41:  goto l191;
+     case 10: case 13:  goto l192;
+    default:  goto l190;
+    }
+  l191:;	  if (!yymatchChar(ctx, ')')) goto l195;  goto l193;
+  l195:;	  ctx->pos= yypos193; ctx->thunkpos= yythunkpos193;
+  l192:;	  if (!yyfirst(yyc194, (unsigned char *)"\000\044\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l190;  if (!yy_Newline(ctx)) goto l190;
+  }
+  l193:;	  goto l189;
+  l190:;	  ctx->pos= yypos190; ctx->thunkpos= yythunkpos190;
+  }  if (!yymatchDot(ctx)) goto l189;  goto l188;
+  l189:;	  ctx->pos= yypos189; ctx->thunkpos= yythunkpos189;
+  }  if (!(YY_END)) goto l187;  ctx->marked |= 2;  if (!yymatchChar(ctx, '\'')) goto l187;
+  yyprintf((stderr, "  ok   %s @ %s\n", "TitleSingle", ctx->buf+ctx->pos));
+  return 1;
+  l187:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TitleSingle", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Nonspacechar(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "Nonspacechar"));
+  {  int yypos197= ctx->pos, yythunkpos197= ctx->thunkpos;  if (!yy_Spacechar(ctx)) goto l197;  goto l196;
+  l197:;	  ctx->pos= yypos197; ctx->thunkpos= yythunkpos197;
+  }
+  {  int yypos198= ctx->pos, yythunkpos198= ctx->thunkpos;  if (!yy_Newline(ctx)) goto l198;  goto l196;
+  l198:;	  ctx->pos= yypos198; ctx->thunkpos= yythunkpos198;
+  }  if (!yymatchDot(ctx)) goto l196;
+  yyprintf((stderr, "  ok   %s @ %s\n", "Nonspacechar", ctx->buf+ctx->pos));
+  return 1;
+  l196:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Nonspacechar", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Title(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "Title"));
+  {  int yypos203= ctx->pos, yythunkpos203= ctx->thunkpos;  int yyc204= yypeek(ctx);
+  switch (yyc204)
+    {
+     case 39:  goto l200;
+     case 34:  goto l201;
+    default:  goto l202;
+    }
+  l200:;	  if (!yy_TitleSingle(ctx)) goto l205;  goto l203;
+  l205:;	  ctx->pos= yypos203; ctx->thunkpos= yythunkpos203;
+  l201:;	  if (!yyfirst(yyc204, (unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l202;  if (!yy_TitleDouble(ctx)) goto l206;  goto l203;
+  l206:;	  ctx->pos= yypos203; ctx->thunkpos= yythunkpos203;
+  l202:;	  if (!(YY_BEGIN)) goto l199;  ctx->marked |= 1;  if (!yymatchString(ctx, "")) goto l199;  if (!(YY_END)) goto l199;  ctx->marked |= 2;
+  }
+  l203:;	  yyDo(ctx, yy_1_Title, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Title", ctx->buf+ctx->pos));
+  return 1;
+  l199:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Title", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Source(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "Source"));
+  {  int yypos210= ctx->pos, yythunkpos210= ctx->thunkpos;  int yyc211= yypeek(ctx);
+  switch (yyc211)
+    {
+     case 60:  goto l208;
+    default:  goto l209;
+    }
+  l208:;	  if (!yymatchChar(ctx, '<')) goto l212;  if (!(YY_BEGIN)) goto l212;  ctx->marked |= 1;  if (!yy_SourceContents(ctx)) goto l212;  if (!(YY_END)) goto l212;  ctx->marked |= 2;  if (!yymatchChar(ctx, '>')) goto l212;  goto l210;
+  l212:;	  ctx->pos= yypos210; ctx->thunkpos= yythunkpos210;
+  l209:;	  if (!(YY_BEGIN)) goto l207;  ctx->marked |= 1;  if (!yy_SourceContents(ctx)) goto l207;  if (!(YY_END)) goto l207;  ctx->marked |= 2;
+  }
+  l210:;	  yyDo(ctx, yy_1_Source, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Source", ctx->buf+ctx->pos));
+  return 1;
+  l207:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Source", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_ReferenceLinkSingle(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "ReferenceLinkSingle"));  if (!yy_Label(ctx)) goto l213;  yyDo(ctx, yySet, -1, 0);  if (!(YY_BEGIN)) goto l213;  ctx->marked |= 1;
+  {  int yypos214= ctx->pos, yythunkpos214= ctx->thunkpos;  if (!yy_Spnl(ctx)) goto l214;  if (!yymatchString(ctx, "[]")) goto l214;  goto l215;
+  l214:;	  ctx->pos= yypos214; ctx->thunkpos= yythunkpos214;
+  }
+  l215:;	  if (!(YY_END)) goto l213;  ctx->marked |= 2;  yyDo(ctx, yy_1_ReferenceLinkSingle, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ReferenceLinkSingle", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 1, 0);
+  return 1;
+  l213:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ReferenceLinkSingle", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_ReferenceLinkDouble(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "ReferenceLinkDouble"));  if (!yy_Label(ctx)) goto l216;  yyDo(ctx, yySet, -2, 0);  if (!(YY_BEGIN)) goto l216;  ctx->marked |= 1;  if (!yy_Spnl(ctx)) goto l216;  if (!(YY_END)) goto l216;  ctx->marked |= 2;
+  {  int yypos217= ctx->pos, yythunkpos217= ctx->thunkpos;  if (!yymatchString(ctx, "[]")) goto l217;  goto l216;
+  l217:;	  ctx->pos= yypos217; ctx->thunkpos= yythunkpos217;
+  }  if (!yy_Label(ctx)) goto l216;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_1_ReferenceLinkDouble, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ReferenceLinkDouble", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 2, 0);
+  return 1;
+  l216:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ReferenceLinkDouble", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_AutoLink(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "AutoLink"));
+  {  int yypos221= ctx->pos, yythunkpos221= ctx->thunkpos;  int yyc222= yypeek(ctx);
+  switch (yyc222)
+    {
+     case 60:  goto l219;
+    default:  goto l218;
+    }
+  l219:;	  if (!yy_AutoLinkUrl(ctx)) goto l223;  goto l221;
+  l223:;	  ctx->pos= yypos221; ctx->thunkpos= yythunkpos221;  if (!yyfirst(yyc222, (unsigned char *)"\000\000\000\000\000\000\000\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l218;  if (!yy_AutoLinkEmail(ctx)) goto l218;
+  }
+  l221:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "AutoLink", ctx->buf+ctx->pos));
+  return 1;
+  l218:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AutoLink", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_ReferenceLink(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "ReferenceLink"));
+  {  int yypos227= ctx->pos, yythunkpos227= ctx->thunkpos;  int yyc228= yypeek(ctx);
+  switch (yyc228)
+    {
+     case 91:  goto l225;
+    default:  goto l224;
+    }
+  l225:;	  if (!yy_ReferenceLinkDouble(ctx)) goto l229;  goto l227;
+  l229:;	  ctx->pos= yypos227; ctx->thunkpos= yythunkpos227;  if (!yyfirst(yyc228, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l224;  if (!yy_ReferenceLinkSingle(ctx)) goto l224;
+  }
+  l227:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "ReferenceLink", ctx->buf+ctx->pos));
+  return 1;
+  l224:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ReferenceLink", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_ExplicitLink(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 3, 0);
+  yyprintf((stderr, "%s\n", "ExplicitLink"));  if (!yy_Label(ctx)) goto l230;  yyDo(ctx, yySet, -3, 0);  if (!yymatchChar(ctx, '(')) goto l230;  if (!yy_Sp(ctx)) goto l230;  if (!yy_Source(ctx)) goto l230;  yyDo(ctx, yySet, -2, 0);  if (!yy_Spnl(ctx)) goto l230;  if (!yy_Title(ctx)) goto l230;  yyDo(ctx, yySet, -1, 0);  if (!yy_Sp(ctx)) goto l230;  if (!yymatchChar(ctx, ')')) goto l230;  yyDo(ctx, yy_1_ExplicitLink, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ExplicitLink", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 3, 0);
+  return 1;
+  l230:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ExplicitLink", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_StrongUl(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "StrongUl"));  if (!yymatchString(ctx, "__")) goto l231;
+  {  int yypos232= ctx->pos, yythunkpos232= ctx->thunkpos;  if (!yy_Whitespace(ctx)) goto l232;  goto l231;
+  l232:;	  ctx->pos= yypos232; ctx->thunkpos= yythunkpos232;
+  }
+  {  int yypos233= ctx->pos, yythunkpos233= ctx->thunkpos;  if (!yymatchString(ctx, "__")) goto l233;  goto l231;
+  l233:;	  ctx->pos= yypos233; ctx->thunkpos= yythunkpos233;
+  }  if (!yy_Inline(ctx)) goto l231;  yyDo(ctx, yySet, -2, 0);  if (!yy_StrongUlTail(ctx)) goto l231;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_1_StrongUl, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "StrongUl", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 2, 0);
+  return 1;
+  l231:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StrongUl", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_StrongStar(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "StrongStar"));  if (!yymatchString(ctx, "**")) goto l234;
+  {  int yypos235= ctx->pos, yythunkpos235= ctx->thunkpos;  if (!yy_Whitespace(ctx)) goto l235;  goto l234;
+  l235:;	  ctx->pos= yypos235; ctx->thunkpos= yythunkpos235;
+  }
+  {  int yypos236= ctx->pos, yythunkpos236= ctx->thunkpos;  if (!yymatchString(ctx, "**")) goto l236;  goto l234;
+  l236:;	  ctx->pos= yypos236; ctx->thunkpos= yythunkpos236;
+  }  if (!yy_Inline(ctx)) goto l234;  yyDo(ctx, yySet, -2, 0);  if (!yy_StrongStarTail(ctx)) goto l234;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_1_StrongStar, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "StrongStar", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 2, 0);
+  return 1;
+  l234:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StrongStar", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Whitespace(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "Whitespace"));
+  {  int yypos240= ctx->pos, yythunkpos240= ctx->thunkpos;  int yyc241= yypeek(ctx);
+  switch (yyc241)
+    {
+     case 9: case 32:  goto l238;
+     case 10: case 13:  goto l239;
+    default:  goto l237;
+    }
+  l238:;	  if (!yy_Spacechar(ctx)) goto l242;  goto l240;
+  l242:;	  ctx->pos= yypos240; ctx->thunkpos= yythunkpos240;
+  l239:;	  if (!yyfirst(yyc241, (unsigned char *)"\000\044\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l237;  if (!yy_Newline(ctx)) goto l237;
+  }
+  l240:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Whitespace", ctx->buf+ctx->pos));
+  return 1;
+  l237:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Whitespace", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_EmphUl(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "EmphUl"));  if (!yymatchChar(ctx, '_')) goto l243;
+  {  int yypos244= ctx->pos, yythunkpos244= ctx->thunkpos;  if (!yy_Whitespace(ctx)) goto l244;  goto l243;
+  l244:;	  ctx->pos= yypos244; ctx->thunkpos= yythunkpos244;
+  }
+  {  int yypos247= ctx->pos, yythunkpos247= ctx->thunkpos;  int yyc248= yypeek(ctx);
+  switch (yyc248)
+    {
+    default:  goto l245;
+    }
+  l245:;	
+  {  int yypos250= ctx->pos, yythunkpos250= ctx->thunkpos;  if (!yymatchChar(ctx, '_')) goto l250;  goto l249;
+  l250:;	  ctx->pos= yypos250; ctx->thunkpos= yythunkpos250;
+  }  if (!yy_Inline(ctx)) goto l249;  yyDo(ctx, yySet, -2, 0);  goto l247;
+  l249:;	  ctx->pos= yypos247; ctx->thunkpos= yythunkpos247;  if (!yyfirst(yyc248, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l243;  if (!yy_StrongUl(ctx)) goto l243;  yyDo(ctx, yySet, -2, 0);
+  }
+  l247:;	  if (!yy_EmphUlTail(ctx)) goto l243;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_1_EmphUl, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "EmphUl", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 2, 0);
+  return 1;
+  l243:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EmphUl", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_EmphStar(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "EmphStar"));  if (!yymatchChar(ctx, '*')) goto l251;
+  {  int yypos252= ctx->pos, yythunkpos252= ctx->thunkpos;  if (!yy_Whitespace(ctx)) goto l252;  goto l251;
+  l252:;	  ctx->pos= yypos252; ctx->thunkpos= yythunkpos252;
+  }
+  {  int yypos255= ctx->pos, yythunkpos255= ctx->thunkpos;  int yyc256= yypeek(ctx);
+  switch (yyc256)
+    {
+    default:  goto l253;
+    }
+  l253:;	
+  {  int yypos258= ctx->pos, yythunkpos258= ctx->thunkpos;  if (!yymatchChar(ctx, '*')) goto l258;  goto l257;
+  l258:;	  ctx->pos= yypos258; ctx->thunkpos= yythunkpos258;
+  }  if (!yy_Inline(ctx)) goto l257;  yyDo(ctx, yySet, -2, 0);  goto l255;
+  l257:;	  ctx->pos= yypos255; ctx->thunkpos= yythunkpos255;  if (!yyfirst(yyc256, (unsigned char *)"\000\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l251;  if (!yy_StrongStar(ctx)) goto l251;  yyDo(ctx, yySet, -2, 0);
+  }
+  l255:;	  if (!yy_EmphStarTail(ctx)) goto l251;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_1_EmphStar, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "EmphStar", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 2, 0);
+  return 1;
+  l251:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EmphStar", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_StarLine(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "StarLine"));
+  {  int yypos262= ctx->pos, yythunkpos262= ctx->thunkpos;  int yyc263= yypeek(ctx);
+  switch (yyc263)
+    {
+     case 42:  goto l260;
+     case 9: case 32:  goto l261;
+    default:  goto l259;
+    }
+  l260:;	  if (!(YY_BEGIN)) goto l264;  ctx->marked |= 1;  if (!yymatchString(ctx, "****")) goto l264;
+  l265:;	
+  {  int yypos266= ctx->pos, yythunkpos266= ctx->thunkpos;  if (!yymatchChar(ctx, '*')) goto l266;  goto l265;
+  l266:;	  ctx->pos= yypos266; ctx->thunkpos= yythunkpos266;
+  }  if (!(YY_END)) goto l264;  ctx->marked |= 2;  goto l262;
+  l264:;	  ctx->pos= yypos262; ctx->thunkpos= yythunkpos262;
+  l261:;	  if (!yyfirst(yyc263, (unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l259;  if (!(YY_BEGIN)) goto l259;  ctx->marked |= 1;  if (!yy_Spacechar(ctx)) goto l259;  if (!yymatchChar(ctx, '*')) goto l259;
+  l267:;	
+  {  int yypos268= ctx->pos, yythunkpos268= ctx->thunkpos;  if (!yymatchChar(ctx, '*')) goto l268;  goto l267;
+  l268:;	  ctx->pos= yypos268; ctx->thunkpos= yythunkpos268;
+  }
+  {  int yypos269= ctx->pos, yythunkpos269= ctx->thunkpos;  if (!yy_Spacechar(ctx)) goto l259;  ctx->pos= yypos269; ctx->thunkpos= yythunkpos269;
+  }  if (!(YY_END)) goto l259;  ctx->marked |= 2;
+  }
+  l262:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "StarLine", ctx->buf+ctx->pos));
+  return 1;
+  l259:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StarLine", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_UlLine(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "UlLine"));
+  {  int yypos273= ctx->pos, yythunkpos273= ctx->thunkpos;  int yyc274= yypeek(ctx);
+  switch (yyc274)
+    {
+     case 95:  goto l271;
+     case 9: case 32:  goto l272;
+    default:  goto l270;
+    }
+  l271:;	  if (!(YY_BEGIN)) goto l275;  ctx->marked |= 1;  if (!yymatchString(ctx, "____")) goto l275;
+  l276:;	
+  {  int yypos277= ctx->pos, yythunkpos277= ctx->thunkpos;  if (!yymatchChar(ctx, '_')) goto l277;  goto l276;
+  l277:;	  ctx->pos= yypos277; ctx->thunkpos= yythunkpos277;
+  }  if (!(YY_END)) goto l275;  ctx->marked |= 2;  goto l273;
+  l275:;	  ctx->pos= yypos273; ctx->thunkpos= yythunkpos273;
+  l272:;	  if (!yyfirst(yyc274, (unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l270;  if (!(YY_BEGIN)) goto l270;  ctx->marked |= 1;  if (!yy_Spacechar(ctx)) goto l270;  if (!yymatchChar(ctx, '_')) goto l270;
+  l278:;	
+  {  int yypos279= ctx->pos, yythunkpos279= ctx->thunkpos;  if (!yymatchChar(ctx, '_')) goto l279;  goto l278;
+  l279:;	  ctx->pos= yypos279; ctx->thunkpos= yythunkpos279;
+  }
+  {  int yypos280= ctx->pos, yythunkpos280= ctx->thunkpos;  if (!yy_Spacechar(ctx)) goto l270;  ctx->pos= yypos280; ctx->thunkpos= yythunkpos280;
+  }  if (!(YY_END)) goto l270;  ctx->marked |= 2;
+  }
+  l273:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "UlLine", ctx->buf+ctx->pos));
+  return 1;
+  l270:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "UlLine", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_SpecialChar(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "SpecialChar"));
+  {  int yypos284= ctx->pos, yythunkpos284= ctx->thunkpos;  int yyc285= yypeek(ctx);
+  switch (yyc285)
+    {
+     case 33: case 34: case 35: case 38: case 39: case 40: case 41: case 42:
+     case 60: case 91: case 92: case 93: case 95: case 96: case 126:  goto l282;
+    default:  goto l283;
+    }
+  l282:;	  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\316\007\000\020\000\000\000\270\001\000\000\100\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l286;  goto l284;
+  l286:;	  ctx->pos= yypos284; ctx->thunkpos= yythunkpos284;
+  l283:;	  if (!yy_ExtendedSpecialChar(ctx)) goto l281;
+  }
+  l284:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "SpecialChar", ctx->buf+ctx->pos));
+  return 1;
+  l281:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SpecialChar", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Eof(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "Eof"));
+  {  int yypos288= ctx->pos, yythunkpos288= ctx->thunkpos;  if (!yymatchDot(ctx)) goto l288;  goto l287;
+  l288:;	  ctx->pos= yypos288; ctx->thunkpos= yythunkpos288;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "Eof", ctx->buf+ctx->pos));
+  return 1;
+  l287:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Eof", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_NormalEndline(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "NormalEndline"));  if (!yy_Sp(ctx)) goto l289;  if (!yy_Newline(ctx)) goto l289;
+  {  int yypos290= ctx->pos, yythunkpos290= ctx->thunkpos;  if (!yy_BlankLine(ctx)) goto l290;  goto l289;
+  l290:;	  ctx->pos= yypos290; ctx->thunkpos= yythunkpos290;
+  }
+  {  int yypos291= ctx->pos, yythunkpos291= ctx->thunkpos;  if (!yymatchChar(ctx, '>')) goto l291;  goto l289;
+  l291:;	  ctx->pos= yypos291; ctx->thunkpos= yythunkpos291;
+  }
+  {  int yypos292= ctx->pos, yythunkpos292= ctx->thunkpos;  if (!yy_AtxStart(ctx)) goto l292;  goto l289;
+  l292:;	  ctx->pos= yypos292; ctx->thunkpos= yythunkpos292;
+  }  if (!( !underlined(ctx) )) goto l289;  yyDo(ctx, yy_1_NormalEndline, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "NormalEndline", ctx->buf+ctx->pos));
+  return 1;
+  l289:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "NormalEndline", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_TerminalEndline(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "TerminalEndline"));  if (!yy_Sp(ctx)) goto l293;  if (!yy_Newline(ctx)) goto l293;  if (!yy_Eof(ctx)) goto l293;  yyDo(ctx, yy_1_TerminalEndline, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "TerminalEndline", ctx->buf+ctx->pos));
+  return 1;
+  l293:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TerminalEndline", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_LineBreak(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "LineBreak"));  if (!yymatchString(ctx, "  ")) goto l294;  if (!yy_NormalEndline(ctx)) goto l294;  yyDo(ctx, yy_1_LineBreak, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "LineBreak", ctx->buf+ctx->pos));
+  return 1;
+  l294:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "LineBreak", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_CharEntity(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "CharEntity"));  if (!(YY_BEGIN)) goto l295;  ctx->marked |= 1;  if (!yymatchChar(ctx, '&')) goto l295;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l295;
+  l296:;	
+  {  int yypos297= ctx->pos, yythunkpos297= ctx->thunkpos;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l297;  goto l296;
+  l297:;	  ctx->pos= yypos297; ctx->thunkpos= yythunkpos297;
+  }  if (!yymatchChar(ctx, ';')) goto l295;  if (!(YY_END)) goto l295;  ctx->marked |= 2;
+  yyprintf((stderr, "  ok   %s @ %s\n", "CharEntity", ctx->buf+ctx->pos));
+  return 1;
+  l295:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CharEntity", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_DecEntity(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "DecEntity"));  if (!(YY_BEGIN)) goto l298;  ctx->marked |= 1;  if (!yymatchChar(ctx, '&')) goto l298;  if (!yymatchChar(ctx, '#')) goto l298;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l298;
+  l299:;	
+  {  int yypos300= ctx->pos, yythunkpos300= ctx->thunkpos;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l300;  goto l299;
+  l300:;	  ctx->pos= yypos300; ctx->thunkpos= yythunkpos300;
+  }  if (!(YY_END)) goto l298;  ctx->marked |= 2;  if (!yymatchChar(ctx, ';')) goto l298;  if (!(YY_END)) goto l298;  ctx->marked |= 2;
+  yyprintf((stderr, "  ok   %s @ %s\n", "DecEntity", ctx->buf+ctx->pos));
+  return 1;
+  l298:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DecEntity", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_HexEntity(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "HexEntity"));  if (!(YY_BEGIN)) goto l301;  ctx->marked |= 1;  if (!yymatchChar(ctx, '&')) goto l301;  if (!yymatchChar(ctx, '#')) goto l301;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\001\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l301;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l301;
+  l302:;	
+  {  int yypos303= ctx->pos, yythunkpos303= ctx->thunkpos;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l303;  goto l302;
+  l303:;	  ctx->pos= yypos303; ctx->thunkpos= yythunkpos303;
+  }  if (!yymatchChar(ctx, ';')) goto l301;  if (!(YY_END)) goto l301;  ctx->marked |= 2;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HexEntity", ctx->buf+ctx->pos));
+  return 1;
+  l301:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HexEntity", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_AposChunk(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "AposChunk"));  if (!( extension(EXT_SMART) && !after_smart_mark(ctx) )) goto l304;  if (!yymatchChar(ctx, '\'')) goto l304;
+  {  int yypos305= ctx->pos, yythunkpos305= ctx->thunkpos;  if (!yy_Alphanumeric(ctx)) goto l304;  ctx->pos= yypos305; ctx->thunkpos= yythunkpos305;
+  }  yyDo(ctx, yy_1_AposChunk, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "AposChunk", ctx->buf+ctx->pos));
+  return 1;
+  l304:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AposChunk", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Alphanumeric(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "Alphanumeric"));  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l306;
+  yyprintf((stderr, "  ok   %s @ %s\n", "Alphanumeric", ctx->buf+ctx->pos));
+  return 1;
+  l306:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Alphanumeric", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_StrChunk(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "StrChunk"));
+  {  int yypos310= ctx->pos, yythunkpos310= ctx->thunkpos;  if (!(YY_BEGIN)) goto l311;  ctx->marked |= 1;
+  {  int yypos316= ctx->pos, yythunkpos316= ctx->thunkpos;  if (!yy_NormalChars(ctx)) goto l317;  goto l316;
+  l317:;	  ctx->pos= yypos316; ctx->thunkpos= yythunkpos316;  if (!( !after_smart_mark(ctx) )) goto l311;  if (!yymatchChar(ctx, '_')) goto l311;
+  l318:;	
+  {  int yypos319= ctx->pos, yythunkpos319= ctx->thunkpos;  if (!yymatchChar(ctx, '_')) goto l319;  goto l318;
+  l319:;	  ctx->pos= yypos319; ctx->thunkpos= yythunkpos319;
+  }
+  {  int yypos320= ctx->pos, yythunkpos320= ctx->thunkpos;  if (!yy_Alphanumeric(ctx)) goto l311;  ctx->pos= yypos320; ctx->thunkpos= yythunkpos320;
+  }
+  }
+  l316:;	
+  l312:;	
+  {  int yypos313= ctx->pos, yythunkpos313= ctx->thunkpos;
+  {  int yypos323= ctx->pos, yythunkpos323= ctx->thunkpos;  if (!yy_NormalChars(ctx)) goto l324;  goto l323;
+  l324:;	  ctx->pos= yypos323; ctx->thunkpos= yythunkpos323;  if (!( !after_smart_mark(ctx) )) goto l313;  if (!yymatchChar(ctx, '_')) goto l313;
+  l325:;	
+  {  int yypos326= ctx->pos, yythunkpos326= ctx->thunkpos;  if (!yymatchChar(ctx, '_')) goto l326;  goto l325;
+  l326:;	  ctx->pos= yypos326; ctx->thunkpos= yythunkpos326;
+  }
+  {  int yypos327= ctx->pos, yythunkpos327= ctx->thunkpos;  if (!yy_Alphanumeric(ctx)) goto l313;  ctx->pos= yypos327; ctx->thunkpos= yythunkpos327;
+  }
+  }
+  l323:;	  goto l312;
+  l313:;	  ctx->pos= yypos313; ctx->thunkpos= yythunkpos313;
+  }  if (!(YY_END)) goto l311;  ctx->marked |= 2;  yyDo(ctx, yy_1_StrChunk, ctx->begin, ctx->end);  goto l310;
+  l311:;	  ctx->pos= yypos310; ctx->thunkpos= yythunkpos310;  if (!yy_AposChunk(ctx)) goto l307;
+  }
+  l310:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "StrChunk", ctx->buf+ctx->pos));
+  return 1;
+  l307:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StrChunk", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_NormalChars(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "NormalChars"));  if (!yymatchDot(ctx)) goto l328;  if (!( normal_chars(ctx) )) goto l328;
+  yyprintf((stderr, "  ok   %s @ %s\n", "NormalChars", ctx->buf+ctx->pos));
+  return 1;
+  l328:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "NormalChars", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Symbol(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "Symbol"));  if (!(YY_BEGIN)) goto l329;  ctx->marked |= 1;  if (!yy_SpecialChar(ctx)) goto l329;  if (!(YY_END)) goto l329;  ctx->marked |= 2;  yyDo(ctx, yy_1_Symbol, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Symbol", ctx->buf+ctx->pos));
+  return 1;
+  l329:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Symbol", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Smart(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "Smart"));  if (!( extension(EXT_SMART) )) goto l330;
+  {  int yypos335= ctx->pos, yythunkpos335= ctx->thunkpos;  int yyc336= yypeek(ctx);
+  switch (yyc336)
+    {
+     case 46:  goto l331;
+    default:  goto l332;
+    }
+  l331:;	  if (!yy_Ellipsis(ctx)) goto l337;  goto l335;
+  l337:;	  ctx->pos= yypos335; ctx->thunkpos= yythunkpos335;
+  l332:;	  if (!yy_SingleQuoted(ctx)) goto l338;  goto l335;
+  l338:;	  ctx->pos= yypos335; ctx->thunkpos= yythunkpos335;  if (!yy_DoubleQuoted(ctx)) goto l339;  goto l335;
+  l339:;	  ctx->pos= yypos335; ctx->thunkpos= yythunkpos335;  if (!yyfirst(yyc336, (unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l330;  if (!yy_Apostrophe(ctx)) goto l330;
+  }
+  l335:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Smart", ctx->buf+ctx->pos));
+  return 1;
+  l330:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Smart", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_EscapedChar(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "EscapedChar"));  if (!yymatchChar(ctx, '\\')) goto l340;
+  {  int yypos341= ctx->pos, yythunkpos341= ctx->thunkpos;  if (!yy_Newline(ctx)) goto l341;  goto l340;
+  l341:;	  ctx->pos= yypos341; ctx->thunkpos= yythunkpos341;
+  }  if (!(YY_BEGIN)) goto l340;  ctx->marked |= 1;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\012\157\000\120\000\000\000\270\001\000\000\070\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l340;  if (!(YY_END)) goto l340;  ctx->marked |= 2;  yyDo(ctx, yy_1_EscapedChar, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "EscapedChar", ctx->buf+ctx->pos));
+  return 1;
+  l340:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EscapedChar", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Entity(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "Entity"));
+  {  int yypos346= ctx->pos, yythunkpos346= ctx->thunkpos;  int yyc347= yypeek(ctx);
+  switch (yyc347)
+    {
+     case 38:  goto l343;
+    default:  goto l342;
+    }
+  l343:;	  if (!yy_HexEntity(ctx)) goto l348;  goto l346;
+  l348:;	  ctx->pos= yypos346; ctx->thunkpos= yythunkpos346;  if (!yyfirst(yyc347, (unsigned char *)"\000\000\000\000\100\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l345;  if (!yy_DecEntity(ctx)) goto l349;  goto l346;
+  l349:;	  ctx->pos= yypos346; ctx->thunkpos= yythunkpos346;
+  l345:;	  if (!yyfirst(yyc347, (unsigned char *)"\000\000\000\000\100\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l342;  if (!yy_CharEntity(ctx)) goto l342;
+  }
+  l346:;	  yyDo(ctx, yy_1_Entity, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Entity", ctx->buf+ctx->pos));
+  return 1;
+  l342:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Entity", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_RawHtml(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "RawHtml"));  if (!(YY_BEGIN)) goto l350;  ctx->marked |= 1;
+  {  int yypos354= ctx->pos, yythunkpos354= ctx->thunkpos;  int yyc355= yypeek(ctx);
+  switch (yyc355)
+    {
+     case 60:  goto l351;
+    default:  goto l350;
+    }
+  l351:;	  if (!yy_HtmlComment(ctx)) goto l356;  goto l354;
+  l356:;	  ctx->pos= yypos354; ctx->thunkpos= yythunkpos354;  if (!yyfirst(yyc355, (unsigned char *)"\000\000\000\000\000\000\000\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l353;  if (!yy_HtmlScript(ctx)) goto l357;  goto l354;
+  l357:;	  ctx->pos= yypos354; ctx->thunkpos= yythunkpos354;
+  l353:;	  if (!yyfirst(yyc355, (unsigned char *)"\000\000\000\000\000\000\000\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l350;  if (!yy_HtmlTag(ctx)) goto l350;
+  }
+  l354:;	  if (!(YY_END)) goto l350;  ctx->marked |= 2;  yyDo(ctx, yy_1_RawHtml, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "RawHtml", ctx->buf+ctx->pos));
+  return 1;
+  l350:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RawHtml", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Code(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "Code"));  if (!yymatchChar(ctx, '`')) goto l358;  if (!( code_span(ctx) )) goto l358;  yyDo(ctx, yy_1_Code, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Code", ctx->buf+ctx->pos));
+  return 1;
+  l358:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Code", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_InlineNote(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "InlineNote"));  if (!( extension(EXT_NOTES) && nested_inlines() )) goto l359;  if (!yymatchString(ctx, "^[")) goto l359;  if (!( label_closes(ctx) )) goto l359;  if (!yy_StartList(ctx)) goto l359;  yyDo(ctx, yySet, -1, 0);
+  {  int yypos362= ctx->pos, yythunkpos362= ctx->thunkpos;  if (!yymatchChar(ctx, ']')) goto l362;  goto l359;
+  l362:;	  ctx->pos= yypos362; ctx->thunkpos= yythunkpos362;
+  }  if (!yy_Inline(ctx)) goto l359;  yyDo(ctx, yy_1_InlineNote, ctx->begin, ctx->end);
+  l360:;	
+  {  int yypos361= ctx->pos, yythunkpos361= ctx->thunkpos;
+  {  int yypos363= ctx->pos, yythunkpos363= ctx->thunkpos;  if (!yymatchChar(ctx, ']')) goto l363;  goto l361;
+  l363:;	  ctx->pos= yypos363; ctx->thunkpos= yythunkpos363;
+  }  if (!yy_Inline(ctx)) goto l361;  yyDo(ctx, yy_1_InlineNote, ctx->begin, ctx->end);  goto l360;
+  l361:;	  ctx->pos= yypos361; ctx->thunkpos= yythunkpos361;
+  }  if (!yymatchChar(ctx, ']')) goto l359;  yyDo(ctx, yy_2_InlineNote, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "InlineNote", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 1, 0);
+  return 1;
+  l359:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "InlineNote", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_NoteReference(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "NoteReference"));  if (!( extension(EXT_NOTES) )) goto l364;  if (!yy_RawNoteReference(ctx)) goto l364;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_1_NoteReference, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "NoteReference", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 1, 0);
+  return 1;
+  l364:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "NoteReference", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Link(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "Link"));
+  {  int yypos368= ctx->pos, yythunkpos368= ctx->thunkpos;  int yyc369= yypeek(ctx);
+  switch (yyc369)
+    {
+    default:  goto l366;
+    }
+  l366:;	  if (!( nested_inlines() )) goto l370;
+  {  int yypos373= ctx->pos, yythunkpos373= ctx->thunkpos;  int yyc374= yypeek(ctx);
+  switch (yyc374)
+    {
+     case 91:  goto l371;
+    default:  goto l370;
+    }
+  l371:;	  if (!yy_ExplicitLink(ctx)) goto l375;  goto l373;
+  l375:;	  ctx->pos= yypos373; ctx->thunkpos= yythunkpos373;  if (!yyfirst(yyc374, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l370;  if (!yy_ReferenceLink(ctx)) goto l370;
+  }
+  l373:;	  goto l368;
+  l370:;	  ctx->pos= yypos368; ctx->thunkpos= yythunkpos368;  if (!yyfirst(yyc369, (unsigned char *)"\000\000\000\000\000\000\000\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l365;  if (!yy_AutoLink(ctx)) goto l365;
+  }
+  l368:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Link", ctx->buf+ctx->pos));
+  return 1;
+  l365:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Link", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Image(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "Image"));  if (!yymatchChar(ctx, '!')) goto l376;  if (!( nested_inlines() )) goto l376;
+  {  int yypos379= ctx->pos, yythunkpos379= ctx->thunkpos;  int yyc380= yypeek(ctx);
+  switch (yyc380)
+    {
+     case 91:  goto l377;
+    default:  goto l376;
+    }
+  l377:;	  if (!yy_ExplicitLink(ctx)) goto l381;  goto l379;
+  l381:;	  ctx->pos= yypos379; ctx->thunkpos= yythunkpos379;  if (!yyfirst(yyc380, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l376;  if (!yy_ReferenceLink(ctx)) goto l376;
+  }
+  l379:;	  yyDo(ctx, yy_1_Image, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Image", ctx->buf+ctx->pos));
+  return 1;
+  l376:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Image", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Strike(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "Strike"));  if (!( extension(EXT_STRIKE) && nested_emphasis() )) goto l382;  if (!yymatchString(ctx, "~~")) goto l382;
+  {  int yypos383= ctx->pos, yythunkpos383= ctx->thunkpos;  if (!yy_Whitespace(ctx)) goto l383;  goto l382;
+  l383:;	  ctx->pos= yypos383; ctx->thunkpos= yythunkpos383;
+  }
+  {  int yypos384= ctx->pos, yythunkpos384= ctx->thunkpos;  if (!yymatchString(ctx, "~~")) goto l384;  goto l382;
+  l384:;	  ctx->pos= yypos384; ctx->thunkpos= yythunkpos384;
+  }  if (!yy_Inline(ctx)) goto l382;  yyDo(ctx, yySet, -2, 0);  if (!yy_StrikeTail(ctx)) goto l382;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_1_Strike, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Strike", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 2, 0);
+  return 1;
+  l382:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Strike", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Emph(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "Emph"));  if (!( nested_emphasis() )) goto l385;
+  {  int yypos388= ctx->pos, yythunkpos388= ctx->thunkpos;  int yyc389= yypeek(ctx);
+  switch (yyc389)
+    {
+     case 42:  goto l386;
+     case 95:  goto l387;
+    default:  goto l385;
+    }
+  l386:;	  if (!yy_EmphStar(ctx)) goto l390;  goto l388;
+  l390:;	  ctx->pos= yypos388; ctx->thunkpos= yythunkpos388;
+  l387:;	  if (!yyfirst(yyc389, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l385;  if (!yy_EmphUl(ctx)) goto l385;
+  }
+  l388:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Emph", ctx->buf+ctx->pos));
+  return 1;
+  l385:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Emph", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Strong(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "Strong"));  if (!( nested_emphasis() )) goto l391;
+  {  int yypos394= ctx->pos, yythunkpos394= ctx->thunkpos;  int yyc395= yypeek(ctx);
+  switch (yyc395)
+    {
+     case 42:  goto l392;
+     case 95:  goto l393;
+    default:  goto l391;
+    }
+  l392:;	  if (!yy_StrongStar(ctx)) goto l396;  goto l394;
+  l396:;	  ctx->pos= yypos394; ctx->thunkpos= yythunkpos394;
+  l393:;	  if (!yyfirst(yyc395, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l391;  if (!yy_StrongUl(ctx)) goto l391;
+  }
+  l394:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Strong", ctx->buf+ctx->pos));
+  return 1;
+  l391:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Strong", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Space(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "Space"));  if (!yy_Spacechar(ctx)) goto l397;
+  l398:;	
+  {  int yypos399= ctx->pos, yythunkpos399= ctx->thunkpos;  if (!yy_Spacechar(ctx)) goto l399;  goto l398;
+  l399:;	  ctx->pos= yypos399; ctx->thunkpos= yythunkpos399;
+  }  yyDo(ctx, yy_1_Space, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Space", ctx->buf+ctx->pos));
+  return 1;
+  l397:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Space", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_UlOrStarLine(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "UlOrStarLine"));
+  {  int yypos403= ctx->pos, yythunkpos403= ctx->thunkpos;  int yyc404= yypeek(ctx);
+  switch (yyc404)
+    {
+     case 9: case 32: case 95:  goto l401;
+     case 42:  goto l402;
+    default:  goto l400;
+    }
+  l401:;	  if (!yy_UlLine(ctx)) goto l405;  goto l403;
+  l405:;	  ctx->pos= yypos403; ctx->thunkpos= yythunkpos403;
+  l402:;	  if (!yyfirst(yyc404, (unsigned char *)"\000\002\000\000\001\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l400;  if (!yy_StarLine(ctx)) goto l400;
+  }
+  l403:;	  yyDo(ctx, yy_1_UlOrStarLine, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "UlOrStarLine", ctx->buf+ctx->pos));
+  return 1;
+  l400:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "UlOrStarLine", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Str(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Str"));  if (!yy_StartList(ctx)) goto l406;  yyDo(ctx, yySet, -1, 0);  if (!(YY_BEGIN)) goto l406;  ctx->marked |= 1;  if (!yy_NormalChars(ctx)) goto l406;  if (!(YY_END)) goto l406;  ctx->marked |= 2;  yyDo(ctx, yy_1_Str, ctx->begin, ctx->end);
+  l407:;	
+  {  int yypos408= ctx->pos, yythunkpos408= ctx->thunkpos;  if (!yy_StrChunk(ctx)) goto l408;  yyDo(ctx, yy_2_Str, ctx->begin, ctx->end);  goto l407;
+  l408:;	  ctx->pos= yypos408; ctx->thunkpos= yythunkpos408;
+  }  yyDo(ctx, yy_3_Str, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Str", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 1, 0);
+  return 1;
+  l406:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Str", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_InStyleTags(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "InStyleTags"));  if (!yy_StyleOpen(ctx)) goto l409;
+  l410:;	
+  {  int yypos411= ctx->pos, yythunkpos411= ctx->thunkpos;
+  {  int yypos412= ctx->pos, yythunkpos412= ctx->thunkpos;  if (!yy_StyleClose(ctx)) goto l412;  goto l411;
+  l412:;	  ctx->pos= yypos412; ctx->thunkpos= yythunkpos412;
+  }  if (!yymatchDot(ctx)) goto l411;  goto l410;
+  l411:;	  ctx->pos= yypos411; ctx->thunkpos= yythunkpos411;
+  }  if (!yy_StyleClose(ctx)) goto l409;
+  yyprintf((stderr, "  ok   %s @ %s\n", "InStyleTags", ctx->buf+ctx->pos));
+  return 1;
+  l409:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "InStyleTags", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_StyleClose(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "StyleClose"));  if (!yymatchChar(ctx, '<')) goto l413;  if (!yy_Spnl(ctx)) goto l413;  if (!yymatchChar(ctx, '/')) goto l413;
+  {  int yypos416= ctx->pos, yythunkpos416= ctx->thunkpos;  int yyc417= yypeek(ctx);
+  switch (yyc417)
+    {
+     case 115:  goto l414;
+     case 83:  goto l415;
+    default:  goto l413;
+    }
+  l414:;	  if (!yymatchString(ctx, "style")) goto l418;  goto l416;
+  l418:;	  ctx->pos= yypos416; ctx->thunkpos= yythunkpos416;
+  l415:;	  if (!yyfirst(yyc417, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l413;  if (!yymatchString(ctx, "STYLE")) goto l413;
+  }
+  l416:;	  if (!yy_Spnl(ctx)) goto l413;  if (!yymatchChar(ctx, '>')) goto l413;
+  yyprintf((stderr, "  ok   %s @ %s\n", "StyleClose", ctx->buf+ctx->pos));
+  return 1;
+  l413:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StyleClose", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_HtmlAttribute(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlAttribute"));
+  {  int yypos424= ctx->pos, yythunkpos424= ctx->thunkpos;  int yyc425= yypeek(ctx);
+  switch (yyc425)
+    {
+     case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+     case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70:
+     case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78:
+     case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86:
+     case 87: case 88: case 89: case 90: case 97: case 98: case 99: case 100:
+     case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108:
+     case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116:
+     case 117: case 118: case 119: case 120: case 121: case 122:  goto l422;
+     case 45:  goto l423;
+    default:  goto l419;
+    }
+  l422:;	  if (!yy_AlphanumericAscii(ctx)) goto l426;  goto l424;
+  l426:;	  ctx->pos= yypos424; ctx->thunkpos= yythunkpos424;
+  l423:;	  if (!yyfirst(yyc425, (unsigned char *)"\000\000\000\000\000\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l419;  if (!yymatchChar(ctx, '-')) goto l419;
+  }
+  l424:;	
+  l420:;	
+  {  int yypos421= ctx->pos, yythunkpos421= ctx->thunkpos;
+  {  int yypos429= ctx->pos, yythunkpos429= ctx->thunkpos;  int yyc430= yypeek(ctx);
+  switch (yyc430)
+    {
+     case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+     case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70:
+     case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78:
+     case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86:
+     case 87: case 88: case 89: case 90: case 97: case 98: case 99: case 100:
+     case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108:
+     case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116:
+     case 117: case 118: case 119: case 120: case 121: case 122:  goto l427;
+     case 45:  goto l428;
+    default:  goto l421;
+    }
+  l427:;	  if (!yy_AlphanumericAscii(ctx)) goto l431;  goto l429;
+  l431:;	  ctx->pos= yypos429; ctx->thunkpos= yythunkpos429;
+  l428:;	  if (!yyfirst(yyc430, (unsigned char *)"\000\000\000\000\000\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l421;  if (!yymatchChar(ctx, '-')) goto l421;
+  }
+  l429:;	  goto l420;
+  l421:;	  ctx->pos= yypos421; ctx->thunkpos= yythunkpos421;
+  }  if (!yy_Spnl(ctx)) goto l419;
+  {  int yypos432= ctx->pos, yythunkpos432= ctx->thunkpos;  if (!yymatchChar(ctx, '=')) goto l432;  if (!yy_Spnl(ctx)) goto l432;
+  {  int yypos436= ctx->pos, yythunkpos436= ctx->thunkpos;  int yyc437= yypeek(ctx);
+  switch (yyc437)
+    {
+     case 34: case 39:  goto l434;
+    default:  goto l435;
+    }
+  l434:;	  if (!yy_Quoted(ctx)) goto l438;  goto l436;
+  l438:;	  ctx->pos= yypos436; ctx->thunkpos= yythunkpos436;
+  l435:;	
+  {  int yypos441= ctx->pos, yythunkpos441= ctx->thunkpos;  if (!yymatchChar(ctx, '>')) goto l441;  goto l432;
+  l441:;	  ctx->pos= yypos441; ctx->thunkpos= yythunkpos441;
+  }  if (!yy_Nonspacechar(ctx)) goto l432;
+  l439:;	
+  {  int yypos440= ctx->pos, yythunkpos440= ctx->thunkpos;
+  {  int yypos442= ctx->pos, yythunkpos442= ctx->thunkpos;  if (!yymatchChar(ctx, '>')) goto l442;  goto l440;
+  l442:;	  ctx->pos= yypos442; ctx->thunkpos= yythunkpos442;
+  }  if (!yy_Nonspacechar(ctx)) goto l440;  goto l439;
+  l440:;	  ctx->pos= yypos440; ctx->thunkpos= yythunkpos440;
+  }
+  }
+  l436:;	  goto l433;
+  l432:;	  ctx->pos= yypos432; ctx->thunkpos= yythunkpos432;
+  }
+  l433:;	  if (!yy_Spnl(ctx)) goto l419;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlAttribute", ctx->buf+ctx->pos));
+  return 1;
+  l419:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlAttribute", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Spnl(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "Spnl"));  if (!yy_Sp(ctx)) goto l443;
+  {  int yypos444= ctx->pos, yythunkpos444= ctx->thunkpos;  if (!yy_Newline(ctx)) goto l444;  if (!yy_Sp(ctx)) goto l444;  goto l445;
+  l444:;	  ctx->pos= yypos444; ctx->thunkpos= yythunkpos444;
+  }
+  l445:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Spnl", ctx->buf+ctx->pos));
+  return 1;
+  l443:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Spnl", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_StyleOpen(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "StyleOpen"));  if (!yymatchChar(ctx, '<')) goto l446;  if (!yy_Spnl(ctx)) goto l446;
+  {  int yypos449= ctx->pos, yythunkpos449= ctx->thunkpos;  int yyc450= yypeek(ctx);
+  switch (yyc450)
+    {
+     case 115:  goto l447;
+     case 83:  goto l448;
+    default:  goto l446;
+    }
+  l447:;	  if (!yymatchString(ctx, "style")) goto l451;  goto l449;
+  l451:;	  ctx->pos= yypos449; ctx->thunkpos= yythunkpos449;
+  l448:;	  if (!yyfirst(yyc450, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l446;  if (!yymatchString(ctx, "STYLE")) goto l446;
+  }
+  l449:;	  if (!yy_Spnl(ctx)) goto l446;
+  l452:;	
+  {  int yypos453= ctx->pos, yythunkpos453= ctx->thunkpos;  if (!yy_HtmlAttribute(ctx)) goto l453;  goto l452;
+  l453:;	  ctx->pos= yypos453; ctx->thunkpos= yythunkpos453;
+  }  if (!yymatchChar(ctx, '>')) goto l446;
+  yyprintf((stderr, "  ok   %s @ %s\n", "StyleOpen", ctx->buf+ctx->pos));
+  return 1;
+  l446:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StyleOpen", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_HtmlComment(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlComment"));  if (!yymatchString(ctx, "<!--")) goto l454;  if (!( html_comment(ctx) )) goto l454;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlComment", ctx->buf+ctx->pos));
+  return 1;
+  l454:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlComment", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_HtmlScript(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlScript"));  if (!yymatchChar(ctx, '<')) goto l455;  if (!( html_script(ctx) )) goto l455;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlScript", ctx->buf+ctx->pos));
+  return 1;
+  l455:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlScript", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockInTags(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockInTags"));
+  {  int yypos457= ctx->pos, yythunkpos457= ctx->thunkpos;  if (!yymatchChar(ctx, '<')) goto l456;  ctx->pos= yypos457; ctx->thunkpos= yythunkpos457;
+  }  if (!( html_block(ctx) )) goto l456;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockInTags", ctx->buf+ctx->pos));
+  return 1;
+  l456:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockInTags", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_OptionallyIndentedLine(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "OptionallyIndentedLine"));
+  {  int yypos459= ctx->pos, yythunkpos459= ctx->thunkpos;  if (!yy_Indent(ctx)) goto l459;  goto l460;
+  l459:;	  ctx->pos= yypos459; ctx->thunkpos= yythunkpos459;
+  }
+  l460:;	  if (!yy_Line(ctx)) goto l458;
+  yyprintf((stderr, "  ok   %s @ %s\n", "OptionallyIndentedLine", ctx->buf+ctx->pos));
+  return 1;
+  l458:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OptionallyIndentedLine", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Indent(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "Indent"));
+  {  int yypos462= ctx->pos, yythunkpos462= ctx->thunkpos;  if (!yymatchClass(ctx, (unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l461;  ctx->pos= yypos462; ctx->thunkpos= yythunkpos462;
+  }  if (!( indent(ctx) )) goto l461;
+  yyprintf((stderr, "  ok   %s @ %s\n", "Indent", ctx->buf+ctx->pos));
+  return 1;
+  l461:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Indent", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_ListBlockLine(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "ListBlockLine"));
+  {  int yypos464= ctx->pos, yythunkpos464= ctx->thunkpos;  if (!yy_BlankLine(ctx)) goto l464;  goto l463;
+  l464:;	  ctx->pos= yypos464; ctx->thunkpos= yythunkpos464;
+  }
+  {  int yypos465= ctx->pos, yythunkpos465= ctx->thunkpos;
+  {  int yypos466= ctx->pos, yythunkpos466= ctx->thunkpos;  if (!yy_Indent(ctx)) goto l466;  goto l467;
+  l466:;	  ctx->pos= yypos466; ctx->thunkpos= yythunkpos466;
+  }
+  l467:;	
+  {  int yypos470= ctx->pos, yythunkpos470= ctx->thunkpos;  int yyc471= yypeek(ctx);
+  switch (yyc471)
+    {
+     case 32: case 42: case 43: case 45:  goto l468;
+     case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+     case 56: case 57:  goto l469;
+    default:  goto l465;
+    }
+  l468:;	  if (!yy_Bullet(ctx)) goto l472;  goto l470;
+  l472:;	  ctx->pos= yypos470; ctx->thunkpos= yythunkpos470;
+  l469:;	  if (!yyfirst(yyc471, (unsigned char *)"\000\000\000\000\001\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l465;  if (!yy_Enumerator(ctx)) goto l465;
+  }
+  l470:;	  goto l463;
+  l465:;	  ctx->pos= yypos465; ctx->thunkpos= yythunkpos465;
+  }
+  {  int yypos473= ctx->pos, yythunkpos473= ctx->thunkpos;  if (!yy_HorizontalRule(ctx)) goto l473;  goto l463;
+  l473:;	  ctx->pos= yypos473; ctx->thunkpos= yythunkpos473;
+  }  if (!yy_OptionallyIndentedLine(ctx)) goto l463;
+  yyprintf((stderr, "  ok   %s @ %s\n", "ListBlockLine", ctx->buf+ctx->pos));
+  return 1;
+  l463:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ListBlockLine", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_ListContinuationBlock(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "ListContinuationBlock"));  if (!yy_StartList(ctx)) goto l474;  yyDo(ctx, yySet, -1, 0);  if (!(YY_BEGIN)) goto l474;  ctx->marked |= 1;
+  l475:;	
+  {  int yypos476= ctx->pos, yythunkpos476= ctx->thunkpos;  if (!yy_BlankLine(ctx)) goto l476;  goto l475;
+  l476:;	  ctx->pos= yypos476; ctx->thunkpos= yythunkpos476;
+  }  if (!(YY_END)) goto l474;  ctx->marked |= 2;  yyDo(ctx, yy_1_ListContinuationBlock, ctx->begin, ctx->end);  if (!yy_Indent(ctx)) goto l474;  if (!yy_ListBlock(ctx)) goto l474;  yyDo(ctx, yy_2_ListContinuationBlock, ctx->begin, ctx->end);
+  l477:;	
+  {  int yypos478= ctx->pos, yythunkpos478= ctx->thunkpos;  if (!yy_Indent(ctx)) goto l478;  if (!yy_ListBlock(ctx)) goto l478;  yyDo(ctx, yy_2_ListContinuationBlock, ctx->begin, ctx->end);  goto l477;
+  l478:;	  ctx->pos= yypos478; ctx->thunkpos= yythunkpos478;
+  }  yyDo(ctx, yy_3_ListContinuationBlock, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ListContinuationBlock", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 1, 0);
+  return 1;
+  l474:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ListContinuationBlock", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_ListBlock(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "ListBlock"));  if (!yy_StartList(ctx)) goto l479;  yyDo(ctx, yySet, -1, 0);
+  {  int yypos480= ctx->pos, yythunkpos480= ctx->thunkpos;  if (!yy_BlankLine(ctx)) goto l480;  goto l479;
+  l480:;	  ctx->pos= yypos480; ctx->thunkpos= yythunkpos480;
+  }  if (!yy_Line(ctx)) goto l479;  yyDo(ctx, yy_1_ListBlock, ctx->begin, ctx->end);
+  l481:;	
+  {  int yypos482= ctx->pos, yythunkpos482= ctx->thunkpos;  if (!yy_ListBlockLine(ctx)) goto l482;  yyDo(ctx, yy_2_ListBlock, ctx->begin, ctx->end);  goto l481;
+  l482:;	  ctx->pos= yypos482; ctx->thunkpos= yythunkpos482;
+  }  yyDo(ctx, yy_3_ListBlock, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ListBlock", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 1, 0);
+  return 1;
+  l479:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ListBlock", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Enumerator(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "Enumerator"));  if (!yy_NonindentSpace(ctx)) goto l483;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l483;
+  l484:;	
+  {  int yypos485= ctx->pos, yythunkpos485= ctx->thunkpos;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l485;  goto l484;
+  l485:;	  ctx->pos= yypos485; ctx->thunkpos= yythunkpos485;
+  }  if (!yymatchChar(ctx, '.')) goto l483;  if (!yy_Spacechar(ctx)) goto l483;
+  l486:;	
+  {  int yypos487= ctx->pos, yythunkpos487= ctx->thunkpos;  if (!yy_Spacechar(ctx)) goto l487;  goto l486;
+  l487:;	  ctx->pos= yypos487; ctx->thunkpos= yythunkpos487;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "Enumerator", ctx->buf+ctx->pos));
+  return 1;
+  l483:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Enumerator", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_ListItem(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "ListItem"));
+  {  int yypos491= ctx->pos, yythunkpos491= ctx->thunkpos;  int yyc492= yypeek(ctx);
+  switch (yyc492)
+    {
+     case 32: case 42: case 43: case 45:  goto l489;
+     case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+     case 56: case 57:  goto l490;
+    default:  goto l488;
+    }
+  l489:;	  if (!yy_Bullet(ctx)) goto l493;  goto l491;
+  l493:;	  ctx->pos= yypos491; ctx->thunkpos= yythunkpos491;
+  l490:;	  if (!yyfirst(yyc492, (unsigned char *)"\000\000\000\000\001\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l488;  if (!yy_Enumerator(ctx)) goto l488;
+  }
+  l491:;	  if (!yy_StartList(ctx)) goto l488;  yyDo(ctx, yySet, -1, 0);  if (!yy_ListBlock(ctx)) goto l488;  yyDo(ctx, yy_1_ListItem, ctx->begin, ctx->end);
+  l494:;	
+  {  int yypos495= ctx->pos, yythunkpos495= ctx->thunkpos;  if (!yy_ListContinuationBlock(ctx)) goto l495;  yyDo(ctx, yy_2_ListItem, ctx->begin, ctx->end);  goto l494;
+  l495:;	  ctx->pos= yypos495; ctx->thunkpos= yythunkpos495;
+  }  yyDo(ctx, yy_3_ListItem, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ListItem", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 1, 0);
+  return 1;
+  l488:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ListItem", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_List(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "List"));  yyDo(ctx, yy_1_List, ctx->begin, ctx->end);  if (!yy_StartList(ctx)) goto l496;  yyDo(ctx, yySet, -1, 0);  if (!yy_ListItem(ctx)) goto l496;  yyDo(ctx, yy_2_List, ctx->begin, ctx->end);
+  l497:;	
+  {  int yypos498= ctx->pos, yythunkpos498= ctx->thunkpos;
+  {  int yypos499= ctx->pos, yythunkpos499= ctx->thunkpos;  if (!yy_BlankLine(ctx)) goto l499;
+  l501:;	
+  {  int yypos502= ctx->pos, yythunkpos502= ctx->thunkpos;  if (!yy_BlankLine(ctx)) goto l502;  goto l501;
+  l502:;	  ctx->pos= yypos502; ctx->thunkpos= yythunkpos502;
+  }  yyDo(ctx, yy_3_List, ctx->begin, ctx->end);  goto l500;
+  l499:;	  ctx->pos= yypos499; ctx->thunkpos= yythunkpos499;
+  }
+  l500:;	  if (!yy_ListItem(ctx)) goto l498;  yyDo(ctx, yy_4_List, ctx->begin, ctx->end);  goto l497;
+  l498:;	  ctx->pos= yypos498; ctx->thunkpos= yythunkpos498;
+  }
+  l503:;	
+  {  int yypos504= ctx->pos, yythunkpos504= ctx->thunkpos;  if (!yy_BlankLine(ctx)) goto l504;  goto l503;
+  l504:;	  ctx->pos= yypos504; ctx->thunkpos= yythunkpos504;
+  }
+  {  int yypos505= ctx->pos, yythunkpos505= ctx->thunkpos;
+  {  int yypos507= ctx->pos, yythunkpos507= ctx->thunkpos;
+  {  int yypos510= ctx->pos, yythunkpos510= ctx->thunkpos;  int yyc511= yypeek(ctx);
+  switch (yyc511)
+    {
+     case 32: case 42: case 43: case 45:  goto l508;
+     case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+     case 56: case 57:  goto l509;
+    default:  goto l505;
+    }
+  l508:;	  if (!yy_Bullet(ctx)) goto l512;  goto l510;
+  l512:;	  ctx->pos= yypos510; ctx->thunkpos= yythunkpos510;
+  l509:;	  if (!yyfirst(yyc511, (unsigned char *)"\000\000\000\000\001\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l505;  if (!yy_Enumerator(ctx)) goto l505;
+  }
+  l510:;	  ctx->pos= yypos507; ctx->thunkpos= yythunkpos507;
+  }  yyDo(ctx, yy_5_List, ctx->begin, ctx->end);  goto l506;
+  l505:;	  ctx->pos= yypos505; ctx->thunkpos= yythunkpos505;
+  }
+  l506:;	  yyDo(ctx, yy_6_List, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "List", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 1, 0);
+  return 1;
+  l496:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "List", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Spacechar(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "Spacechar"));  if (!yymatchClass(ctx, (unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l513;
+  yyprintf((stderr, "  ok   %s @ %s\n", "Spacechar", ctx->buf+ctx->pos));
+  return 1;
+  l513:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Spacechar", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Bullet(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "Bullet"));
+  {  int yypos515= ctx->pos, yythunkpos515= ctx->thunkpos;  if (!yy_HorizontalRule(ctx)) goto l515;  goto l514;
+  l515:;	  ctx->pos= yypos515; ctx->thunkpos= yythunkpos515;
+  }  if (!yy_NonindentSpace(ctx)) goto l514;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\054\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l514;  if (!yy_Spacechar(ctx)) goto l514;
+  l516:;	
+  {  int yypos517= ctx->pos, yythunkpos517= ctx->thunkpos;  if (!yy_Spacechar(ctx)) goto l517;  goto l516;
+  l517:;	  ctx->pos= yypos517; ctx->thunkpos= yythunkpos517;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "Bullet", ctx->buf+ctx->pos));
+  return 1;
+  l514:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Bullet", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_VerbatimChunk(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "VerbatimChunk"));  if (!yy_StartList(ctx)) goto l518;  yyDo(ctx, yySet, -1, 0);
+  l519:;	
+  {  int yypos520= ctx->pos, yythunkpos520= ctx->thunkpos;  if (!yy_BlankLine(ctx)) goto l520;  yyDo(ctx, yy_1_VerbatimChunk, ctx->begin, ctx->end);  goto l519;
+  l520:;	  ctx->pos= yypos520; ctx->thunkpos= yythunkpos520;
+  }  if (!yy_NonblankIndentedLine(ctx)) goto l518;  yyDo(ctx, yy_2_VerbatimChunk, ctx->begin, ctx->end);
+  l521:;	
+  {  int yypos522= ctx->pos, yythunkpos522= ctx->thunkpos;  if (!yy_NonblankIndentedLine(ctx)) goto l522;  yyDo(ctx, yy_2_VerbatimChunk, ctx->begin, ctx->end);  goto l521;
+  l522:;	  ctx->pos= yypos522; ctx->thunkpos= yythunkpos522;
+  }  yyDo(ctx, yy_3_VerbatimChunk, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "VerbatimChunk", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 1, 0);
+  return 1;
+  l518:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "VerbatimChunk", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_IndentedLine(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "IndentedLine"));  if (!yy_Indent(ctx)) goto l523;  if (!yy_Line(ctx)) goto l523;
+  yyprintf((stderr, "  ok   %s @ %s\n", "IndentedLine", ctx->buf+ctx->pos));
+  return 1;
+  l523:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "IndentedLine", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_NonblankIndentedLine(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "NonblankIndentedLine"));
+  {  int yypos525= ctx->pos, yythunkpos525= ctx->thunkpos;  if (!yy_BlankLine(ctx)) goto l525;  goto l524;
+  l525:;	  ctx->pos= yypos525; ctx->thunkpos= yythunkpos525;
+  }  if (!yy_IndentedLine(ctx)) goto l524;
+  yyprintf((stderr, "  ok   %s @ %s\n", "NonblankIndentedLine", ctx->buf+ctx->pos));
+  return 1;
+  l524:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "NonblankIndentedLine", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Line(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "Line"));  if (!yy_RawLine(ctx)) goto l526;  yyDo(ctx, yy_1_Line, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Line", ctx->buf+ctx->pos));
+  return 1;
+  l526:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Line", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_BlockQuoteRaw(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "BlockQuoteRaw"));  if (!yy_StartList(ctx)) goto l527;  yyDo(ctx, yySet, -1, 0);  if (!yymatchChar(ctx, '>')) goto l527;
+  {  int yypos530= ctx->pos, yythunkpos530= ctx->thunkpos;  if (!yymatchChar(ctx, ' ')) goto l530;  goto l531;
+  l530:;	  ctx->pos= yypos530; ctx->thunkpos= yythunkpos530;
+  }
+  l531:;	  if (!yy_Line(ctx)) goto l527;  yyDo(ctx, yy_1_BlockQuoteRaw, ctx->begin, ctx->end);
+  l532:;	
+  {  int yypos533= ctx->pos, yythunkpos533= ctx->thunkpos;
+  {  int yypos534= ctx->pos, yythunkpos534= ctx->thunkpos;  if (!yymatchChar(ctx, '>')) goto l534;  goto l533;
+  l534:;	  ctx->pos= yypos534; ctx->thunkpos= yythunkpos534;
+  }
+  {  int yypos535= ctx->pos, yythunkpos535= ctx->thunkpos;  if (!yy_BlankLine(ctx)) goto l535;  goto l533;
+  l535:;	  ctx->pos= yypos535; ctx->thunkpos= yythunkpos535;
+  }  if (!yy_Line(ctx)) goto l533;  yyDo(ctx, yy_2_BlockQuoteRaw, ctx->begin, ctx->end);  goto l532;
+  l533:;	  ctx->pos= yypos533; ctx->thunkpos= yythunkpos533;
+  }
+  l536:;	
+  {  int yypos537= ctx->pos, yythunkpos537= ctx->thunkpos;  if (!yy_BlankLine(ctx)) goto l537;  yyDo(ctx, yy_3_BlockQuoteRaw, ctx->begin, ctx->end);  goto l536;
+  l537:;	  ctx->pos= yypos537; ctx->thunkpos= yythunkpos537;
+  }
+  l528:;	
+  {  int yypos529= ctx->pos, yythunkpos529= ctx->thunkpos;  if (!yymatchChar(ctx, '>')) goto l529;
+  {  int yypos538= ctx->pos, yythunkpos538= ctx->thunkpos;  if (!yymatchChar(ctx, ' ')) goto l538;  goto l539;
+  l538:;	  ctx->pos= yypos538; ctx->thunkpos= yythunkpos538;
+  }
+  l539:;	  if (!yy_Line(ctx)) goto l529;  yyDo(ctx, yy_1_BlockQuoteRaw, ctx->begin, ctx->end);
+  l540:;	
+  {  int yypos541= ctx->pos, yythunkpos541= ctx->thunkpos;
+  {  int yypos542= ctx->pos, yythunkpos542= ctx->thunkpos;  if (!yymatchChar(ctx, '>')) goto l542;  goto l541;
+  l542:;	  ctx->pos= yypos542; ctx->thunkpos= yythunkpos542;
+  }
+  {  int yypos543= ctx->pos, yythunkpos543= ctx->thunkpos;  if (!yy_BlankLine(ctx)) goto l543;  goto l541;
+  l543:;	  ctx->pos= yypos543; ctx->thunkpos= yythunkpos543;
+  }  if (!yy_Line(ctx)) goto l541;  yyDo(ctx, yy_2_BlockQuoteRaw, ctx->begin, ctx->end);  goto l540;
+  l541:;	  ctx->pos= yypos541; ctx->thunkpos= yythunkpos541;
+  }
+  l544:;	
+  {  int yypos545= ctx->pos, yythunkpos545= ctx->thunkpos;  if (!yy_BlankLine(ctx)) goto l545;  yyDo(ctx, yy_3_BlockQuoteRaw, ctx->begin, ctx->end);  goto l544;
+  l545:;	  ctx->pos= yypos545; ctx->thunkpos= yythunkpos545;
+  }  goto l528;
+  l529:;	  ctx->pos= yypos529; ctx->thunkpos= yythunkpos529;
+  }  yyDo(ctx, yy_4_BlockQuoteRaw, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "BlockQuoteRaw", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 1, 0);
+  return 1;
+  l527:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "BlockQuoteRaw", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_SetextBottom2(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "SetextBottom2"));  if (!yymatchChar(ctx, '-')) goto l546;
+  l547:;	
+  {  int yypos548= ctx->pos, yythunkpos548= ctx->thunkpos;  if (!yymatchChar(ctx, '-')) goto l548;  goto l547;
+  l548:;	  ctx->pos= yypos548; ctx->thunkpos= yythunkpos548;
+  }  if (!yy_Newline(ctx)) goto l546;
+  yyprintf((stderr, "  ok   %s @ %s\n", "SetextBottom2", ctx->buf+ctx->pos));
+  return 1;
+  l546:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SetextBottom2", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_SetextBottom1(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "SetextBottom1"));  if (!yymatchChar(ctx, '=')) goto l549;
+  l550:;	
+  {  int yypos551= ctx->pos, yythunkpos551= ctx->thunkpos;  if (!yymatchChar(ctx, '=')) goto l551;  goto l550;
+  l551:;	  ctx->pos= yypos551; ctx->thunkpos= yythunkpos551;
+  }  if (!yy_Newline(ctx)) goto l549;
+  yyprintf((stderr, "  ok   %s @ %s\n", "SetextBottom1", ctx->buf+ctx->pos));
+  return 1;
+  l549:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SetextBottom1", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_SetextHeading2(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "SetextHeading2"));  if (!( underlined(ctx) == '-' )) goto l552;  if (!yy_StartList(ctx)) goto l552;  yyDo(ctx, yySet, -1, 0);
+  {  int yypos555= ctx->pos, yythunkpos555= ctx->thunkpos;  if (!yy_Endline(ctx)) goto l555;  goto l552;
+  l555:;	  ctx->pos= yypos555; ctx->thunkpos= yythunkpos555;
+  }  if (!yy_Inline(ctx)) goto l552;  yyDo(ctx, yy_1_SetextHeading2, ctx->begin, ctx->end);
+  l553:;	
+  {  int yypos554= ctx->pos, yythunkpos554= ctx->thunkpos;
+  {  int yypos556= ctx->pos, yythunkpos556= ctx->thunkpos;  if (!yy_Endline(ctx)) goto l556;  goto l554;
+  l556:;	  ctx->pos= yypos556; ctx->thunkpos= yythunkpos556;
+  }  if (!yy_Inline(ctx)) goto l554;  yyDo(ctx, yy_1_SetextHeading2, ctx->begin, ctx->end);  goto l553;
+  l554:;	  ctx->pos= yypos554; ctx->thunkpos= yythunkpos554;
+  }  if (!yy_Sp(ctx)) goto l552;  if (!yy_Newline(ctx)) goto l552;  if (!yy_SetextBottom2(ctx)) goto l552;  yyDo(ctx, yy_2_SetextHeading2, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "SetextHeading2", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 1, 0);
+  return 1;
+  l552:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SetextHeading2", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_SetextHeading1(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "SetextHeading1"));  if (!( underlined(ctx) == '=' )) goto l557;  if (!yy_StartList(ctx)) goto l557;  yyDo(ctx, yySet, -1, 0);
+  {  int yypos560= ctx->pos, yythunkpos560= ctx->thunkpos;  if (!yy_Endline(ctx)) goto l560;  goto l557;
+  l560:;	  ctx->pos= yypos560; ctx->thunkpos= yythunkpos560;
+  }  if (!yy_Inline(ctx)) goto l557;  yyDo(ctx, yy_1_SetextHeading1, ctx->begin, ctx->end);
+  l558:;	
+  {  int yypos559= ctx->pos, yythunkpos559= ctx->thunkpos;
+  {  int yypos561= ctx->pos, yythunkpos561= ctx->thunkpos;  if (!yy_Endline(ctx)) goto l561;  goto l559;
+  l561:;	  ctx->pos= yypos561; ctx->thunkpos= yythunkpos561;
+  }  if (!yy_Inline(ctx)) goto l559;  yyDo(ctx, yy_1_SetextHeading1, ctx->begin, ctx->end);  goto l558;
+  l559:;	  ctx->pos= yypos559; ctx->thunkpos= yythunkpos559;
+  }  if (!yy_Sp(ctx)) goto l557;  if (!yy_Newline(ctx)) goto l557;  if (!yy_SetextBottom1(ctx)) goto l557;  yyDo(ctx, yy_2_SetextHeading1, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "SetextHeading1", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 1, 0);
+  return 1;
+  l557:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SetextHeading1", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_SetextHeading(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "SetextHeading"));
+  {  int yypos565= ctx->pos, yythunkpos565= ctx->thunkpos;  if (!yy_SetextHeading1(ctx)) goto l566;  goto l565;
+  l566:;	  ctx->pos= yypos565; ctx->thunkpos= yythunkpos565;  if (!yy_SetextHeading2(ctx)) goto l562;
+  }
+  l565:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "SetextHeading", ctx->buf+ctx->pos));
+  return 1;
+  l562:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SetextHeading", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_AtxHeading(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "AtxHeading"));  if (!yy_AtxStart(ctx)) goto l567;  yyDo(ctx, yySet, -2, 0);  if (!yy_Sp(ctx)) goto l567;  if (!yy_StartList(ctx)) goto l567;  yyDo(ctx, yySet, -1, 0);  if (!yy_AtxInline(ctx)) goto l567;  yyDo(ctx, yy_1_AtxHeading, ctx->begin, ctx->end);
+  l568:;	
+  {  int yypos569= ctx->pos, yythunkpos569= ctx->thunkpos;  if (!yy_AtxInline(ctx)) goto l569;  yyDo(ctx, yy_1_AtxHeading, ctx->begin, ctx->end);  goto l568;
+  l569:;	  ctx->pos= yypos569; ctx->thunkpos= yythunkpos569;
+  }
+  {  int yypos570= ctx->pos, yythunkpos570= ctx->thunkpos;  if (!yy_Sp(ctx)) goto l570;
+  l572:;	
+  {  int yypos573= ctx->pos, yythunkpos573= ctx->thunkpos;  if (!yymatchChar(ctx, '#')) goto l573;  goto l572;
+  l573:;	  ctx->pos= yypos573; ctx->thunkpos= yythunkpos573;
+  }  if (!yy_Sp(ctx)) goto l570;  goto l571;
+  l570:;	  ctx->pos= yypos570; ctx->thunkpos= yythunkpos570;
+  }
+  l571:;	  if (!yy_Newline(ctx)) goto l567;  yyDo(ctx, yy_2_AtxHeading, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "AtxHeading", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 2, 0);
+  return 1;
+  l567:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AtxHeading", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_AtxStart(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "AtxStart"));  if (!(YY_BEGIN)) goto l574;  ctx->marked |= 1;
+  {  int yypos581= ctx->pos, yythunkpos581= ctx->thunkpos;  int yyc582= yypeek(ctx);
+  switch (yyc582)
+    {
+     case 35:  goto l575;
+    default:  goto l574;
+    }
+  l575:;	  if (!yymatchString(ctx, "######")) goto l583;  goto l581;
+  l583:;	  ctx->pos= yypos581; ctx->thunkpos= yythunkpos581;  if (!yyfirst(yyc582, (unsigned char *)"\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l577;  if (!yymatchString(ctx, "#####")) goto l584;  goto l581;
+  l584:;	  ctx->pos= yypos581; ctx->thunkpos= yythunkpos581;
+  l577:;	  if (!yyfirst(yyc582, (unsigned char *)"\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l578;  if (!yymatchString(ctx, "####")) goto l585;  goto l581;
+  l585:;	  ctx->pos= yypos581; ctx->thunkpos= yythunkpos581;
+  l578:;	  if (!yyfirst(yyc582, (unsigned char *)"\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l579;  if (!yymatchString(ctx, "###")) goto l586;  goto l581;
+  l586:;	  ctx->pos= yypos581; ctx->thunkpos= yythunkpos581;
+  l579:;	  if (!yyfirst(yyc582, (unsigned char *)"\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l580;  if (!yymatchString(ctx, "##")) goto l587;  goto l581;
+  l587:;	  ctx->pos= yypos581; ctx->thunkpos= yythunkpos581;
+  l580:;	  if (!yyfirst(yyc582, (unsigned char *)"\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l574;  if (!yymatchChar(ctx, '#')) goto l574;
+  }
+  l581:;	  if (!(YY_END)) goto l574;  ctx->marked |= 2;  yyDo(ctx, yy_1_AtxStart, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "AtxStart", ctx->buf+ctx->pos));
+  return 1;
+  l574:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AtxStart", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Sp(yycontext *ctx)
+{
+  yyprintf((stderr, "%s\n", "Sp"));
+  l589:;	
+  {  int yypos590= ctx->pos, yythunkpos590= ctx->thunkpos;  if (!yy_Spacechar(ctx)) goto l590;  goto l589;
+  l590:;	  ctx->pos= yypos590; ctx->thunkpos= yythunkpos590;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "Sp", ctx->buf+ctx->pos));
+  return 1;
+}
+YY_RULE(int) yy_Newline(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "Newline"));
+  {  int yypos594= ctx->pos, yythunkpos594= ctx->thunkpos;  int yyc595= yypeek(ctx);
+  switch (yyc595)
+    {
+     case 10:  goto l592;
+     case 13:  goto l593;
+    default:  goto l591;
+    }
+  l592:;	  if (!yymatchChar(ctx, '\n')) goto l596;  goto l594;
+  l596:;	  ctx->pos= yypos594; ctx->thunkpos= yythunkpos594;
+  l593:;	  if (!yyfirst(yyc595, (unsigned char *)"\000\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l591;  if (!yymatchChar(ctx, '\r')) goto l591;
+  {  int yypos597= ctx->pos, yythunkpos597= ctx->thunkpos;  if (!yymatchChar(ctx, '\n')) goto l597;  goto l598;
+  l597:;	  ctx->pos= yypos597; ctx->thunkpos= yythunkpos597;
+  }
+  l598:;	
+  }
+  l594:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Newline", ctx->buf+ctx->pos));
+  return 1;
+  l591:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Newline", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_AtxInline(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "AtxInline"));
+  {  int yypos600= ctx->pos, yythunkpos600= ctx->thunkpos;  if (!yy_Newline(ctx)) goto l600;  goto l599;
+  l600:;	  ctx->pos= yypos600; ctx->thunkpos= yythunkpos600;
+  }
+  {  int yypos601= ctx->pos, yythunkpos601= ctx->thunkpos;  if (!yy_Sp(ctx)) goto l601;
+  l602:;	
+  {  int yypos603= ctx->pos, yythunkpos603= ctx->thunkpos;  if (!yymatchChar(ctx, '#')) goto l603;  goto l602;
+  l603:;	  ctx->pos= yypos603; ctx->thunkpos= yythunkpos603;
+  }  if (!yy_Sp(ctx)) goto l601;  if (!yy_Newline(ctx)) goto l601;  goto l599;
+  l601:;	  ctx->pos= yypos601; ctx->thunkpos= yythunkpos601;
+  }  if (!yy_Inline(ctx)) goto l599;
+  yyprintf((stderr, "  ok   %s @ %s\n", "AtxInline", ctx->buf+ctx->pos));
+  return 1;
+  l599:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AtxInline", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_NonindentSpace(yycontext *ctx)
+{
+  yyprintf((stderr, "%s\n", "NonindentSpace"));
+  {  int yypos605= ctx->pos, yythunkpos605= ctx->thunkpos;
+  {  int yypos607= ctx->pos, yythunkpos607= ctx->thunkpos;  if (!yymatchChar(ctx, ' ')) goto l605;  ctx->pos= yypos607; ctx->thunkpos= yythunkpos607;
+  }  if (!( nonindent_space(ctx) )) goto l605;  goto l606;
+  l605:;	  ctx->pos= yypos605; ctx->thunkpos= yythunkpos605;
+  }
+  l606:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "NonindentSpace", ctx->buf+ctx->pos));
+  return 1;
+}
+YY_RULE(int) yy_Inlines(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "Inlines"));  if (!yy_StartList(ctx)) goto l608;  yyDo(ctx, yySet, -2, 0);
+  {  int yypos613= ctx->pos, yythunkpos613= ctx->thunkpos;  int yyc614= yypeek(ctx);
+  switch (yyc614)
+    {
+    default:  goto l611;
+    }
+  l611:;	
+  {  int yypos616= ctx->pos, yythunkpos616= ctx->thunkpos;  if (!yy_Endline(ctx)) goto l616;  goto l615;
+  l616:;	  ctx->pos= yypos616; ctx->thunkpos= yythunkpos616;
+  }  if (!yy_Inline(ctx)) goto l615;  yyDo(ctx, yy_1_Inlines, ctx->begin, ctx->end);  goto l613;
+  l615:;	  ctx->pos= yypos613; ctx->thunkpos= yythunkpos613;  if (!yyfirst(yyc614, (unsigned char *)"\000\046\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l608;  if (!yy_Endline(ctx)) goto l608;  yyDo(ctx, yySet, -1, 0);
+  {  int yypos617= ctx->pos, yythunkpos617= ctx->thunkpos;  if (!yy_Inline(ctx)) goto l608;  ctx->pos= yypos617; ctx->thunkpos= yythunkpos617;
+  }  yyDo(ctx, yy_2_Inlines, ctx->begin, ctx->end);
+  }
+  l613:;	
+  l609:;	
+  {  int yypos610= ctx->pos, yythunkpos610= ctx->thunkpos;
+  {  int yypos620= ctx->pos, yythunkpos620= ctx->thunkpos;  int yyc621= yypeek(ctx);
+  switch (yyc621)
+    {
+    default:  goto l618;
+    }
+  l618:;	
+  {  int yypos623= ctx->pos, yythunkpos623= ctx->thunkpos;  if (!yy_Endline(ctx)) goto l623;  goto l622;
+  l623:;	  ctx->pos= yypos623; ctx->thunkpos= yythunkpos623;
+  }  if (!yy_Inline(ctx)) goto l622;  yyDo(ctx, yy_1_Inlines, ctx->begin, ctx->end);  goto l620;
+  l622:;	  ctx->pos= yypos620; ctx->thunkpos= yythunkpos620;  if (!yyfirst(yyc621, (unsigned char *)"\000\046\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l610;  if (!yy_Endline(ctx)) goto l610;  yyDo(ctx, yySet, -1, 0);
+  {  int yypos624= ctx->pos, yythunkpos624= ctx->thunkpos;  if (!yy_Inline(ctx)) goto l610;  ctx->pos= yypos624; ctx->thunkpos= yythunkpos624;
+  }  yyDo(ctx, yy_2_Inlines, ctx->begin, ctx->end);
+  }
+  l620:;	  goto l609;
+  l610:;	  ctx->pos= yypos610; ctx->thunkpos= yythunkpos610;
+  }
+  {  int yypos625= ctx->pos, yythunkpos625= ctx->thunkpos;  if (!yy_Endline(ctx)) goto l625;  goto l626;
+  l625:;	  ctx->pos= yypos625; ctx->thunkpos= yythunkpos625;
+  }
+  l626:;	  yyDo(ctx, yy_3_Inlines, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Inlines", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 2, 0);
+  return 1;
+  l608:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Inlines", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Plain(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Plain"));  if (!yy_Inlines(ctx)) goto l627;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_1_Plain, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Plain", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 1, 0);
+  return 1;
+  l627:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Plain", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Para(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Para"));
+  {  int yypos631= ctx->pos, yythunkpos631= ctx->thunkpos;
+  {  int yypos633= ctx->pos, yythunkpos633= ctx->thunkpos;  if (!yymatchChar(ctx, ' ')) goto l633;  goto l632;
+  l633:;	  ctx->pos= yypos633; ctx->thunkpos= yythunkpos633;
+  }  if (!yy_Inlines(ctx)) goto l632;  yyDo(ctx, yySet, -1, 0);
+  {  int yypos636= ctx->pos, yythunkpos636= ctx->thunkpos;  int yyc637= yypeek(ctx);
+  switch (yyc637)
+    {
+     case 9: case 10: case 13: case 32:  goto l634;
+    default:  goto l635;
+    }
+  l634:;	  if (!yy_BlankLine(ctx)) goto l638;
+  l639:;	
+  {  int yypos640= ctx->pos, yythunkpos640= ctx->thunkpos;  if (!yy_BlankLine(ctx)) goto l640;  goto l639;
+  l640:;	  ctx->pos= yypos640; ctx->thunkpos= yythunkpos640;
+  }  yyDo(ctx, yy_1_Para, ctx->begin, ctx->end);  goto l636;
+  l638:;	  ctx->pos= yypos636; ctx->thunkpos= yythunkpos636;
+  l635:;	  yyDo(ctx, yy_2_Para, ctx->begin, ctx->end);
+  }
+  l636:;	  goto l631;
+  l632:;	  ctx->pos= yypos631; ctx->thunkpos= yythunkpos631;  if (!yy_NonindentSpace(ctx)) goto l628;  if (!yy_Inlines(ctx)) goto l628;  yyDo(ctx, yySet, -1, 0);  if (!yy_BlankLine(ctx)) goto l628;
+  l641:;	
+  {  int yypos642= ctx->pos, yythunkpos642= ctx->thunkpos;  if (!yy_BlankLine(ctx)) goto l642;  goto l641;
+  l642:;	  ctx->pos= yypos642; ctx->thunkpos= yythunkpos642;
+  }  yyDo(ctx, yy_3_Para, ctx->begin, ctx->end);
+  }
+  l631:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Para", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 1, 0);
+  return 1;
+  l628:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Para", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_StyleBlock(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "StyleBlock"));  if (!(YY_BEGIN)) goto l643;  ctx->marked |= 1;  if (!yy_InStyleTags(ctx)) goto l643;  if (!(YY_END)) goto l643;  ctx->marked |= 2;
+  l644:;	
+  {  int yypos645= ctx->pos, yythunkpos645= ctx->thunkpos;  if (!yy_BlankLine(ctx)) goto l645;  goto l644;
+  l645:;	  ctx->pos= yypos645; ctx->thunkpos= yythunkpos645;
+  }  yyDo(ctx, yy_1_StyleBlock, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "StyleBlock", ctx->buf+ctx->pos));
+  return 1;
+  l643:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StyleBlock", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlock(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlock"));  if (!(YY_BEGIN)) goto l646;  ctx->marked |= 1;
+  {  int yypos649= ctx->pos, yythunkpos649= ctx->thunkpos;  int yyc650= yypeek(ctx);
+  switch (yyc650)
+    {
+     case 60:  goto l647;
+    default:  goto l646;
+    }
+  l647:;	  if (!yy_HtmlBlockInTags(ctx)) goto l651;  goto l649;
+  l651:;	  ctx->pos= yypos649; ctx->thunkpos= yythunkpos649;  if (!yyfirst(yyc650, (unsigned char *)"\000\000\000\000\000\000\000\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l646;  if (!yy_HtmlComment(ctx)) goto l646;
+  }
+  l649:;	  if (!(YY_END)) goto l646;  ctx->marked |= 2;  if (!yy_BlankLine(ctx)) goto l646;
+  l652:;	
+  {  int yypos653= ctx->pos, yythunkpos653= ctx->thunkpos;  if (!yy_BlankLine(ctx)) goto l653;  goto l652;
+  l653:;	  ctx->pos= yypos653; ctx->thunkpos= yythunkpos653;
+  }  yyDo(ctx, yy_1_HtmlBlock, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlock", ctx->buf+ctx->pos));
+  return 1;
+  l646:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlock", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_BulletList(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "BulletList"));
+  {  int yypos655= ctx->pos, yythunkpos655= ctx->thunkpos;  if (!yy_Bullet(ctx)) goto l654;  ctx->pos= yypos655; ctx->thunkpos= yythunkpos655;
+  }  if (!yy_List(ctx)) goto l654;  yyDo(ctx, yy_1_BulletList, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "BulletList", ctx->buf+ctx->pos));
+  return 1;
+  l654:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "BulletList", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_OrderedList(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "OrderedList"));
+  {  int yypos657= ctx->pos, yythunkpos657= ctx->thunkpos;  if (!yy_Enumerator(ctx)) goto l656;  ctx->pos= yypos657; ctx->thunkpos= yythunkpos657;
+  }  if (!yy_List(ctx)) goto l656;  yyDo(ctx, yy_1_OrderedList, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "OrderedList", ctx->buf+ctx->pos));
+  return 1;
+  l656:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OrderedList", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Heading(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "Heading"));
+  {  int yypos661= ctx->pos, yythunkpos661= ctx->thunkpos;  int yyc662= yypeek(ctx);
+  switch (yyc662)
+    {
+    default:  goto l659;
+    }
+  l659:;	  if (!yy_SetextHeading(ctx)) goto l663;  goto l661;
+  l663:;	  ctx->pos= yypos661; ctx->thunkpos= yythunkpos661;  if (!yyfirst(yyc662, (unsigned char *)"\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l658;  if (!yy_AtxHeading(ctx)) goto l658;
+  }
+  l661:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Heading", ctx->buf+ctx->pos));
+  return 1;
+  l658:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Heading", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_HorizontalRule(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "HorizontalRule"));  if (!( rule_line(ctx) )) goto l664;  if (!yy_NonindentSpace(ctx)) goto l664;
+  {  int yypos668= ctx->pos, yythunkpos668= ctx->thunkpos;  int yyc669= yypeek(ctx);
+  switch (yyc669)
+    {
+     case 42:  goto l665;
+     case 45:  goto l666;
+     case 95:  goto l667;
+    default:  goto l664;
+    }
+  l665:;	  if (!yymatchChar(ctx, '*')) goto l670;  if (!yy_Sp(ctx)) goto l670;  if (!yymatchChar(ctx, '*')) goto l670;  if (!yy_Sp(ctx)) goto l670;  if (!yymatchChar(ctx, '*')) goto l670;
+  l671:;	
+  {  int yypos672= ctx->pos, yythunkpos672= ctx->thunkpos;  if (!yy_Sp(ctx)) goto l672;  if (!yymatchChar(ctx, '*')) goto l672;  goto l671;
+  l672:;	  ctx->pos= yypos672; ctx->thunkpos= yythunkpos672;
+  }  goto l668;
+  l670:;	  ctx->pos= yypos668; ctx->thunkpos= yythunkpos668;
+  l666:;	  if (!yyfirst(yyc669, (unsigned char *)"\000\000\000\000\000\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l667;  if (!yymatchChar(ctx, '-')) goto l673;  if (!yy_Sp(ctx)) goto l673;  if (!yymatchChar(ctx, '-')) goto l673;  if (!yy_Sp(ctx)) goto l673;  if (!yymatchChar(ctx, '-')) goto l673;
+  l674:;	
+  {  int yypos675= ctx->pos, yythunkpos675= ctx->thunkpos;  if (!yy_Sp(ctx)) goto l675;  if (!yymatchChar(ctx, '-')) goto l675;  goto l674;
+  l675:;	  ctx->pos= yypos675; ctx->thunkpos= yythunkpos675;
+  }  goto l668;
+  l673:;	  ctx->pos= yypos668; ctx->thunkpos= yythunkpos668;
+  l667:;	  if (!yyfirst(yyc669, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l664;  if (!yymatchChar(ctx, '_')) goto l664;  if (!yy_Sp(ctx)) goto l664;  if (!yymatchChar(ctx, '_')) goto l664;  if (!yy_Sp(ctx)) goto l664;  if (!yymatchChar(ctx, '_')) goto l664;
+  l676:;	
+  {  int yypos677= ctx->pos, yythunkpos677= ctx->thunkpos;  if (!yy_Sp(ctx)) goto l677;  if (!yymatchChar(ctx, '_')) goto l677;  goto l676;
+  l677:;	  ctx->pos= yypos677; ctx->thunkpos= yythunkpos677;
+  }
+  }
+  l668:;	  if (!yy_Sp(ctx)) goto l664;  if (!yy_Newline(ctx)) goto l664;  if (!yy_BlankLine(ctx)) goto l664;
+  l678:;	
+  {  int yypos679= ctx->pos, yythunkpos679= ctx->thunkpos;  if (!yy_BlankLine(ctx)) goto l679;  goto l678;
+  l679:;	  ctx->pos= yypos679; ctx->thunkpos= yythunkpos679;
+  }  yyDo(ctx, yy_1_HorizontalRule, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "HorizontalRule", ctx->buf+ctx->pos));
+  return 1;
+  l664:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HorizontalRule", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Reference(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 3, 0);
+  yyprintf((stderr, "%s\n", "Reference"));  if (!yy_NonindentSpace(ctx)) goto l680;
+  {  int yypos681= ctx->pos, yythunkpos681= ctx->thunkpos;  if (!yymatchString(ctx, "[]")) goto l681;  goto l680;
+  l681:;	  ctx->pos= yypos681; ctx->thunkpos= yythunkpos681;
+  }  if (!yy_Label(ctx)) goto l680;  yyDo(ctx, yySet, -3, 0);  if (!yymatchChar(ctx, ':')) goto l680;  if (!yy_Spnl(ctx)) goto l680;  if (!yy_RefSrc(ctx)) goto l680;  yyDo(ctx, yySet, -2, 0);  if (!yy_RefTitle(ctx)) goto l680;  yyDo(ctx, yySet, -1, 0);  if (!yy_BlankLine(ctx)) goto l680;
+  l682:;	
+  {  int yypos683= ctx->pos, yythunkpos683= ctx->thunkpos;  if (!yy_BlankLine(ctx)) goto l683;  goto l682;
+  l683:;	  ctx->pos= yypos683; ctx->thunkpos= yythunkpos683;
+  }  yyDo(ctx, yy_1_Reference, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Reference", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 3, 0);
+  return 1;
+  l680:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Reference", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Note(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "Note"));  if (!( extension(EXT_NOTES) )) goto l684;  if (!yy_NonindentSpace(ctx)) goto l684;  if (!yy_RawNoteReference(ctx)) goto l684;  yyDo(ctx, yySet, -2, 0);  if (!yymatchChar(ctx, ':')) goto l684;  if (!yy_Sp(ctx)) goto l684;  if (!yy_StartList(ctx)) goto l684;  yyDo(ctx, yySet, -1, 0);  if (!yy_RawNoteBlock(ctx)) goto l684;  yyDo(ctx, yy_1_Note, ctx->begin, ctx->end);
+  l685:;	
+  {  int yypos686= ctx->pos, yythunkpos686= ctx->thunkpos;
+  {  int yypos687= ctx->pos, yythunkpos687= ctx->thunkpos;  if (!yy_Indent(ctx)) goto l686;  ctx->pos= yypos687; ctx->thunkpos= yythunkpos687;
+  }  if (!yy_RawNoteBlock(ctx)) goto l686;  yyDo(ctx, yy_2_Note, ctx->begin, ctx->end);  goto l685;
+  l686:;	  ctx->pos= yypos686; ctx->thunkpos= yythunkpos686;
+  }  yyDo(ctx, yy_3_Note, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Note", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 2, 0);
+  return 1;
+  l684:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Note", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Verbatim(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Verbatim"));  if (!yy_StartList(ctx)) goto l688;  yyDo(ctx, yySet, -1, 0);  if (!yy_VerbatimChunk(ctx)) goto l688;  yyDo(ctx, yy_1_Verbatim, ctx->begin, ctx->end);
+  l689:;	
+  {  int yypos690= ctx->pos, yythunkpos690= ctx->thunkpos;  if (!yy_VerbatimChunk(ctx)) goto l690;  yyDo(ctx, yy_1_Verbatim, ctx->begin, ctx->end);  goto l689;
+  l690:;	  ctx->pos= yypos690; ctx->thunkpos= yythunkpos690;
+  }  yyDo(ctx, yy_2_Verbatim, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Verbatim", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 1, 0);
+  return 1;
+  l688:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Verbatim", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_BlockQuote(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "BlockQuote"));  if (!yy_BlockQuoteRaw(ctx)) goto l691;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_1_BlockQuote, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "BlockQuote", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 1, 0);
+  return 1;
+  l691:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "BlockQuote", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_BlockBody(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "BlockBody"));
+  {  int yypos705= ctx->pos, yythunkpos705= ctx->thunkpos;  int yyc706= yypeek(ctx);
+  switch (yyc706)
+    {
+    default:  goto l693;
+    }
+  l693:;	  if (!yy_BlockQuote(ctx)) goto l707;  goto l705;
+  l707:;	  ctx->pos= yypos705; ctx->thunkpos= yythunkpos705;  if (!yy_Verbatim(ctx)) goto l708;  goto l705;
+  l708:;	  ctx->pos= yypos705; ctx->thunkpos= yythunkpos705;  if (!yy_Note(ctx)) goto l709;  goto l705;
+  l709:;	  ctx->pos= yypos705; ctx->thunkpos= yythunkpos705;  if (!yyfirst(yyc706, (unsigned char *)"\000\000\000\000\001\000\000\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l697;  if (!yy_Reference(ctx)) goto l710;  goto l705;
+  l710:;	  ctx->pos= yypos705; ctx->thunkpos= yythunkpos705;
+  l697:;	  if (!yy_HorizontalRule(ctx)) goto l711;  goto l705;
+  l711:;	  ctx->pos= yypos705; ctx->thunkpos= yythunkpos705;  if (!yy_Heading(ctx)) goto l712;  goto l705;
+  l712:;	  ctx->pos= yypos705; ctx->thunkpos= yythunkpos705;  if (!yyfirst(yyc706, (unsigned char *)"\000\000\000\000\001\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l700;  if (!yy_OrderedList(ctx)) goto l713;  goto l705;
+  l713:;	  ctx->pos= yypos705; ctx->thunkpos= yythunkpos705;
+  l700:;	  if (!yyfirst(yyc706, (unsigned char *)"\000\000\000\000\001\054\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l701;  if (!yy_BulletList(ctx)) goto l714;  goto l705;
+  l714:;	  ctx->pos= yypos705; ctx->thunkpos= yythunkpos705;
+  l701:;	  if (!yyfirst(yyc706, (unsigned char *)"\000\000\000\000\000\000\000\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l702;  if (!yy_HtmlBlock(ctx)) goto l715;  goto l705;
+  l715:;	  ctx->pos= yypos705; ctx->thunkpos= yythunkpos705;
+  l702:;	  if (!yyfirst(yyc706, (unsigned char *)"\000\000\000\000\000\000\000\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l703;  if (!yy_StyleBlock(ctx)) goto l716;  goto l705;
+  l716:;	  ctx->pos= yypos705; ctx->thunkpos= yythunkpos705;
+  l703:;	  if (!yy_Para(ctx)) goto l717;  goto l705;
+  l717:;	  ctx->pos= yypos705; ctx->thunkpos= yythunkpos705;  if (!yy_Plain(ctx)) goto l692;
+  }
+  l705:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "BlockBody", ctx->buf+ctx->pos));
+  return 1;
+  l692:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "BlockBody", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_BlockTry(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "BlockTry"));
+  {  int yypos723= ctx->pos, yythunkpos723= ctx->thunkpos;  if (!yy_BlockBody(ctx)) goto l724;  if (!( !ctx->nomem )) goto l724;  goto l723;
+  l724:;	  ctx->pos= yypos723; ctx->thunkpos= yythunkpos723;  if (!( retry_block(ctx, yy_BlockBody) )) goto l725;  if (!yy_BlockBody(ctx)) goto l725;  if (!( !ctx->nomem )) goto l725;  goto l723;
+  l725:;	  ctx->pos= yypos723; ctx->thunkpos= yythunkpos723;  if (!( flatten_block(ctx, FLAT_EMPHASIS) )) goto l726;  if (!yy_BlockBody(ctx)) goto l726;  if (!( !ctx->nomem )) goto l726;  goto l723;
+  l726:;	  ctx->pos= yypos723; ctx->thunkpos= yythunkpos723;  if (!( flatten_block(ctx, FLAT_INLINES) )) goto l718;  if (!yy_BlockBody(ctx)) goto l718;  if (!( !ctx->nomem )) goto l718;
+  }
+  l723:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "BlockTry", ctx->buf+ctx->pos));
+  return 1;
+  l718:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "BlockTry", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_BlankLine(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "BlankLine"));
+  {  int yypos728= ctx->pos, yythunkpos728= ctx->thunkpos;  if (!yymatchClass(ctx, (unsigned char *)"\000\046\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l727;  ctx->pos= yypos728; ctx->thunkpos= yythunkpos728;
+  }  if (!( line_blank(ctx) )) goto l727;  if (!yy_Newline(ctx)) goto l727;
+  yyprintf((stderr, "  ok   %s @ %s\n", "BlankLine", ctx->buf+ctx->pos));
+  return 1;
+  l727:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "BlankLine", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Block(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "Block"));
+  l730:;	
+  {  int yypos731= ctx->pos, yythunkpos731= ctx->thunkpos;  if (!yy_BlankLine(ctx)) goto l731;  goto l730;
+  l731:;	  ctx->pos= yypos731; ctx->thunkpos= yythunkpos731;
+  }  if (!( begin_block(ctx) )) goto l729;  if (!yy_BlockTry(ctx)) goto l729;
+  yyprintf((stderr, "  ok   %s @ %s\n", "Block", ctx->buf+ctx->pos));
+  return 1;
+  l729:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Block", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_SegmentEnd(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "SegmentEnd"));  if (!( at_segment_end() )) goto l732;
+  yyprintf((stderr, "  ok   %s @ %s\n", "SegmentEnd", ctx->buf+ctx->pos));
+  return 1;
+  l732:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SegmentEnd", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_StartList(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "StartList"));
+  {  int yypos734= ctx->pos, yythunkpos734= ctx->thunkpos;  if (!yymatchDot(ctx)) goto l733;  ctx->pos= yypos734; ctx->thunkpos= yythunkpos734;
+  }  yyDo(ctx, yy_1_StartList, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "StartList", ctx->buf+ctx->pos));
+  return 1;
+  l733:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StartList", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Blocks(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Blocks"));  if (!yy_StartList(ctx)) goto l735;  yyDo(ctx, yySet, -1, 0);
+  l736:;	
+  {  int yypos737= ctx->pos, yythunkpos737= ctx->thunkpos;
+  {  int yypos738= ctx->pos, yythunkpos738= ctx->thunkpos;  if (!yy_SegmentEnd(ctx)) goto l738;  goto l737;
+  l738:;	  ctx->pos= yypos738; ctx->thunkpos= yythunkpos738;
+  }  if (!yy_Block(ctx)) goto l737;  yyDo(ctx, yy_1_Blocks, ctx->begin, ctx->end);  goto l736;
+  l737:;	  ctx->pos= yypos737; ctx->thunkpos= yythunkpos737;
+  }  yyDo(ctx, yy_2_Blocks, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Blocks", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 1, 0);
+  return 1;
+  l735:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Blocks", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_BOM(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "BOM"));  if (!yymatchString(ctx, "\357\273\277")) goto l739;
+  yyprintf((stderr, "  ok   %s @ %s\n", "BOM", ctx->buf+ctx->pos));
+  return 1;
+  l739:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "BOM", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Doc(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "Doc"));
+  {  int yypos741= ctx->pos, yythunkpos741= ctx->thunkpos;  if (!yy_BOM(ctx)) goto l741;  goto l742;
+  l741:;	  ctx->pos= yypos741; ctx->thunkpos= yythunkpos741;
+  }
+  l742:;	  if (!yy_Blocks(ctx)) goto l740;
+  yyprintf((stderr, "  ok   %s @ %s\n", "Doc", ctx->buf+ctx->pos));
+  return 1;
+  l740:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Doc", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_StrikeTail(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  int yymarked0= ctx->marked;
+  { int yyok= yyRecall(ctx, 8);  if (yyok >= 0) return yyok; }  ctx->marked= 0;  yyDo(ctx, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "StrikeTail"));
+  {  int yypos746= ctx->pos, yythunkpos746= ctx->thunkpos;  int yyc747= yypeek(ctx);
+  switch (yyc747)
+    {
+    default:  goto l744;
+    }
+  l744:;	
+  {  int yypos749= ctx->pos, yythunkpos749= ctx->thunkpos;  if (!yymatchString(ctx, "~~")) goto l749;  goto l748;
+  l749:;	  ctx->pos= yypos749; ctx->thunkpos= yythunkpos749;
+  }  if (!yy_Inline(ctx)) goto l748;  yyDo(ctx, yySet, -2, 0);  if (!yy_StrikeTail(ctx)) goto l748;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_1_StrikeTail, ctx->begin, ctx->end);  goto l746;
+  l748:;	  ctx->pos= yypos746; ctx->thunkpos= yythunkpos746;  if (!yyfirst(yyc747, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\100\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l743;  if (!yymatchString(ctx, "~~")) goto l743;  yyDo(ctx, yy_2_StrikeTail, ctx->begin, ctx->end);
+  }
+  l746:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "StrikeTail", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 2, 0);
+  return yyMemo(ctx, 8, yypos0, yythunkpos0, yymarked0, 1);
+  l743:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StrikeTail", ctx->buf+ctx->pos));
+  return yyMemo(ctx, 8, yypos0, yythunkpos0, yymarked0, 0);
+}
+YY_RULE(int) yy_StrongUlTail(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  int yymarked0= ctx->marked;
+  { int yyok= yyRecall(ctx, 7);  if (yyok >= 0) return yyok; }  ctx->marked= 0;  yyDo(ctx, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "StrongUlTail"));
+  {  int yypos753= ctx->pos, yythunkpos753= ctx->thunkpos;  int yyc754= yypeek(ctx);
+  switch (yyc754)
+    {
+    default:  goto l751;
+    }
+  l751:;	
+  {  int yypos756= ctx->pos, yythunkpos756= ctx->thunkpos;  if (!yymatchString(ctx, "__")) goto l756;  goto l755;
+  l756:;	  ctx->pos= yypos756; ctx->thunkpos= yythunkpos756;
+  }  if (!yy_Inline(ctx)) goto l755;  yyDo(ctx, yySet, -2, 0);  if (!yy_StrongUlTail(ctx)) goto l755;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_1_StrongUlTail, ctx->begin, ctx->end);  goto l753;
+  l755:;	  ctx->pos= yypos753; ctx->thunkpos= yythunkpos753;  if (!yyfirst(yyc754, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l750;  if (!yymatchString(ctx, "__")) goto l750;  yyDo(ctx, yy_2_StrongUlTail, ctx->begin, ctx->end);
+  }
+  l753:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "StrongUlTail", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 2, 0);
+  return yyMemo(ctx, 7, yypos0, yythunkpos0, yymarked0, 1);
+  l750:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StrongUlTail", ctx->buf+ctx->pos));
+  return yyMemo(ctx, 7, yypos0, yythunkpos0, yymarked0, 0);
+}
+YY_RULE(int) yy_StrongStarTail(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  int yymarked0= ctx->marked;
+  { int yyok= yyRecall(ctx, 6);  if (yyok >= 0) return yyok; }  ctx->marked= 0;  yyDo(ctx, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "StrongStarTail"));
+  {  int yypos760= ctx->pos, yythunkpos760= ctx->thunkpos;  int yyc761= yypeek(ctx);
+  switch (yyc761)
+    {
+    default:  goto l758;
+    }
+  l758:;	
+  {  int yypos763= ctx->pos, yythunkpos763= ctx->thunkpos;  if (!yymatchString(ctx, "**")) goto l763;  goto l762;
+  l763:;	  ctx->pos= yypos763; ctx->thunkpos= yythunkpos763;
+  }  if (!yy_Inline(ctx)) goto l762;  yyDo(ctx, yySet, -2, 0);  if (!yy_StrongStarTail(ctx)) goto l762;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_1_StrongStarTail, ctx->begin, ctx->end);  goto l760;
+  l762:;	  ctx->pos= yypos760; ctx->thunkpos= yythunkpos760;  if (!yyfirst(yyc761, (unsigned char *)"\000\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l757;  if (!yymatchString(ctx, "**")) goto l757;  yyDo(ctx, yy_2_StrongStarTail, ctx->begin, ctx->end);
+  }
+  l760:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "StrongStarTail", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 2, 0);
+  return yyMemo(ctx, 6, yypos0, yythunkpos0, yymarked0, 1);
+  l757:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StrongStarTail", ctx->buf+ctx->pos));
+  return yyMemo(ctx, 6, yypos0, yythunkpos0, yymarked0, 0);
+}
+YY_RULE(int) yy_EmphUlTail(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  int yymarked0= ctx->marked;
+  { int yyok= yyRecall(ctx, 5);  if (yyok >= 0) return yyok; }  ctx->marked= 0;  yyDo(ctx, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "EmphUlTail"));
+  {  int yypos768= ctx->pos, yythunkpos768= ctx->thunkpos;  int yyc769= yypeek(ctx);
+  switch (yyc769)
+    {
+    default:  goto l765;
+    }
+  l765:;	
+  {  int yypos771= ctx->pos, yythunkpos771= ctx->thunkpos;  if (!yymatchChar(ctx, '_')) goto l771;  goto l770;
+  l771:;	  ctx->pos= yypos771; ctx->thunkpos= yythunkpos771;
+  }  if (!yy_Inline(ctx)) goto l770;  yyDo(ctx, yySet, -2, 0);  if (!yy_EmphUlTail(ctx)) goto l770;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_1_EmphUlTail, ctx->begin, ctx->end);  goto l768;
+  l770:;	  ctx->pos= yypos768; ctx->thunkpos= yythunkpos768;  if (!yyfirst(yyc769, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l767;  if (!yy_StrongUl(ctx)) goto l772;  yyDo(ctx, yySet, -2, 0);  if (!yy_EmphUlTail(ctx)) goto l772;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_2_EmphUlTail, ctx->begin, ctx->end);  goto l768;
+  l772:;	  ctx->pos= yypos768; ctx->thunkpos= yythunkpos768;
+  l767:;	  if (!yyfirst(yyc769, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l764;
+  {  int yypos773= ctx->pos, yythunkpos773= ctx->thunkpos;  if (!yy_StrongUl(ctx)) goto l773;  goto l764;
+  l773:;	  ctx->pos= yypos773; ctx->thunkpos= yythunkpos773;
+  }  if (!yymatchChar(ctx, '_')) goto l764;  yyDo(ctx, yy_3_EmphUlTail, ctx->begin, ctx->end);
+  }
+  l768:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "EmphUlTail", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 2, 0);
+  return yyMemo(ctx, 5, yypos0, yythunkpos0, yymarked0, 1);
+  l764:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EmphUlTail", ctx->buf+ctx->pos));
+  return yyMemo(ctx, 5, yypos0, yythunkpos0, yymarked0, 0);
+}
+YY_RULE(int) yy_EmphStarTail(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  int yymarked0= ctx->marked;
+  { int yyok= yyRecall(ctx, 4);  if (yyok >= 0) return yyok; }  ctx->marked= 0;  yyDo(ctx, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "EmphStarTail"));
+  {  int yypos778= ctx->pos, yythunkpos778= ctx->thunkpos;  int yyc779= yypeek(ctx);
+  switch (yyc779)
+    {
+    default:  goto l775;
+    }
+  l775:;	
+  {  int yypos781= ctx->pos, yythunkpos781= ctx->thunkpos;  if (!yymatchChar(ctx, '*')) goto l781;  goto l780;
+  l781:;	  ctx->pos= yypos781; ctx->thunkpos= yythunkpos781;
+  }  if (!yy_Inline(ctx)) goto l780;  yyDo(ctx, yySet, -2, 0);  if (!yy_EmphStarTail(ctx)) goto l780;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_1_EmphStarTail, ctx->begin, ctx->end);  goto l778;
+  l780:;	  ctx->pos= yypos778; ctx->thunkpos= yythunkpos778;  if (!yyfirst(yyc779, (unsigned char *)"\000\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l777;  if (!yy_StrongStar(ctx)) goto l782;  yyDo(ctx, yySet, -2, 0);  if (!yy_EmphStarTail(ctx)) goto l782;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_2_EmphStarTail, ctx->begin, ctx->end);  goto l778;
+  l782:;	  ctx->pos= yypos778; ctx->thunkpos= yythunkpos778;
+  l777:;	  if (!yyfirst(yyc779, (unsigned char *)"\000\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l774;
+  {  int yypos783= ctx->pos, yythunkpos783= ctx->thunkpos;  if (!yy_StrongStar(ctx)) goto l783;  goto l774;
+  l783:;	  ctx->pos= yypos783; ctx->thunkpos= yythunkpos783;
+  }  if (!yymatchChar(ctx, '*')) goto l774;  yyDo(ctx, yy_3_EmphStarTail, ctx->begin, ctx->end);
+  }
+  l778:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "EmphStarTail", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 2, 0);
+  return yyMemo(ctx, 4, yypos0, yythunkpos0, yymarked0, 1);
+  l774:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EmphStarTail", ctx->buf+ctx->pos));
+  return yyMemo(ctx, 4, yypos0, yythunkpos0, yymarked0, 0);
+}
+YY_RULE(int) yy_SourceContents(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  int yymarked0= ctx->marked;
+  { int yyok= yyRecall(ctx, 3);  if (yyok >= 0) return yyok; }  ctx->marked= 0;
+  yyprintf((stderr, "%s\n", "SourceContents"));
+  l785:;	
+  {  int yypos786= ctx->pos, yythunkpos786= ctx->thunkpos;
+  {  int yypos789= ctx->pos, yythunkpos789= ctx->thunkpos;  int yyc790= yypeek(ctx);
+  switch (yyc790)
+    {
+    default:  goto l787;
+    }
+  l787:;	
+  {  int yypos794= ctx->pos, yythunkpos794= ctx->thunkpos;  if (!yymatchChar(ctx, '(')) goto l794;  goto l791;
+  l794:;	  ctx->pos= yypos794; ctx->thunkpos= yythunkpos794;
+  }
+  {  int yypos795= ctx->pos, yythunkpos795= ctx->thunkpos;  if (!yymatchChar(ctx, ')')) goto l795;  goto l791;
+  l795:;	  ctx->pos= yypos795; ctx->thunkpos= yythunkpos795;
+  }
+  {  int yypos796= ctx->pos, yythunkpos796= ctx->thunkpos;  if (!yymatchChar(ctx, '>')) goto l796;  goto l791;
+  l796:;	  ctx->pos= yypos796; ctx->thunkpos= yythunkpos796;
+  }  if (!yy_Nonspacechar(ctx)) goto l791;
+  l792:;	
+  {  int yypos793= ctx->pos, yythunkpos793= ctx->thunkpos;
+  {  int yypos797= ctx->pos, yythunkpos797= ctx->thunkpos;  if (!yymatchChar(ctx, '(')) goto l797;  goto l793;
+  l797:;	  ctx->pos= yypos797; ctx->thunkpos= yythunkpos797;
+  }
+  {  int yypos798= ctx->pos, yythunkpos798= ctx->thunkpos;  if (!yymatchChar(ctx, ')')) goto l798;  goto l793;
+  l798:;	  ctx->pos= yypos798; ctx->thunkpos= yythunkpos798;
+  }
+  {  int yypos799= ctx->pos, yythunkpos799= ctx->thunkpos;  if (!yymatchChar(ctx, '>')) goto l799;  goto l793;
+  l799:;	  ctx->pos= yypos799; ctx->thunkpos= yythunkpos799;
+  }  if (!yy_Nonspacechar(ctx)) goto l793;  goto l792;
+  l793:;	  ctx->pos= yypos793; ctx->thunkpos= yythunkpos793;
+  }  goto l789;
+  l791:;	  ctx->pos= yypos789; ctx->thunkpos= yythunkpos789;  if (!yyfirst(yyc790, (unsigned char *)"\000\000\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l786;  if (!yymatchChar(ctx, '(')) goto l786;  if (!yy_SourceContents(ctx)) goto l786;  if (!yymatchChar(ctx, ')')) goto l786;
+  }
+  l789:;	  goto l785;
+  l786:;	  ctx->pos= yypos786; ctx->thunkpos= yythunkpos786;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "SourceContents", ctx->buf+ctx->pos));
+  return yyMemo(ctx, 3, yypos0, yythunkpos0, yymarked0, 1);
+}
+YY_RULE(int) yy_Endline(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  int yymarked0= ctx->marked;
+  { int yyok= yyRecall(ctx, 2);  if (yyok >= 0) return yyok; }  ctx->marked= 0;
+  yyprintf((stderr, "%s\n", "Endline"));
+  {  int yypos804= ctx->pos, yythunkpos804= ctx->thunkpos;  int yyc805= yypeek(ctx);
+  switch (yyc805)
+    {
+     case 32:  goto l801;
+     case 9: case 10: case 13:  goto l802;
+    default:  goto l800;
+    }
+  l801:;	  if (!yy_LineBreak(ctx)) goto l806;  goto l804;
+  l806:;	  ctx->pos= yypos804; ctx->thunkpos= yythunkpos804;
+  l802:;	  if (!yyfirst(yyc805, (unsigned char *)"\000\046\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l803;  if (!yy_TerminalEndline(ctx)) goto l807;  goto l804;
+  l807:;	  ctx->pos= yypos804; ctx->thunkpos= yythunkpos804;
+  l803:;	  if (!yyfirst(yyc805, (unsigned char *)"\000\046\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l800;  if (!yy_NormalEndline(ctx)) goto l800;
+  }
+  l804:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Endline", ctx->buf+ctx->pos));
+  return yyMemo(ctx, 2, yypos0, yythunkpos0, yymarked0, 1);
+  l800:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Endline", ctx->buf+ctx->pos));
+  return yyMemo(ctx, 2, yypos0, yythunkpos0, yymarked0, 0);
+}
+YY_RULE(int) yy_Label(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  int yymarked0= ctx->marked;
+  { int yyok= yyRecall(ctx, 1);  if (yyok >= 0) return yyok; }  ctx->marked= 0;  yyDo(ctx, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Label"));  if (!yymatchChar(ctx, '[')) goto l808;
+  {  int yypos811= ctx->pos, yythunkpos811= ctx->thunkpos;
+  {  int yypos813= ctx->pos, yythunkpos813= ctx->thunkpos;  if (!yymatchChar(ctx, '^')) goto l813;  goto l812;
+  l813:;	  ctx->pos= yypos813; ctx->thunkpos= yythunkpos813;
+  }  if (!( extension(EXT_NOTES) )) goto l812;  goto l811;
+  l812:;	  ctx->pos= yypos811; ctx->thunkpos= yythunkpos811;
+  {  int yypos814= ctx->pos, yythunkpos814= ctx->thunkpos;  if (!yymatchDot(ctx)) goto l808;  ctx->pos= yypos814; ctx->thunkpos= yythunkpos814;
+  }  if (!( !extension(EXT_NOTES) )) goto l808;
+  }
+  l811:;	  if (!( label_closes(ctx) )) goto l808;  if (!yy_StartList(ctx)) goto l808;  yyDo(ctx, yySet, -1, 0);
+  l815:;	
+  {  int yypos816= ctx->pos, yythunkpos816= ctx->thunkpos;
+  {  int yypos817= ctx->pos, yythunkpos817= ctx->thunkpos;  if (!yymatchChar(ctx, ']')) goto l817;  goto l816;
+  l817:;	  ctx->pos= yypos817; ctx->thunkpos= yythunkpos817;
+  }  if (!yy_Inline(ctx)) goto l816;  yyDo(ctx, yy_1_Label, ctx->begin, ctx->end);  goto l815;
+  l816:;	  ctx->pos= yypos816; ctx->thunkpos= yythunkpos816;
+  }  if (!yymatchChar(ctx, ']')) goto l808;  yyDo(ctx, yy_2_Label, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Label", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 1, 0);
+  return yyMemo(ctx, 1, yypos0, yythunkpos0, yymarked0, 1);
+  l808:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Label", ctx->buf+ctx->pos));
+  return yyMemo(ctx, 1, yypos0, yythunkpos0, yymarked0, 0);
+}
+YY_RULE(int) yy_Inline(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  int yymarked0= ctx->marked;
+  { int yyok= yyRecall(ctx, 0);  if (yyok >= 0) return yyok; }  ctx->marked= 0;
+  yyprintf((stderr, "%s\n", "Inline"));
+  {  int yypos836= ctx->pos, yythunkpos836= ctx->thunkpos;  int yyc837= yypeek(ctx);
+  switch (yyc837)
+    {
+    default:  goto l819;
+    }
+  l819:;	  if (!yy_Str(ctx)) goto l838;  goto l836;
+  l838:;	  ctx->pos= yypos836; ctx->thunkpos= yythunkpos836;  if (!yyfirst(yyc837, (unsigned char *)"\000\046\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l821;  if (!yy_Endline(ctx)) goto l839;  goto l836;
+  l839:;	  ctx->pos= yypos836; ctx->thunkpos= yythunkpos836;
+  l821:;	  if (!yyfirst(yyc837, (unsigned char *)"\000\002\000\000\001\004\000\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l822;  if (!yy_UlOrStarLine(ctx)) goto l840;  goto l836;
+  l840:;	  ctx->pos= yypos836; ctx->thunkpos= yythunkpos836;
+  l822:;	  if (!yyfirst(yyc837, (unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l823;  if (!yy_Space(ctx)) goto l841;  goto l836;
+  l841:;	  ctx->pos= yypos836; ctx->thunkpos= yythunkpos836;
+  l823:;	  if (!yy_Strong(ctx)) goto l842;  goto l836;
+  l842:;	  ctx->pos= yypos836; ctx->thunkpos= yythunkpos836;  if (!yy_Emph(ctx)) goto l843;  goto l836;
+  l843:;	  ctx->pos= yypos836; ctx->thunkpos= yythunkpos836;  if (!yy_Strike(ctx)) goto l844;  goto l836;
+  l844:;	  ctx->pos= yypos836; ctx->thunkpos= yythunkpos836;  if (!yyfirst(yyc837, (unsigned char *)"\000\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l827;  if (!yy_Image(ctx)) goto l845;  goto l836;
+  l845:;	  ctx->pos= yypos836; ctx->thunkpos= yythunkpos836;
+  l827:;	  if (!yy_Link(ctx)) goto l846;  goto l836;
+  l846:;	  ctx->pos= yypos836; ctx->thunkpos= yythunkpos836;  if (!yy_NoteReference(ctx)) goto l847;  goto l836;
+  l847:;	  ctx->pos= yypos836; ctx->thunkpos= yythunkpos836;  if (!yy_InlineNote(ctx)) goto l848;  goto l836;
+  l848:;	  ctx->pos= yypos836; ctx->thunkpos= yythunkpos836;  if (!yyfirst(yyc837, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l831;  if (!yy_Code(ctx)) goto l849;  goto l836;
+  l849:;	  ctx->pos= yypos836; ctx->thunkpos= yythunkpos836;
+  l831:;	  if (!yyfirst(yyc837, (unsigned char *)"\000\000\000\000\000\000\000\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l832;  if (!yy_RawHtml(ctx)) goto l850;  goto l836;
+  l850:;	  ctx->pos= yypos836; ctx->thunkpos= yythunkpos836;
+  l832:;	  if (!yyfirst(yyc837, (unsigned char *)"\000\000\000\000\100\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l833;  if (!yy_Entity(ctx)) goto l851;  goto l836;
+  l851:;	  ctx->pos= yypos836; ctx->thunkpos= yythunkpos836;
+  l833:;	  if (!yyfirst(yyc837, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l834;  if (!yy_EscapedChar(ctx)) goto l852;  goto l836;
+  l852:;	  ctx->pos= yypos836; ctx->thunkpos= yythunkpos836;
+  l834:;	  if (!yy_Smart(ctx)) goto l853;  goto l836;
+  l853:;	  ctx->pos= yypos836; ctx->thunkpos= yythunkpos836;  if (!yy_Symbol(ctx)) goto l818;
+  }
+  l836:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Inline", ctx->buf+ctx->pos));
+  return yyMemo(ctx, 0, yypos0, yythunkpos0, yymarked0, 1);
+  l818:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Inline", ctx->buf+ctx->pos));
+  return yyMemo(ctx, 0, yypos0, yythunkpos0, yymarked0, 0);
+}
+
+#ifndef YY_PART
+
+typedef int (*yyrule)(yycontext *ctx);
+
+YY_PARSE(int) YYPARSEFROM(YY_CTX_PARAM_ yyrule yystart)
+{
+  int yyok;
+  if (!yyctx->textlen)
+    {
+#ifndef YY_BUFFER_INPUT
+      yyctx->buf= (char *)YY_MALLOC(yyctx, 1024);
+      yyctx->pos= yyctx->limit= 0;
+#endif
+      yyctx->text= (char *)YY_MALLOC(yyctx, 1024);
+      yyctx->thunks= (yythunk *)YY_MALLOC(yyctx, sizeof(yythunk) * 32);
+      yyctx->vals= (YYSTYPE *)YY_MALLOC(yyctx, sizeof(YYSTYPE) * 32);
+#if YYMEMOCOUNT
+      yyctx->memos= (yymemo *)YY_MALLOC(yyctx, sizeof(yymemo) * YY_MEMO_SIZE);
+      yyctx->shared= yyctx->spare= yyctx->mark= 0;
+#endif
+      if (!yyctx->text || !yyctx->thunks || !yyctx->vals
+#ifndef YY_BUFFER_INPUT
+	  || !yyctx->buf
+#endif
+#if YYMEMOCOUNT
+	  || !yyctx->memos
+#endif
+	  )
+	{
+#ifndef YY_BUFFER_INPUT
+	  YY_FREE(yyctx, yyctx->buf);
+#endif
+	  YY_FREE(yyctx, yyctx->text);
+	  YY_FREE(yyctx, yyctx->thunks);
+	  YY_FREE(yyctx, yyctx->vals);
+#if YYMEMOCOUNT
+	  YY_FREE(yyctx, yyctx->memos);
+#endif
+	  return 0;
+	}
+#ifndef YY_BUFFER_INPUT
+      yyctx->buflen= 1024;
+#endif
+#if YYMEMOCOUNT
+      memset(yyctx->memos, 0, sizeof(yymemo) * YY_MEMO_SIZE);
+      yyctx->memosize= YY_MEMO_SIZE;
+      yyctx->memobytes= sizeof(yymemo) * YY_MEMO_SIZE;
+      yyctx->sharedbytes= 0;
+#endif
+      yyctx->textlen= 1024;
+      yyctx->thunkslen= 32;
+      yyctx->valslen= 32;
+      yyctx->begin= yyctx->end= yyctx->thunkpos= 0;
+    }
+#if YYMEMOCOUNT
+  ++yyctx->memogen;
+  yyctx->marked= 0;
+  yyctx->memokeep= 0;
+  yyctx->keptbytes= 0;
+  yyctx->keptfrom= yyctx->keptto= -1;
+  yyctx->memodepth= 0;
+#endif
+  yyctx->nomem= 0;
+  yyctx->begin= yyctx->end= yyctx->pos;
+  yyctx->thunkpos= 0;
+  yyctx->val= yyctx->vals;
+  yyok= yystart(yyctx);
+  if (yyok && !yyctx->nomem) yyDone(yyctx);
+  yyCommit(yyctx);
+  return yyok && !yyctx->nomem;
+}
+
+YY_PARSE(int) YYPARSE(YY_CTX_PARAM)
+{
+  return YYPARSEFROM(YY_CTX_ARG_ yy_Doc);
+}
+
+#ifdef YY_BUFFER_INPUT
+YY_PARSE(void) YYSETBUFFER(YY_CTX_PARAM_ char *yybuffer, int yylength)
+{
+  yyctx->buf= yybuffer;
+  yyctx->limit= yylength;
+  yyctx->begin= yyctx->end= yyctx->pos= yyctx->thunkpos= 0;
+}
+#endif
+
+YY_PARSE(void) YYRELEASE(YY_CTX_PARAM)
+{
+  if (yyctx->buflen)
+    {
+      yyctx->buflen= 0;
+      YY_FREE(yyctx, yyctx->buf);
+    }
+  if (yyctx->textlen)
+    {
+      yyctx->textlen= 0;
+      YY_FREE(yyctx, yyctx->text);
+      YY_FREE(yyctx, yyctx->thunks);
+      YY_FREE(yyctx, yyctx->vals);
+#if YYMEMOCOUNT
+      {
+	yyshared *s, *next;
+	int i;
+	for (i= 0;  i < yyctx->memosize;  ++i)
+	  YY_FREE(yyctx, yyctx->memos[i].thunks);
+	YY_FREE(yyctx, yyctx->memos);
+	for (s= yyctx->shared;  s;  s= next)
+	  {
+	    next= s->next;
+	    YY_FREE(yyctx, s->thunks);
+	    YY_FREE(yyctx, s);
+	  }
+	for (s= yyctx->spare;  s;  s= next)
+	  {
+	    next= s->next;
+	    YY_FREE(yyctx, s->thunks);
+	    YY_FREE(yyctx, s);
+	  }
+	yyctx->shared= yyctx->spare= yyctx->mark= 0;
+      }
+#endif
+    }
+}
+
+#endif
+
+#ifndef YY_PART
+
+YY_PARSE(void) YYMEMOREPORT(YY_CTX_PARAM_ FILE *stream)
+{
+  long thunks[YYMEMOCOUNT], total= sizeof(yymemo) * yyctx->memosize;
+  yyshared *s;
+  int i;
+  memset(thunks, 0, sizeof(thunks));
+  for (i= 0;  i < yyctx->memosize;  ++i)
+    if (yyctx->memos[i].thunkslen)
+      thunks[yyctx->memos[i].memo] += sizeof(yythunk) * yyctx->memos[i].thunkslen;
+  for (s= yyctx->shared;  s;  s= s->next)
+    total += sizeof(yythunk) * s->size;
+  for (s= yyctx->spare;  s;  s= s->next)
+    total += sizeof(yythunk) * s->size;
+  fprintf(stream, "%-24s %12s %12s %12s\n", "memo", "hits", "misses", "thunk bytes");
+  for (i= 0;  i < YYMEMOCOUNT;  ++i)
+    {
+      fprintf(stream, "%-24s %12ld %12ld %12ld\n", yymemonames[i], yyctx->memohits[i], yyctx->memomisses[i], thunks[i]);
+      total += thunks[i];
+    }
+  fprintf(stream, "%d entries, %ld bytes\n", yyctx->memosize, total);
+}
+
+#endif
+
+
+/* grow_buffer - resize a buffer of the context, as arena_buffer.  When
+ * out of memory, the buffer is left as it was and NULL is returned, and
+ * the parse is abandoned, as when the parser's own buffers run out. */
+static void * grow_buffer(parser_context *ctx, void *ptr, size_t size) {
+    ptr = arena_buffer(ctx->arena, ptr, size);
+    if (ptr == NULL)
+        ctx->nomem = 1;
+    return ptr;
+}
+
+
+/**********************************************************************
+
+  Normal characters.  Most of a document is runs of NormalChar, which
+  the grammar defines by the characters that are not one.  Which those
+  are depends only on the extensions, so each context marks the normal
+  bytes in a table once, and Str consumes a run with one lookup a byte.
+
+  With EXT_SMART, the dots and dashes of prose would each end a Str and
+  have every Inline tried at them.  Instead a run goes on past them, and
+  smart_str splits it after the parse into the ellipses, dashes and
+  Symbols that Smart would have made, which print the same.
+
+ ***********************************************************************/
+
+/* set_normal_chars - mark the bytes that are not a SpecialChar,
+ * Spacechar or Newline with the extensions of ctx */
+static void set_normal_chars(parser_context *ctx) {
+    static const char *special = "~*_`&[]()<!#\\'\"";
+    static const char *smart_special = ".";
+    const char *c;
+    int i;
+
+    for (i = 0; i < 256; i++)
+        ctx->normal[i] = true;
+    for (c = special; *c != '\0'; c++)
+        ctx->normal[(unsigned char)*c] = false;
+    if (extension(EXT_SMART))
+        for (c = smart_special; *c != '\0'; c++)
+            ctx->normal[(unsigned char)*c] = false;
+    if (extension(EXT_NOTES))
+        ctx->normal['^'] = false;
+    ctx->normal[' '] = ctx->normal['\t'] = false;
+    ctx->normal['\n'] = ctx->normal['\r'] = false;
+}
+
+/* normal_chars - move past the rest of a run of NormalChar, if the
+ * byte before the current position is one.  With EXT_SMART, the run
+ * goes on past a '.' that does not start ". . .", the Ellipsis with
+ * spaces, taking "..." at once as Smart does. */
+static bool normal_chars(parser_context *ctx) {
+    bool *normal = ctx->normal;
+    char *s = ctx->buf;
+    int pos = ctx->pos - 1;
+    int limit = ctx->limit;
+
+    for (;;) {
+        while (pos < limit && normal[(unsigned char)s[pos]])
+            pos++;
+        if (pos == limit || s[pos] != '.' || !extension(EXT_SMART))
+            break;
+        if (pos + 2 < limit && s[pos + 1] == '.' && s[pos + 2] == '.')
+            pos += 3;
+        else if (pos + 4 < limit && strncmp(s + pos, ". . .", 5) == 0)
+            break;
+        else
+            pos++;
+    }
+    if (pos < ctx->pos)
+        return false;
+    ctx->pos = pos;
+    return true;
+}
+
+/* after_smart_mark - true if EXT_SMART is selected and the byte before
+ * the current position is a '.' or '-', which Smart would have ended
+ * the Str with */
+static bool after_smart_mark(parser_context *ctx) {
+    char c = ctx->buf[ctx->pos - 1];
+    return extension(EXT_SMART) && (c == '.' || c == '-');
+}
+
+/* smart_str - cons the STR slice str onto list, with EXT_SMART as the
+ * pieces Smart would have made of it: "..." an ELLIPSIS, "---" or "--"
+ * an EMDASH, a '-' before a digit an ENDASH, and each other '.' or '-'
+ * a STR of its own, as a Symbol */
+static element * smart_str(parser_context *ctx, element *str, element *list) {
+    char *s, *run, *end;
+    element *piece;
+    int n;
+
+    if (!extension(EXT_SMART) || str->key != STR)
+        return cons(str, list);
+    run = str->contents.str;
+    end = run + str->len;
+    for (s = run; s < end; s += n) {
+        n = 1;
+        if (*s != '.' && *s != '-')
+            continue;
+        if (s > run)
+            list = cons(mk_str_slice(ctx->arena, run, s - run), list);
+        if (*s == '.' && end - s >= 3 && s[1] == '.' && s[2] == '.') {
+            piece = mk_element(ctx->arena, ELLIPSIS);
+            n = 3;
+        } else if (*s == '-' && end - s >= 2 && s[1] == '-') {
+            piece = mk_element(ctx->arena, EMDASH);
+            n = end - s >= 3 && s[2] == '-' ? 3 : 2;
+        } else if (*s == '-' && end - s >= 2 && s[1] >= '0' && s[1] <= '9') {
+            piece = mk_element(ctx->arena, ENDASH);
+        } else
+            piece = mk_str_slice(ctx->arena, s, 1);
+        list = cons(piece, list);
+        run = s + n;
+    }
+    if (run == str->contents.str)
+        return cons(str, list);
+    if (run < end)
+        list = cons(mk_str_slice(ctx->arena, run, end - run), list);
+    return list;
+}
+
+
+/**********************************************************************
+
+  Line index.  Block rules ask over and over where a line ends, whether
+  the rest of it is blank and how far it is indented.  The lines of the
+  document are found once, by index_document, and shared by the parses
+  of its segments; the lines of any other text, such as a list item, are
+  found as its parse reaches them.  The ends are found with a vector
+  search where the compiler provides one.  find_line answers these
+  questions from the result, including whether the line after a
+  paragraph line underlines it as a setext heading.  A line ends with a
+  Newline: "\n", "\r\n" or "\r".
+
+ ***********************************************************************/
+
+struct line {
+    int start;
+    int lead;               /* Past the spaces and tabs that begin it. */
+    int trail;              /* Past the last character that is not a space or tab. */
+    int end;                /* Where its Newline begins, or the end of the text. */
+    int indent;             /* Spaces that begin it. */
+    char underline;         /* '=' or '-' if it is a SetextBottom1 or 2, else 0. */
+    char rule;              /* '*', '-' or '_' if it is a HorizontalRule line, else 0. */
+};
+
+/* next_newline - the position of the first '\n' or '\r' in s from
+ * pos, or limit if there is none */
+static int next_newline(char *s, int pos, int limit) {
+#if defined(__GNUC__) && defined(__AVX2__)
+    __m256i nl = _mm256_set1_epi8('\n');
+    __m256i cr = _mm256_set1_epi8('\r');
+    __m256i v;
+    unsigned int mask;
+    for (; pos + 32 <= limit; pos += 32) {
+        v = _mm256_loadu_si256((__m256i *) (s + pos));
+        mask = _mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(v, nl), _mm256_cmpeq_epi8(v, cr)));
+        if (mask != 0)
+            return pos + __builtin_ctz(mask);
+    }
+#elif defined(__GNUC__) && defined(__SSE2__)
+    __m128i nl = _mm_set1_epi8('\n');
+    __m128i cr = _mm_set1_epi8('\r');
+    __m128i v;
+    unsigned int mask;
+    for (; pos + 16 <= limit; pos += 16) {
+        v = _mm_loadu_si128((__m128i *) (s + pos));
+        mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, nl), _mm_cmpeq_epi8(v, cr)));
+        if (mask != 0)
+            return pos + __builtin_ctz(mask);
+    }
+#endif
+    for (; pos < limit; pos++)
+        if (s[pos] == '\n' || s[pos] == '\r')
+            return pos;
+    return limit;
+}
+
+/* scan_line - add the line that begins where the last one ended; false
+ * if out of memory */
+static bool scan_line(parser_context *ctx, line_index *index) {
+    char *s = index->text;
+    struct line *line;
+    int count;
+    int p;
+
+    if (index->count == index->max) {
+        count = index->max ? 2 * index->max : 256;
+        line = grow_buffer(ctx, index->lines, count * sizeof(struct line));
+        if (line == NULL)
+            return false;
+        index->lines = line;
+        index->max = count;
+    }
+    line = &index->lines[index->count++];
+    line->start = index->scanned;
+    line->end = next_newline(s, line->start, index->length);
+    for (p = line->start; p < line->end && s[p] == ' '; p++)
+        ;
+    line->indent = p - line->start;
+    for (; p < line->end && (s[p] == ' ' || s[p] == '\t'); p++)
+        ;
+    line->lead = p;
+    for (p = line->end; p > line->start && (s[p - 1] == ' ' || s[p - 1] == '\t'); p--)
+        ;
+    line->trail = p;
+    line->underline = 0;
+    if (line->end < index->length && (s[line->start] == '=' || s[line->start] == '-')) {
+        for (p = line->start; p < line->end && s[p] == s[line->start]; p++)
+            ;
+        if (p == line->end)
+            line->underline = s[line->start];
+    }
+    /* Up to three spaces, then three or more of one of '*', '-' and '_'
+     * among spaces and tabs. */
+    line->rule = 0;
+    p = line->lead;
+    if (line->end < index->length && line->indent < 4 && p == line->start + line->indent
+        && (s[p] == '*' || s[p] == '-' || s[p] == '_')) {
+        for (count = 0; p < line->end; p++) {
+            if (s[p] == s[line->lead])
+                count++;
+            else if (s[p] != ' ' && s[p] != '\t')
+                break;
+        }
+        if (p == line->end && count >= 3)
+            line->rule = s[line->lead];
+    }
+    index->scanned = line->end;
+    if (index->scanned < index->length)
+        index->scanned += s[line->end] == '\r' && line->end + 1 < index->length && s[line->end + 1] == '\n' ? 2 : 1;
+    return true;
+}
+
+/* index_document - find all the lines of a document, so that the parses
+ * of it and of its segments with ctx, or with copies of ctx made after
+ * this, need not find them.  If that runs out of memory, each parse finds
+ * the lines of its own text instead. */
+void index_document(parser_context *ctx, char *string, size_t len) {
+    line_index *index = &ctx->document_lines;
+
+    index->count = 0;
+    index->text = string;
+    index->length = len;
+    index->scanned = 0;
+    while (index->scanned < index->length)
+        if (!scan_line(ctx, index))
+            return;
+    ctx->document = index;
+}
+
+/* use_lines - set the line index for a parse of len bytes of string:
+ * the document's, if string is the end of it, or else an empty one */
+static void use_lines(parser_context *ctx, char *string, size_t len) {
+    line_index *index = ctx->document;
+
+    if (index != NULL && string >= index->text && string + len == index->text + index->length) {
+        ctx->text_lines = index;
+        ctx->line_offset = string - index->text;
+    } else {
+        index = &ctx->lines;
+        index->count = 0;
+        index->text = string;
+        index->length = len;
+        index->scanned = 0;
+        ctx->text_lines = index;
+        ctx->line_offset = 0;
+    }
+    ctx->line_hint = 0;
+}
+
+/* find_line - the line that holds pos, including its Newline, or NULL
+ * at the end of the text or when out of memory; the positions in it are
+ * those of the text indexed, which may begin line_offset bytes before
+ * the parse's */
+static struct line * find_line(parser_context *ctx, int pos) {
+    line_index *index = ctx->text_lines;
+    int lo, hi, mid;
+
+    if (pos >= ctx->limit)
+        return NULL;
+    pos += ctx->line_offset;
+    while (index->scanned <= pos)
+        if (!scan_line(ctx, index))
+            return NULL;
+
+    /* The parse mostly moves forward a line at a time. */
+    lo = ctx->line_hint;
+    if (lo < index->count && index->lines[lo].start <= pos) {
+        if (lo + 1 == index->count || pos < index->lines[lo + 1].start)
+            return &index->lines[lo];
+        if (lo + 2 == index->count || pos < index->lines[lo + 2].start)
+            return &index->lines[ctx->line_hint = lo + 1];
+    }
+    lo = 0;
+    hi = index->count - 1;
+    while (lo < hi) {
+        mid = (lo + hi + 1) / 2;
+        if (index->lines[mid].start <= pos)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    ctx->line_hint = lo;
+    return &index->lines[lo];
+}
+
+/* line_blank - if only spaces and tabs lie between the current position
+ * and the Newline of its line, move to the Newline */
+static bool line_blank(parser_context *ctx) {
+    struct line *line = find_line(ctx, ctx->pos);
+    int pos = ctx->pos + ctx->line_offset;
+
+    if (line == NULL || pos < line->trail || line->end == ctx->text_lines->length)
+        return false;
+    if (pos < line->end)
+        ctx->pos = line->end - ctx->line_offset;
+    return true;
+}
+
+/* underlined - the underline of the line after the current one, as
+ * RawLine would find it, or 0 if there is none */
+static char underlined(parser_context *ctx) {
+    line_index *index = ctx->text_lines;
+    struct line *line = find_line(ctx, ctx->pos);
+    int next;
+
+    if (line == NULL || line->end == index->length)
+        return 0;
+    next = line - index->lines + 1;
+    if (next == index->count && (index->scanned >= index->length || !scan_line(ctx, index)))
+        return 0;
+    return index->lines[next].underline;
+}
+
+/* line_end - move to the Newline of the current line, if it has one */
+static bool line_end(parser_context *ctx) {
+    struct line *line = find_line(ctx, ctx->pos);
+    int pos = ctx->pos + ctx->line_offset;
+
+    if (line == NULL || line->end == ctx->text_lines->length)
+        return false;
+    if (pos < line->end)
+        ctx->pos = line->end - ctx->line_offset;
+    return true;
+}
+
+/* nonindent_space - move past up to three spaces; always true */
+static bool nonindent_space(parser_context *ctx) {
+    struct line *line = find_line(ctx, ctx->pos);
+    char *s = ctx->buf;
+    int n;
+
+    if (line != NULL && ctx->pos + ctx->line_offset == line->start) {
+        n = line->indent < 3 ? line->indent : 3;
+    } else {
+        for (n = 0; n < 3 && ctx->pos + n < ctx->limit && s[ctx->pos + n] == ' '; n++)
+            ;
+    }
+    ctx->pos += n;
+    return true;
+}
+
+/* indent - move past a tab or four spaces, if they come next */
+static bool indent(parser_context *ctx) {
+    struct line *line = find_line(ctx, ctx->pos);
+    char *s = ctx->buf + ctx->pos;
+
+    if (line == NULL)
+        return false;
+    if (*s == '\t') {
+        ctx->pos++;
+        return true;
+    }
+    if (ctx->pos + ctx->line_offset == line->start ? line->indent >= 4 : ctx->pos + 4 <= ctx->limit && strncmp(s, "    ", 4) == 0) {
+        ctx->pos += 4;
+        return true;
+    }
+    return false;
+}
+
+/* rule_line - false if the current line cannot be a HorizontalRule
+ * from the current position */
+static bool rule_line(parser_context *ctx) {
+    struct line *line = find_line(ctx, ctx->pos);
+    return line != NULL && (ctx->pos + ctx->line_offset != line->start || line->rule != 0);
+}
+
+
+/**********************************************************************
+
+  Bracket index.  A Label parses Inlines from its '[' until it reaches
+  a ']', which closes the label only if no Inline, such as a code span
+  or a nested link, has consumed it first.  Where that scan stops
+  depends only on where it starts, and the scans from nested and
+  successive brackets run into each other, so label_closes records the
+  stop of every position it passes.  Each bracket of a paragraph is
+  then matched, or found to have no match, by a single scan, however
+  many rules try a Label there.  An InlineNote scans from its "^[" the
+  same way, and shares the stops.  Like the memoized outcomes, the stops
+  are forgotten when the parse of a block is abandoned.
+
+ ***********************************************************************/
+
+struct bracket {
+    int gen;
+    int pos;
+    int stop;
+};
+
+/* bracket_slot - the slot holding the stop of the scan from pos, or the
+ * empty slot to hold it */
+static struct bracket * bracket_slot(bracket_index *index, int gen, int pos) {
+    unsigned i = (unsigned) pos * 2654435761u;
+    struct bracket *b;
+    for (;;) {
+        b = &index->slots[i & (index->size - 1)];
+        if (b->gen != gen || b->pos == pos)
+            return b;
+        i++;
+    }
+}
+
+/* bracket_store - record that the scan from pos stops at stop.  Slots
+ * left by an earlier parse count as empty.  Out of memory, the stop is
+ * not recorded. */
+static void bracket_store(parser_context *ctx, int pos, int stop) {
+    bracket_index *index = &ctx->brackets;
+    int gen = ctx->memogen;
+    struct bracket *old, *slots, *b;
+    int i, size;
+    if (index->gen != gen) {
+        index->gen = gen;
+        index->count = 0;
+    }
+    if (2 * (index->count + 1) > index->size) {
+        slots = grow_buffer(ctx, NULL, (index->size ? 2 * index->size : 1024) * sizeof(struct bracket));
+        if (slots == NULL)
+            return;
+        old = index->slots;
+        size = index->size;
+        index->slots = slots;
+        index->size = size ? 2 * size : 1024;
+        memset(index->slots, 0, index->size * sizeof(struct bracket));
+        for (i = 0; i < size; i++)
+            if (old[i].gen == gen)
+                *bracket_slot(index, gen, old[i].pos) = old[i];
+        free(old);
+    }
+    b = bracket_slot(index, gen, pos);
+    if (b->gen != gen)
+        index->count++;
+    b->gen = gen;
+    b->pos = pos;
+    b->stop = stop;
+}
+
+/* label_closes - true if the Label or InlineNote whose '[' ends at the
+ * current position is closed by a ']'.  The position and the thunks of
+ * the parse are left as they were. */
+static bool label_closes(parser_context *ctx) {
+    bracket_index *index = &ctx->brackets;
+    int pos = ctx->pos;
+    int thunkpos = ctx->thunkpos;
+    int begin = ctx->begin;
+    int end = ctx->end;
+    int base = index->top;
+    int stop = -1;
+    int *path;
+    struct bracket *b;
+
+    /* Follow the scan until it stops or reaches a position whose stop is
+     * known.  The scans of nested labels push their paths above this. */
+    while (stop < 0) {
+        b = index->size > 0 ? bracket_slot(index, ctx->memogen, ctx->pos) : NULL;
+        if (b != NULL && b->gen == ctx->memogen) {
+            stop = b->stop;
+        } else {
+            if (index->top == index->max) {
+                path = grow_buffer(ctx, index->path, (index->max ? 2 * index->max : 256) * sizeof(int));
+                if (path == NULL)
+                    break;
+                index->path = path;
+                index->max = index->max ? 2 * index->max : 256;
+            }
+            index->path[index->top++] = ctx->pos;
+            if ((ctx->pos < ctx->limit && ctx->buf[ctx->pos] == ']') || !yy_Inline(ctx))
+                stop = ctx->pos;
+        }
+    }
+    if (stop < 0)
+        index->top = base;      /* Out of memory. */
+    while (index->top > base)
+        bracket_store(ctx, index->path[--index->top], stop);
+
+    ctx->pos = pos;
+    ctx->thunkpos = thunkpos;
+    ctx->begin = begin;
+    ctx->end = end;
+    return stop >= 0 && stop < ctx->limit && ctx->buf[stop] == ']';
+}
+
+/* note_label_closes - true if the label of a RawNoteReference that
+ * begins at the current position is not empty and is closed by a ']'
+ * before the line ends.  Every position a scan for the ']' or Newline
+ * passes has the same stop, so the span of the last scan is kept, and
+ * a scan that reaches it, from before or within, ends there.  A run of
+ * "[^" that is never closed is thus scanned once, in either order. */
+static bool note_label_closes(parser_context *ctx) {
+    char *s = ctx->buf;
+    int pos = ctx->pos;
+    bool kept = ctx->note_close_gen == ctx->parse && pos <= ctx->note_close_at;
+    int end = kept ? ctx->note_close_from : ctx->limit;
+    int stop;
+
+    for (stop = pos; stop < end && s[stop] != ']' && s[stop] != '\n' && s[stop] != '\r'; stop++)
+        ;
+    if (kept && stop >= end) {
+        stop = ctx->note_close_at;
+        if (pos < ctx->note_close_from)
+            ctx->note_close_from = pos;
+    } else {
+        ctx->note_close_gen = ctx->parse;
+        ctx->note_close_from = pos;
+        ctx->note_close_at = stop;
+    }
+    return stop > pos && stop < ctx->limit && s[stop] == ']';
+}
+
+
+/**********************************************************************
+
+  Code spans.  A code span opens with a run of backticks and closes
+  with the next run of the same length, unless a blank line comes
+  first; the spaces and tabs next to the backticks are not part of the
+  code.  code_span looks the closing run up in an index of the runs in
+  the paragraph, found in one scan the first time it is needed.
+
+ ***********************************************************************/
+
+struct tick_run {
+    int len;
+    int pos;
+};
+
+static int compare_tick_runs(const void *a, const void *b) {
+    const struct tick_run *x = a;
+    const struct tick_run *y = b;
+    if (x->len != y->len)
+        return x->len < y->len ? -1 : 1;
+    return x->pos < y->pos ? -1 : x->pos > y->pos;
+}
+
+/* index_ticks - find the runs of backticks from pos to the next blank
+ * line, that is, a Newline followed by a BlankLine; false if out of
+ * memory, leaving no runs indexed */
+static bool index_ticks(parser_context *ctx, int pos) {
+    tick_index *index = &ctx->ticks;
+    char *s = ctx->buf;
+    int limit = ctx->limit;
+    int start, next;
+    struct tick_run *runs;
+
+    index->count = 0;
+    index->gen = 0;
+    index->from = pos;
+    while (pos < limit) {
+        if (s[pos] == '`') {
+            start = pos;
+            while (pos < limit && s[pos] == '`')
+                pos++;
+            if (index->count == index->max) {
+                runs = grow_buffer(ctx, index->runs, (index->max ? 2 * index->max : 64) * sizeof(struct tick_run));
+                if (runs == NULL)
+                    return false;
+                index->runs = runs;
+                index->max = index->max ? 2 * index->max : 64;
+            }
+            index->runs[index->count].len = pos - start;
+            index->runs[index->count].pos = start;
+            index->count++;
+        } else if (s[pos] == '\n' || s[pos] == '\r') {
+            next = pos + (s[pos] == '\r' && pos + 1 < limit && s[pos + 1] == '\n' ? 2 : 1);
+            start = next;
+            while (start < limit && (s[start] == ' ' || s[start] == '\t'))
+                start++;
+            if (start < limit && (s[start] == '\n' || s[start] == '\r'))
+                break;
+            pos = next;
+        } else {
+            pos++;
+        }
+    }
+    index->to = pos;
+    index->gen = ctx->parse;
+    qsort(index->runs, index->count, sizeof(struct tick_run), compare_tick_runs);
+    return true;
+}
+
+/* code_span - if a code span starts at the backtick before the current
+ * position, mark its code as the text of the match and move past it */
+static bool code_span(parser_context *ctx) {
+    tick_index *index = &ctx->ticks;
+    char *s = ctx->buf;
+    int pos = ctx->pos - 1;
+    int len = 0;
+    int lo, hi, mid;
+    int start, end, close;
+
+    /* Inline tries a failed run again from each of its backticks. */
+    if (index->run_gen == ctx->parse && pos >= index->run_from && pos < index->run_to) {
+        len = index->run_to - pos;
+    } else {
+        while (pos + len < ctx->limit && s[pos + len] == '`')
+            len++;
+        if (len == 0)
+            return false;
+        index->run_gen = ctx->parse;
+        index->run_from = pos;
+        index->run_to = pos + len;
+    }
+    if ((index->gen != ctx->parse || pos < index->from || pos >= index->to) && !index_ticks(ctx, pos))
+        return false;
+
+    /* The first run of the same length after this one closes the span. */
+    lo = 0;
+    hi = index->count;
+    while (lo < hi) {
+        mid = (lo + hi) / 2;
+        if (index->runs[mid].len < len || (index->runs[mid].len == len && index->runs[mid].pos <= pos))
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (lo == index->count || index->runs[lo].len != len)
+        return false;
+    close = index->runs[lo].pos;
+
+    start = pos + len;
+    while (start < close && (s[start] == ' ' || s[start] == '\t'))
+        start++;
+    if (start == close)
+        return false;
+    end = close;
+    while (s[end - 1] == ' ' || s[end - 1] == '\t')
+        end--;
+
+    /* Marked as '<' and '>' mark them, so that a memoized rule
+     * recalled over this span sets yytext to it again. */
+    ctx->begin = start;
+    ctx->end = end;
+    ctx->marked |= 3;
+    ctx->pos = close + len;
+    return true;
+}
+
+
+/**********************************************************************
+
+  HTML blocks.  A block opens with the tag of a block-level element and
+  runs to the tag that closes it; tags of the same name nest, except in
+  script and head.  html_block reads the tag names in any case, and
+  matches each open tag with its close as the tags are found, in one
+  scan of the text, so a block whose tag is never closed fails without
+  searching the rest of the text again.  html_comment likewise keeps the
+  next "-->", so a comment that is never closed fails at once.
+
+ ***********************************************************************/
+
+#define HTML_PAIRED         1   /* Used as <tag> ... </tag>. */
+#define HTML_NESTS          2   /* May contain blocks of its own name. */
+#define HTML_SELF_CLOSING   4   /* Used as <tag/>. */
+
+#define HTML_OPEN   0
+#define HTML_CLOSE  1
+#define HTML_EMPTY  2
+
+static const struct {
+    const char *name;
+    int flags;
+} html_block_tags[HTML_BLOCK_TAGS] = {    /* Sorted by name. */
+    { "address",    HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING },
+    { "blockquote", HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING },
+    { "center",     HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING },
+    { "dd",         HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING },
+    { "dir",        HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING },
+    { "div",        HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING },
+    { "dl",         HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING },
+    { "dt",         HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING },
+    { "fieldset",   HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING },
+    { "form",       HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING },
+    { "frameset",   HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING },
+    { "h1",         HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING },
+    { "h2",         HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING },
+    { "h3",         HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING },
+    { "h4",         HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING },
+    { "h5",         HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING },
+    { "h6",         HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING },
+    { "head",       HTML_PAIRED },
+    { "hr",         HTML_SELF_CLOSING },
+    { "isindex",    HTML_SELF_CLOSING },
+    { "li",         HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING },
+    { "menu",       HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING },
+    { "noframes",   HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING },
+    { "noscript",   HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING },
+    { "ol",         HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING },
+    { "p",          HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING },
+    { "pre",        HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING },
+    { "script",     HTML_PAIRED | HTML_SELF_CLOSING },
+    { "table",      HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING },
+    { "tbody",      HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING },
+    { "td",         HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING },
+    { "tfoot",      HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING },
+    { "th",         HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING },
+    { "thead",      HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING },
+    { "tr",         HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING },
+    { "ul",         HTML_PAIRED | HTML_NESTS | HTML_SELF_CLOSING }
+};
+
+struct html_tag {
+    int pos;
+    int end;
+    int name;       /* Entry of html_block_tags. */
+    int below;      /* For an open tag, the one it was opened inside. */
+    int match;      /* For an open tag, the tag closing it, or -1. */
+};
+
+#define html_alnum(c) (((c) >= '0' && (c) <= '9') || ((c) >= 'A' && (c) <= 'Z') || ((c) >= 'a' && (c) <= 'z'))
+
+/* html_spnl - the end of the Spnl at pos */
+static int html_spnl(char *s, int pos, int limit) {
+    while (pos < limit && (s[pos] == ' ' || s[pos] == '\t'))
+        pos++;
+    if (pos < limit && (s[pos] == '\n' || s[pos] == '\r')) {
+        pos += s[pos] == '\r' && pos + 1 < limit && s[pos + 1] == '\n' ? 2 : 1;
+        while (pos < limit && (s[pos] == ' ' || s[pos] == '\t'))
+            pos++;
+    }
+    return pos;
+}
+
+/* html_attributes - the end of the HtmlAttributes at pos */
+static int html_attributes(char *s, int pos, int limit) {
+    int value, q;
+    while (pos < limit && (html_alnum(s[pos]) || s[pos] == '-')) {
+        while (pos < limit && (html_alnum(s[pos]) || s[pos] == '-'))
+            pos++;
+        pos = html_spnl(s, pos, limit);
+        if (pos < limit && s[pos] == '=') {
+            value = html_spnl(s, pos + 1, limit);
+            q = value;
+            if (q < limit && (s[q] == '"' || s[q] == '\'')) {
+                for (q++; q < limit && s[q] != s[value]; q++)
+                    ;
+                q = q < limit ? q + 1 : value;
+            }
+            if (q == value)
+                while (q < limit && s[q] != '>' && s[q] != ' ' && s[q] != '\t' && s[q] != '\n' && s[q] != '\r')
+                    q++;
+            if (q > value)
+                pos = q;
+        }
+        pos = html_spnl(s, pos, limit);
+    }
+    return pos;
+}
+
+/* html_tag - if a block tag starts at pos, return its end and set its
+ * name and kind: HTML_OPEN, HTML_CLOSE or HTML_EMPTY.  Return -1 if not. */
+static int html_tag(char *s, int pos, int limit, int *name, int *kind) {
+    char lower[12];
+    int len = 0;
+    int lo, hi, cmp;
+    int flags;
+
+    if (pos >= limit || s[pos] != '<')
+        return -1;
+    pos = html_spnl(s, pos + 1, limit);
+    *kind = HTML_OPEN;
+    if (pos < limit && s[pos] == '/') {
+        *kind = HTML_CLOSE;
+        pos++;
+    }
+    while (pos < limit && html_alnum(s[pos])) {
+        if (len == sizeof(lower) - 1)
+            return -1;
+        lower[len++] = s[pos] >= 'A' && s[pos] <= 'Z' ? s[pos] - 'A' + 'a' : s[pos];
+        pos++;
+    }
+    lower[len] = '\0';
+    lo = 0;
+    hi = HTML_BLOCK_TAGS;
+    while (lo < hi) {
+        *name = (lo + hi) / 2;
+        cmp = strcmp(lower, html_block_tags[*name].name);
+        if (cmp == 0)
+            break;
+        if (cmp < 0)
+            hi = *name;
+        else
+            lo = *name + 1;
+    }
+    if (lo == hi)
+        return -1;
+    flags = html_block_tags[*name].flags;
+
+    pos = html_spnl(s, pos, limit);
+    if (*kind == HTML_OPEN)
+        pos = html_attributes(s, pos, limit);
+    if (pos < limit && s[pos] == '>')
+        return (flags & HTML_PAIRED) ? pos + 1 : -1;
+    if (*kind == HTML_OPEN && pos < limit && s[pos] == '/') {
+        pos = html_spnl(s, pos + 1, limit);
+        *kind = HTML_EMPTY;
+        if (pos < limit && s[pos] == '>' && (flags & HTML_SELF_CLOSING))
+            return pos + 1;
+    }
+    return -1;
+}
+
+/* html_scan - find the next open or close tag, matching each close tag
+ * with the open tags it closes; false if out of memory */
+static bool html_scan(parser_context *ctx) {
+    html_index *index = &ctx->html;
+    char *s = ctx->buf;
+    int limit = ctx->limit;
+    int pos = index->scanned;
+    int end, name, kind, i;
+    char *lt;
+    struct html_tag *t;
+
+    for (; pos < limit; pos++) {
+        lt = memchr(s + pos, '<', limit - pos);
+        if (lt == NULL)
+            break;
+        pos = lt - s;
+        end = html_tag(s, pos, limit, &name, &kind);
+        if (end < 0 || kind == HTML_EMPTY)
+            continue;
+        if (index->count == index->max) {
+            t = grow_buffer(ctx, index->tags, (index->max ? 2 * index->max : 64) * sizeof(struct html_tag));
+            if (t == NULL)
+                return false;
+            index->tags = t;
+            index->max = index->max ? 2 * index->max : 64;
+        }
+        i = index->count++;
+        t = &index->tags[i];
+        t->pos = pos;
+        t->end = end;
+        t->name = name;
+        t->match = -1;
+        if (kind == HTML_OPEN) {
+            t->below = index->open[name];
+            index->open[name] = i;
+        } else {
+            /* A close tag closes the innermost open tag of its name, or
+             * every open one if the name does not nest. */
+            do {
+                if (index->open[name] < 0)
+                    break;
+                index->tags[index->open[name]].match = i;
+                index->open[name] = index->tags[index->open[name]].below;
+            } while (!(html_block_tags[name].flags & HTML_NESTS));
+        }
+        index->scanned = pos + 1;
+        return true;
+    }
+    index->scanned = limit;
+    return true;
+}
+
+/* html_element - if an element with a block tag starts at the current
+ * position, move past it.  With script, only a paired script tag will do. */
+static bool html_element(parser_context *ctx, bool script) {
+    html_index *index = &ctx->html;
+    int pos = ctx->pos;
+    int end, name, kind, i;
+    int lo, hi, mid;
+
+    end = html_tag(ctx->buf, pos, ctx->limit, &name, &kind);
+    if (end < 0 || kind == HTML_CLOSE)
+        return false;
+    if (script && (kind != HTML_OPEN || strcmp(html_block_tags[name].name, "script") != 0))
+        return false;
+    if (kind == HTML_EMPTY) {
+        ctx->pos = end;
+        return true;
+    }
+
+    if (index->gen != ctx->parse) {
+        index->gen = ctx->parse;
+        index->count = 0;
+        index->scanned = 0;
+        for (i = 0; i < HTML_BLOCK_TAGS; i++)
+            index->open[i] = -1;
+    }
+    while (index->scanned <= pos && index->scanned < ctx->limit)
+        if (!html_scan(ctx))
+            return false;
+    lo = 0;
+    hi = index->count;
+    while (lo < hi) {
+        mid = (lo + hi) / 2;
+        if (index->tags[mid].pos < pos)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    assert(lo < index->count && index->tags[lo].pos == pos);
+    while (index->tags[lo].match < 0 && index->scanned < ctx->limit)
+        if (!html_scan(ctx))
+            return false;
+    if (index->tags[lo].match < 0)
+        return false;
+    ctx->pos = index->tags[index->tags[lo].match].end;
+    return true;
+}
+
+/* html_block - if an HTML block other than a comment starts at the
+ * current position, move past it */
+static bool html_block(parser_context *ctx) {
+    return html_element(ctx, false);
+}
+
+/* html_script - if a script element starts at the '<' before the
+ * current position, move past it */
+static bool html_script(parser_context *ctx) {
+    ctx->pos--;
+    return html_element(ctx, true);
+}
+
+/* html_comment - move past the rest of an HtmlComment, whose "<!--"
+ * ends at the current position.  Every position a search for "-->" passes has the same close,
+ * so the span of the last search is kept, and a search that reaches it,
+ * from before or within, ends there.  A run of comments that are never
+ * closed is thus searched once, in either order. */
+static bool html_comment(parser_context *ctx) {
+    html_index *index = &ctx->html;
+    char *s = ctx->buf;
+    int start = ctx->pos;
+    bool kept;
+    int end, close, at;
+
+    kept = index->comment_gen == ctx->parse && start <= index->comment_close;
+    /* A "-->" that begins before comment_from ends before its third byte. */
+    end = kept && index->comment_from + 2 < ctx->limit ? index->comment_from + 2 : ctx->limit;
+    for (at = start; at + 3 <= end && strncmp(s + at, "-->", 3) != 0; at++) ;
+    if (kept && at + 3 > end) {
+        close = index->comment_close;
+        if (start < index->comment_from)
+            index->comment_from = start;
+    } else {
+        close = at + 3 <= end ? at : ctx->limit;
+        index->comment_gen = ctx->parse;
+        index->comment_from = start;
+        index->comment_close = close;
+    }
+    if (close >= ctx->limit)
+        return false;
+    ctx->pos = close + 3;
+    return true;
+}
+
+
+/**********************************************************************
+
+  Nested blockquotes and lists.  The text of a blockquote or list item
+  is parsed again as a document, so each level of a nested blockquote
+  or list would parse, and copy, all the levels inside it.  When every
+  line of a text is quoted, its parse is known to be one blockquote
+  holding those lines with one prefix taken off, blank lines becoming
+  "\n", and a newline added.  parse_quotes reads the stack of '>'
+  prefixes of each line once and builds the levels of such a text down
+  to the first one that is not all quoted, whose text is left as a RAW
+  to be parsed.
+
+  Likewise, when every line of a text is a list item indented four
+  spaces for each level it is nested, or blank, its parse is known:
+  each item holds the parse of its own line, followed by the list of
+  the items nested under it, and a list is loose if a blank line lies
+  inside it.  parse_lists keeps the stack of open lists as it reads the
+  lines, and parses only the text of each item; the RAW of an item
+  whose text is followed by blank lines starts with a paragraph line,
+  which parse_lists allows before the list.  A list with an item of more
+  than one line is left to the grammar, and parsed again at each level.
+  A note holds no notes, so its text is parsed again only once.
+
+ ***********************************************************************/
+
+/* quote_prefixes - the number of '>' prefixes at the start of a line,
+ * setting *rest to the text after them */
+static int quote_prefixes(char *line, char **rest) {
+    int count = 0;
+    while (*line == '>') {
+        line++;
+        if (*line == ' ')
+            line++;
+        count++;
+    }
+    *rest = line;
+    return count;
+}
+
+/* parse_quotes - the parse of a text whose lines are all quoted, or
+ * NULL if they are not */
+static element * parse_quotes(parser_context *ctx, char *string, size_t len) {
+    char *end = string + len;
+    char *line, *next, *rest, *text;
+    int depth = 0;
+    int count, i;
+    size_t size;
+    element *inner, *quote = NULL;
+
+    if (len == 0 || string[0] != '>' || string[len - 1] != '\n' ||
+        memchr(string, '\r', len) != NULL || memchr(string, '\001', len) != NULL)
+        return NULL;
+
+    /* A line that is not blank after its prefixes is lazy text at that
+     * level, which ends the levels that are all quoted.  So does the
+     * first line if it becomes blank. */
+    for (line = string; line < end; line = next) {
+        next = (char *) memchr(line, '\n', end - line) + 1;
+        count = quote_prefixes(line, &rest);
+        if (line == string || (count < depth && !blank_until(rest, next)))
+            depth = count;
+    }
+    if (depth <= 0)
+        return NULL;
+
+    size = len + depth;
+    text = arena_alloc(ctx->arena, size);
+    size = 0;
+    for (line = string; line < end; line = next) {
+        next = (char *) memchr(line, '\n', end - line) + 1;
+        for (i = 0; i < depth && *line == '>'; i++) {
+            line++;
+            if (*line == ' ')
+                line++;
+        }
+        if (i < depth)
+            line = next - 1;    /* Blank at a level above the last. */
+        memcpy(text + size, line, next - line);
+        size += next - line;
+    }
+    memset(text + size, '\n', depth);
+    size += depth;
+
+    inner = mk_str_slice(ctx->arena, text, size);
+    inner->key = RAW;
+    for (i = depth; i > 0; i--) {
+        quote = mk_element(ctx->arena, BLOCKQUOTE);
+        quote->children = inner;
+        if (i > 1) {
+            /* What parse_raw_block leaves of the RAW it has parsed. */
+            inner = mk_element(ctx->arena, LIST);
+            inner->children = quote;
+        }
+    }
+    return quote;
+}
+
+/* list_item - the level of a line of a list that parse_lists builds,
+ * setting *text to the text of the item, or -1 if it is not one */
+static int list_item(char *line, char **text) {
+    char *s = line;
+    int spaces;
+
+    while (*s == ' ')
+        s++;
+    spaces = s - line;
+    if (spaces % 4 != 0)
+        return -1;
+    if (*s == '+' || *s == '*' || *s == '-')
+        s++;
+    else if (*s >= '0' && *s <= '9') {
+        while (*s >= '0' && *s <= '9')
+            s++;
+        if (*s++ != '.')
+            return -1;
+    } else
+        return -1;
+    if (*s != ' ' && *s != '\t')
+        return -1;
+    while (*s == ' ' || *s == '\t')
+        s++;
+    if (*s == '\n')
+        return -1;
+    *text = s;
+    return spaces / 4;
+}
+
+/* rule_text - true if a line would be a horizontal rule were a blank
+ * line to follow it */
+static bool rule_text(char *s) {
+    char c = *s;
+    int count = 0;
+
+    if (c != '*' && c != '-' && c != '_')
+        return false;
+    for (; *s != '\n'; s++) {
+        if (*s == c)
+            count++;
+        else if (*s != ' ' && *s != '\t')
+            return false;
+    }
+    return count >= 3;
+}
+
+/* lead_line - true if the block of a line followed by blank lines ends
+ * with them, whatever comes after: the line is not an item, rule, code,
+ * definition or HTML, and holds no HTML or link title, which may run
+ * on past a blank line */
+static bool lead_line(char *line, char *next) {
+    char *text;
+    char *s;
+
+    if (*line == ' ' || *line == '\t' || *line == '\n' || *line == '[' ||
+        list_item(line, &text) >= 0 || rule_text(line) || memchr(line, '<', next - line) != NULL)
+        return false;
+    for (s = line; s + 1 < next; s++)
+        if (s[0] == ']' && s[1] == '(')
+            return false;
+    return true;
+}
+
+/* next_line - the start of the line after the one at line */
+static char * next_line(char *line, char *end) {
+    return (char *) memchr(line, '\n', end - line) + 1;
+}
+
+/* parse_lists - the parse of a text whose lines are all items of a
+ * list or blank, after at most a paragraph of one line, or NULL if it
+ * is not such a text */
+static element * parse_lists(parser_context *ctx, char *string, size_t len) {
+    char *end = string + len;
+    char *start = string;
+    char *line, *next, *text, *copy;
+    char *last = NULL;
+    char *after = NULL;
+    int depth = 0;
+    int max = 0;
+    int count = 0;
+    int prev = -1;
+    int level, nested, i;
+    bool blank = false;
+    bool blanks = false;
+    bool rules = false;
+    bool *loose;
+    int *open;
+    element **items;
+    element *item, *list, **tail, *blocks = NULL;
+
+    if (len == 0 || string[len - 1] != '\n' ||
+        memchr(string, '\r', len) != NULL || memchr(string, '\001', len) != NULL)
+        return NULL;
+
+    /* The line of a paragraph may come first, with blank lines after it. */
+    if (list_item(string, &text) < 0) {
+        next = next_line(string, end);
+        if (!lead_line(string, next))
+            return NULL;
+        for (start = next; start < end && blank_until(start, next_line(start, end)); start = next_line(start, end))
+            ;
+        if (start == next || start == end)
+            return NULL;
+    }
+
+    /* An item nested more than one level below the line before it would
+     * be text of that item rather than an item of its own.  So would the
+     * text of an item followed by blank lines and a nested list, unless
+     * it ends with the blank lines.  An item that looks like a rule is
+     * one if a blank line follows it, as the "\n\n" added to the RAW of
+     * a loose item may, so such items are built only where no line is
+     * blank. */
+    for (line = start; line < end; line = next) {
+        next = next_line(line, end);
+        if (blank_until(line, next)) {
+            blank = blanks = true;
+            continue;
+        }
+        level = list_item(line, &text);
+        if (level < 0 || level > depth)
+            return NULL;
+        if (blank && level > prev && prev >= 0 && !lead_line(last, after))
+            return NULL;
+        if (rule_text(line + 4 * level))
+            rules = true;
+        if (level == depth)
+            count++;
+        last = text;
+        after = next;
+        prev = level;
+        depth = level + 1;
+        if (depth > max)
+            max = depth;
+        blank = false;
+    }
+    if (rules && blanks)
+        return NULL;
+
+    /* A list is loose if a blank line lies between two of its lines.
+     * open[i] is the list open at level i; if a list is loose, so are
+     * the lists it is nested in. */
+    open = arena_alloc(ctx->arena, max * sizeof(int));
+    loose = arena_alloc(ctx->arena, count * sizeof(bool));
+    memset(loose, 0, count * sizeof(bool));
+    count = 0;
+    depth = 0;
+    prev = -1;
+    blank = false;
+    for (line = start; line < end; line = next) {
+        next = next_line(line, end);
+        if (blank_until(line, next)) {
+            blank = true;
+            continue;
+        }
+        level = list_item(line, &text);
+        if (blank && prev >= 0)
+            for (i = level < prev ? level : prev; i >= 0 && !loose[open[i]]; i--)
+                loose[open[i]] = true;
+        if (level == depth)
+            open[level] = count++;
+        prev = level;
+        depth = level + 1;
+        blank = false;
+    }
+
+    /* items[i] is the last item read at level i.  The RAW of an item is
+     * its text, then the lines of its nested list: after \001 if no
+     * blank line comes between, and with "\n\n" added at the end if its
+     * list is loose. */
+    items = arena_alloc(ctx->arena, max * sizeof(element *));
+    count = 0;
+    depth = 0;
+    for (line = start; line < end; line = next) {
+        next = next_line(line, end);
+        if (blank_until(line, next))
+            continue;
+        level = list_item(line, &text);
+        for (after = next; after < end && blank_until(after, next_line(after, end)); after = next_line(after, end))
+            ;
+        nested = after < end && list_item(after, &copy) == level + 1;
+        if (level == depth)
+            open[level] = count++;
+        item = mk_element(ctx->arena, LISTITEM);
+        /* What parse_raw_block leaves of the item's RAW. */
+        item->children = mk_element(ctx->arena, LIST);
+        if (nested)
+            item->children->children = parse_blocks(ctx, text, after - text);
+        else if (loose[open[level]]) {
+            copy = arena_alloc(ctx->arena, next - text + 2);
+            memcpy(copy, text, next - text);
+            memcpy(copy + (next - text), "\n\n", 2);
+            item->children->children = parse_blocks(ctx, copy, next - text + 2);
+        } else
+            item->children->children = parse_blocks(ctx, text, next - text);
+        if (level == depth) {
+            list = mk_element(ctx->arena, line[4 * level] >= '0' && line[4 * level] <= '9' ? ORDEREDLIST : BULLETLIST);
+            list->children = item;
+            if (level == 0)
+                blocks = list;
+            else {
+                for (tail = &items[level - 1]->children->children; *tail != NULL; tail = &(*tail)->next)
+                    ;
+                *tail = list;
+            }
+        } else
+            items[level]->next = item;
+        items[level] = item;
+        depth = level + 1;
+    }
+
+    if (start > string) {
+        list = parse_blocks(ctx, string, start - string);
+        for (tail = &list; *tail != NULL; tail = &(*tail)->next)
+            ;
+        *tail = blocks;
+        blocks = list;
+    }
+    return blocks;
+}
+
+
+/**********************************************************************
+
+  Block boundaries.  parse_segments splits a document between top-level
+  blocks.  Definitions steps over the document a block at a time, so
+  note_boundary records the steps that begin after a blank line with a
+  letter, which no list, code block or block quote continues past, for
+  parse_segments to choose from.
+
+ ***********************************************************************/
+
+/* note_boundary - record the current position if a line that follows
+ * a blank line and begins with a letter starts there; always true.  Out
+ * of memory, it is not recorded, and the document is split less. */
+static bool note_boundary(parser_context *ctx) {
+    boundary_list *list = &ctx->boundaries;
+    char *s = ctx->buf;
+    int pos = ctx->pos;
+    int *offsets;
+    int p;
+
+    if (pos == 0 || pos >= ctx->limit || s[pos - 1] != '\n')
+        return true;
+    if (!((s[pos] >= 'a' && s[pos] <= 'z') || (s[pos] >= 'A' && s[pos] <= 'Z')))
+        return true;
+    for (p = pos - 2; p >= 0 && (s[p] == ' ' || s[p] == '\t' || s[p] == '\r'); p--)
+        ;
+    if (p >= 0 && s[p] != '\n')
+        return true;
+    if (list->count == list->max) {
+        offsets = arena_buffer(ctx->arena, list->offsets, (list->max ? 2 * list->max : 256) * sizeof(int));
+        if (offsets == NULL)
+            return true;
+        list->offsets = offsets;
+        list->max = list->max ? 2 * list->max : 256;
+    }
+    list->offsets[list->count++] = pos;
+    return true;
+}
+
+
+/**********************************************************************
+
+  Deferred references.  With EXT_DEFER_REFERENCES, a reference link is
+  not looked up while it is parsed, so the references need not be
+  collected before the parse.  It becomes a LINK or IMAGE with no URL
+  until resolve_references looks its label up among the top-level
+  REFERENCE blocks of the document.
+
+ ***********************************************************************/
+
+/* defer_link - make a LINK with the given text and no URL, whose
+ * children are a LIST of the label to look up followed by the literal
+ * text to use if there is no such reference */
+static element * defer_link(parser_context *ctx, element *text, element *label, element *literal) {
+    element *result;
+    result = mk_link(ctx->arena, text, NULL, NULL);
+    result->children = mk_element(ctx->arena, LIST);
+    result->children->children = label;
+    result->children->next = literal;
+    return result;
+}
+
+/* resolve_links - resolve the deferred links in an element list and
+ * the elements within it.  A note reference shares the children of its
+ * note, which may hold the reference itself, so each note reference or
+ * inline note is entered once and then marked with a nonzero len. */
+static void resolve_links(parser_context *ctx, element *elt) {
+    element *label;
+    element *literal;
+    link match;
+
+    for (; elt != NULL; elt = elt->next) {
+        if ((elt->key == LINK || elt->key == IMAGE) && elt->contents.link->url == NULL) {
+            /* Links within the label are resolved first, as they would
+             * have been before the label was looked up.  Through a note
+             * reference, that may reach this link and resolve it. */
+            label = elt->children;
+            literal = label->next;
+            resolve_links(ctx, label->children);
+            if (elt->children != label) {
+                /* Resolved already. */
+            } else if (find_reference(&match, label->children, ctx->reference_index)) {
+                elt->contents.link->url = match.url;
+                elt->contents.link->title = match.title;
+                elt->children = NULL;
+            } else {
+                if (elt->key == IMAGE)
+                    literal->children = cons(mk_str(ctx->arena, "!"), literal->children);
+                elt->key = LIST;
+                elt->contents.str = NULL;
+                elt->children = literal->children;
+            }
+        }
+        if (elt->key == LINK || elt->key == IMAGE) {
+            resolve_links(ctx, elt->contents.link->label);
+        } else if (elt->key == NOTE && elt->contents.str == NULL) {
+            if (elt->len == 0) {
+                elt->len = 1;
+                resolve_links(ctx, elt->children);
+            }
+        } else {
+            resolve_links(ctx, elt->children);
+        }
+    }
+}
+
+
+/**********************************************************************
+
+  Parser contexts and entry points.  A context holds the state of one
+  conversion; its buffers are reused by every parse made with it.
+
+ ***********************************************************************/
+
+/* new_parser_context - allocate an empty context, or return NULL if out
+ * of memory; see arena_context */
+parser_context * new_parser_context(void) {
+    return calloc(1, sizeof(parser_context));
+}
+
+/* use_parser_context - the context kept by the arena, set up for a
+ * conversion with the given extensions that builds elements in the
+ * arena, or NULL if out of memory.  What the last conversion left in it
+ * is forgotten; the indexes of the input are keyed on the parse, so only
+ * the lists that outlive a parse are cleared. */
+parser_context * use_parser_context(markdown_arena *arena, int extensions) {
+    parser_context *ctx = arena_context(arena);
+    if (ctx == NULL)
+        return NULL;
+    ctx->arena = arena;
+    ctx->references = NULL;
+    ctx->notes = NULL;
+    ctx->reference_index = NULL;
+    ctx->note_index = NULL;
+    ctx->parse_result = NULL;
+    ctx->segment_end = NULL;
+    ctx->loose_list = false;
+    ctx->memolimit = arena_memo_limit(arena);
+    ctx->flat_inlines = NESTED_INLINES;
+    ctx->boundaries.count = 0;
+    ctx->document = NULL;
+    ctx->syntax_extensions = extensions;
+    set_normal_chars(ctx);
+    return ctx;
+}
+
+/* copy_parser_context - the context kept by the given arena, set up
+ * with the extensions, the indexed references and notes, the document
+ * lines and the memo limit of ctx, or NULL if out of memory.
+ * The indexes are shared, not copied, so ctx must outlive the use. */
+parser_context * copy_parser_context(parser_context *ctx, markdown_arena *arena) {
+    parser_context *copy = use_parser_context(arena, ctx->syntax_extensions);
+    if (copy == NULL)
+        return NULL;
+    copy->references = ctx->references;
+    copy->reference_index = ctx->reference_index;
+    copy->notes = ctx->notes;
+    copy->note_index = ctx->note_index;
+    copy->document = ctx->document;
+    copy->memolimit = ctx->memolimit;
+    return copy;
+}
+
+/* free_parser_context - free a context and the buffers it owns; called
+ * by the arena that keeps it */
+void free_parser_context(parser_context *ctx) {
+    yyrelease(ctx);
+    free(ctx->brackets.slots);
+    free(ctx->brackets.path);
+    free(ctx->ticks.runs);
+    free(ctx->html.tags);
+    free(ctx->lines.lines);
+    free(ctx->document_lines.lines);
+    free(ctx->boundaries.offsets);
+    free(ctx);
+}
+
+/* begin_block - note where the parse of a block begins, so that
+ * retry_block can resume it there, and parse it with every inline;
+ * always true */
+static bool begin_block(parser_context *ctx) {
+    yyMark(ctx);
+    ctx->memokeep = 0;
+    ctx->flat_inlines = NESTED_INLINES;
+    ctx->block_start = ctx->block_filled = ctx->pos;
+    return true;
+}
+
+/* blank_line_after - the start of the first blank line that begins at
+ * or after pos, or the limit if there is none */
+static int blank_line_after(parser_context *ctx, int pos) {
+    struct line *line;
+    while ((line = find_line(ctx, pos)) != NULL
+           && (line->lead < line->end || line->start - ctx->line_offset < pos)) {
+        pos = line->end - ctx->line_offset;
+        pos += ctx->buf[pos] == '\r' && pos + 1 < ctx->limit && ctx->buf[pos + 1] == '\n' ? 2 : 1;
+    }
+    return line == NULL ? ctx->limit : line->start - ctx->line_offset;
+}
+
+/* memoize_inlines - record the outcomes of Inline, and of SourceContents
+ * after a '(', at each position from end back to start where they may
+ * nest.  A Str holds no other inline, so positions of a NormalChar are
+ * left out.  A span of emphasis may go on from any position, so the
+ * outcomes of its Tails are recorded at every one.  Each call finds the
+ * ones nested in it recorded, so none nests deeply; with memokeep set,
+ * none is forgotten. */
+static void memoize_inlines(parser_context *ctx, int start, int end) {
+    static int (*const tails[])(parser_context *) = {
+        yy_EmphStarTail, yy_EmphUlTail, yy_StrongStarTail, yy_StrongUlTail, yy_StrikeTail
+    };
+    int ntails = extension(EXT_STRIKE) ? 5 : 4;
+    int pos = ctx->pos;
+    int thunkpos = ctx->thunkpos;
+    int begin = ctx->begin;
+    int text_end = ctx->end;
+    int q, i;
+
+    for (q = end - 1; q >= start && !ctx->nomem; q--) {
+        if (q > 0 && ctx->buf[q - 1] == '(') {
+            ctx->pos = q;
+            yy_SourceContents(ctx);
+            ctx->thunkpos = thunkpos;
+        }
+        if (!ctx->normal[(unsigned char) ctx->buf[q]]) {
+            ctx->pos = q;
+            yy_Inline(ctx);
+            ctx->thunkpos = thunkpos;
+        }
+        for (i = 0; i < ntails && !ctx->nomem; i++) {
+            ctx->pos = q;
+            tails[i](ctx);
+            ctx->thunkpos = thunkpos;
+        }
+    }
+    ctx->pos = pos;
+    ctx->begin = begin;
+    ctx->end = text_end;
+}
+
+/* retry_block - if the parse of the block by rule was abandoned because
+ * its inlines nest thousands deep, as in a long paragraph of unmatched
+ * '*' and '_', resume it with the Inlines of the block memoized, so that
+ * rule can parse it again; false if it was not abandoned for that, or
+ * cannot be parsed however many are memoized, or they would need more
+ * than the memo limit (see yyKeepRoom in leg).  The Inlines are memoized
+ * up to the first blank line, and each time a trial parse by rule is
+ * abandoned again, over twice as much text. */
+static bool retry_block(parser_context *ctx, int (*rule)(parser_context *)) {
+    int start = ctx->block_start;
+    int thunkpos = ctx->thunkpos;
+    int begin = ctx->begin;
+    int text_end = ctx->end;
+    int end;
+
+    if (ctx->nomem != 2)
+        return false;
+    while (ctx->nomem == 2 && ctx->block_filled < ctx->limit) {
+        yyResume(ctx);
+        ctx->memokeep = 1;
+        end = 2 * ctx->block_filled - start + 1;
+        if (end > ctx->limit)
+            end = ctx->limit;
+        ctx->block_filled = blank_line_after(ctx, end);
+        memoize_inlines(ctx, start, ctx->block_filled);
+        if (!ctx->nomem) {
+            rule(ctx);
+            ctx->pos = start;
+            ctx->thunkpos = thunkpos;
+        }
+    }
+    ctx->begin = begin;
+    ctx->end = text_end;
+    return !ctx->nomem;
+}
+
+/* flatten_block - if the parse of the block was abandoned, because its
+ * inlines nest too deeply for the stack and the memo limit, resume it
+ * with the inlines of level left as text, and say so on stderr, since
+ * the output is not what the grammar would give; false if it was not
+ * abandoned, or already had them left as text */
+static bool flatten_block(parser_context *ctx, int level) {
+    if (ctx->flat_inlines >= level || !yyResume(ctx))
+        return false;
+    ctx->memokeep = 0;
+    ctx->flat_inlines = level;
+    fprintf(stderr, "markdown: inlines nested too deeply; %s left as text\n",
+            level == FLAT_EMPHASIS ? "emphasis" : "emphasis, links, notes and quotes");
+    return true;
+}
+
+/* parse_from - parse len bytes of string from the rule start.  If the
+ * parser runs out of memory, the conversion fails through arena_fail. */
+static void parse_from(parser_context *ctx, char *string, size_t len, yyrule start) {
+    ctx->parse++;
+    ctx->parse_result = NULL;
+    use_lines(ctx, string, len);
+    yysetbuffer(ctx, string, len);
+    if (!yyparsefrom(ctx, start) && ctx->nomem)
+        arena_fail(ctx->arena);
+}
+
+/* use_references - set the references for the next parse, indexing
+ * them unless they are the ones already indexed */
+static void use_references(parser_context *ctx, element *reference_list) {
+    if (ctx->reference_index == NULL || ctx->references != reference_list) {
+        ctx->references = reference_list;
+        ctx->reference_index = index_references(ctx->arena, reference_list);
+    }
+}
+
+/* use_notes - set the notes for the next parse, as use_references */
+static void use_notes(parser_context *ctx, element *note_list) {
+    if (ctx->note_index == NULL || ctx->notes != note_list) {
+        ctx->notes = note_list;
+        ctx->note_index = index_notes(ctx->arena, note_list);
+    }
+}
+
+/* parse_definitions - collect the link references of a document and,
+ * with the notes extension, its notes, in one pass that also records
+ * where its top-level blocks may begin; see block_boundaries */
+void parse_definitions(parser_context *ctx, char *string, element **references, element **notes) {
+
+    ctx->references = NULL;
+    ctx->reference_index = NULL;
+    ctx->notes = NULL;
+    ctx->note_index = NULL;
+    ctx->boundaries.count = 0;
+
+    parse_from(ctx, string, strlen(string), yy_Definitions);
+    use_references(ctx, ctx->references);
+    use_notes(ctx, ctx->notes);
+    *references = ctx->references;
+    *notes = ctx->notes;
+}
+
+/* block_boundaries - the offsets found by parse_definitions of lines
+ * that follow a blank line, begin with a letter and begin a step of its
+ * pass, in increasing order.  No list, code block or block quote
+ * continues past such a line, so it usually begins a top-level block. */
+int * block_boundaries(parser_context *ctx, int *count) {
+    *count = ctx->boundaries.count;
+    return ctx->boundaries.offsets;
+}
+
+element * parse_markdown(parser_context *ctx, char *string, size_t len, element *reference_list, element *note_list) {
+    element *quote, *list;
+
+    use_references(ctx, reference_list);
+    use_notes(ctx, note_list);
+
+    quote = parse_quotes(ctx, string, len);
+    if (quote != NULL)
+        return quote;
+    list = parse_lists(ctx, string, len);
+    if (list != NULL)
+        return list;
+
+    return parse_blocks(ctx, string, len);
+}
+
+/* parse_blocks - the blocks of a text as the grammar parses them */
+static element * parse_blocks(parser_context *ctx, char *string, size_t len) {
+    ctx->segment_end = NULL;
+    parse_from(ctx, string, len, yy_Doc);
+#ifdef __DEBUG__
+    yymemoreport(ctx, stderr);
+#endif
+
+    return ctx->parse_result;
+}
+
+element * parse_segment(parser_context *ctx, char *string, size_t start, size_t limit, size_t len,
+                        size_t *end, element *reference_list, element *note_list) {
+    char *stop;
+
+    use_references(ctx, reference_list);
+    use_notes(ctx, note_list);
+
+    /* Blocks that begin before the limit are parsed with the rest of the
+     * document as lookahead, exactly as parse_markdown would parse them. */
+    ctx->segment_end = string + limit;
+    parse_from(ctx, string + start, len - start, start == 0 ? yy_Doc : yy_Blocks);
+    stop = ctx->buf;
+    ctx->segment_end = NULL;
+
+    if (stop < string + limit && blank_until(stop, string + limit))
+        stop = string + limit;
+    *end = stop - string;
+    return ctx->parse_result;
+}
+
+/* resolve_references - resolve the deferred links of a document's
+ * blocks and notes against its top-level REFERENCE blocks.  The labels
+ * of the references are resolved against no references at all, as
+ * they are when the references are collected before the parse. */
+void resolve_references(parser_context *ctx, element *blocks, element *notes) {
+    element *references = NULL;
+    element *cur;
+    element *ref;
+
+    use_references(ctx, NULL);
+    for (cur = blocks; cur != NULL; cur = cur->next)
+        if (cur->key == REFERENCE) {
+            resolve_links(ctx, cur->contents.link->label);
+            ref = mk_element(ctx->arena, REFERENCE);
+            ref->contents.link = cur->contents.link;
+            references = cons(ref, references);
+        }
+    use_references(ctx, reverse(references));
+    resolve_links(ctx, notes);
+    resolve_links(ctx, blocks);
+}
+
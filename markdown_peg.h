@@ -53,21 +53,37 @@ enum keys { LIST,   /* A generic list of values.  For ordered and bullet lists,
             NOTE
           };
 
-/* Semantic value of a parsing action. */
+/* Semantic value of a parsing action.  A string content is a slice of
+ * 'len' bytes, usually pointing straight into the parser's input; it is
+ * not null-terminated. */
 struct Element {
     int               key;
     union Contents    contents;
+    size_t            len;
     struct Element    *children;
     struct Element    *next;
 };
 
 typedef struct Element element;
 
-element * parse_references(char *string, int extensions);
-element * parse_notes(char *string, int extensions, element *reference_list);
-element * parse_markdown(char *string, int extensions, element *reference_list, element *note_list);
-void free_element_list(element * elt);
-void free_element(element *elt);
+/* State of one conversion; defined by the generated parser. */
+typedef struct _yycontext parser_context;
+
+#include "parsing_functions.h"
+
 void print_element_list(GString *out, element *elt, int format, int exts);
 
+/* Seconds spent in each phase of a conversion. */
+typedef struct {
+    double preformat;   /* Tab expansion. */
+    double definitions; /* Collecting link references and notes. */
+    double blocks;      /* Parsing the top-level blocks. */
+    double raw_blocks;  /* Parsing the blocks nested in them, and resolving
+                           deferred references. */
+    double print;       /* Writing the output format. */
+} conversion_profile;
+
+GString * markdown_convert(markdown_arena *arena, char *text, int extensions, int output_format, int threads,
+                           conversion_profile *profile);
+
 #endif
@@ -1,17 +1,32 @@
 #ifndef PARSING_FUNCTIONS_H
 #define PARSING_FUNCTIONS_H
-/* parsing_functions.c - Functions for parsing markdown and
- * freeing element lists. */
+/* parsing_functions.h - Functions for parsing markdown.  They are
+ * defined in markdown_parser.leg and keep no global state, so separate
+ * contexts may be used concurrently.  Elements are allocated from the
+ * context's arena and freed with it. */
 
 #include "markdown_peg.h"
 
-/* free_element_list - free list of elements recursively */
-void free_element_list(element * elt);
-/* free_element - free element and contents */
-void free_element(element *elt);
+parser_context * new_parser_context(void);
+parser_context * use_parser_context(markdown_arena *arena, int extensions);
+parser_context * copy_parser_context(parser_context *ctx, markdown_arena *arena);
+void free_parser_context(parser_context *ctx);
+/* index_document - find the lines of a document once, for all the
+ * parses of the conversion */
+void index_document(parser_context *ctx, char *string, size_t len);
 
-element * parse_references(char *string, int extensions);
-element * parse_notes(char *string, int extensions, element *reference_list);
-element * parse_markdown(char *string, int extensions, element *reference_list, element *note_list);
+void parse_definitions(parser_context *ctx, char *string, element **references, element **notes);
+int * block_boundaries(parser_context *ctx, int *count);
+element * parse_markdown(parser_context *ctx, char *string, size_t len, element *reference_list, element *note_list);
+/* parse_segment - parse the blocks of string that begin at start and
+ * before limit, as parse_markdown would parse them, and set *end to
+ * where the next block begins.  An *end short of limit means that the
+ * document's blocks end there. */
+element * parse_segment(parser_context *ctx, char *string, size_t start, size_t limit, size_t len,
+                        size_t *end, element *reference_list, element *note_list);
+/* resolve_references - with EXT_DEFER_REFERENCES, look up the reference
+ * links left in blocks and notes by the parse among the top-level
+ * REFERENCE blocks, or turn them back into text */
+void resolve_references(parser_context *ctx, element *blocks, element *notes);
 
 #endif
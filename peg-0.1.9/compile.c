@@ -19,6 +19,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <ctype.h>
 #include <assert.h>
 
 #include "version.h"
@@ -70,13 +71,10 @@ static int cnext(unsigned char **ccp)
     return c;
 }
 
-static char *makeCharClass(unsigned char *cclass)
+static void computeCharClass(unsigned char *cclass, unsigned char bits[32])
 {
-  unsigned char	 bits[32];
   setter	 set;
   int		 c, prev= -1;
-  static char	 string[256];
-  char		*ptr;
 
   if ('^' == *cclass)
     {
@@ -105,6 +103,13 @@ static char *makeCharClass(unsigned char *cclass)
 	  set(bits, prev= c);
 	}
     }
+}
+
+static char *makeBitString(unsigned char bits[32])
+{
+  static char	 string[256];
+  char		*ptr;
+  int		 c;
 
   ptr= string;
   for (c= 0;  c < 32;  ++c)
@@ -113,6 +118,233 @@ static char *makeCharClass(unsigned char *cclass)
   return string;
 }
 
+static char *makeCharClass(unsigned char *cclass)
+{
+  unsigned char	 bits[32];
+
+  computeCharClass(cclass, bits);
+  return makeBitString(bits);
+}
+
+/* If node always matches exactly one byte, and nothing else, the set of
+ * bytes it matches is accumulated in bits and the result is non-zero.
+ */
+static int byteSet(Node *node, unsigned char bits[32])
+{
+  unsigned char	 cbits[32], *ptr;
+  int		 c;
+
+  switch (node->type)
+    {
+    case Character:
+    case String:
+      ptr= (unsigned char *)node->string.value;
+      if (!*ptr) return 0;
+      c= cnext(&ptr);
+      if (*ptr) return 0;
+      charClassSet(bits, c);
+      return 1;
+
+    case Class:
+      computeCharClass(node->cclass.value, cbits);
+      for (c= 0;  c < 32;  ++c)
+	bits[c] |= cbits[c];
+      return 1;
+    }
+  return 0;
+}
+
+static unsigned char *makeClassText(unsigned char bits[32])
+{
+  char	*text= malloc(256 * 4 + 1), *ptr= text;
+  int	 c, last;
+
+  for (c= 0;  c < 256;  ++c)
+    if (bits[c >> 3] & (1 << (c & 7)))
+      {
+	for (last= c;  last < 255 && (bits[(last + 1) >> 3] & (1 << ((last + 1) & 7)));  ++last)
+	  ;
+	ptr += sprintf(ptr, "\\%03o", c);
+	if (last > c)
+	  ptr += sprintf(ptr, "%s\\%03o", last > c + 1 ? "-" : "", last);
+	c= last;
+      }
+  *ptr= '\0';
+  return (unsigned char *)text;
+}
+
+/* Runs of adjacent alternatives that each match one byte, such as
+ * 'a' | 'b' | [0-9], are merged into a single class.  They succeed or
+ * fail alike whatever their order, so one bitmap test replaces the
+ * matches tried one after another.  An alternation left with only a
+ * class becomes that class.
+ */
+static void mergeClasses(Node *node)
+{
+  Node		*alt, *run, *next;
+  unsigned char	 bits[32];
+  int		 count;
+
+  if (!node) return;
+  switch (node->type)
+    {
+    case Alternate:
+      for (alt= node->alternate.first;  alt;  alt= alt->alternate.next)
+	mergeClasses(alt);
+      for (alt= node->alternate.first;  alt;  alt= alt->alternate.next)
+	{
+	  memset(bits, 0, 32);
+	  for (count= 0, run= alt;  run && byteSet(run, bits);  run= run->alternate.next)
+	    ++count;
+	  if (count < 2) continue;
+	  next= run;
+	  alt->type= Class;
+	  alt->cclass.value= makeClassText(bits);
+	  alt->cclass.next= next;
+	  if (!next) node->alternate.last= alt;
+	}
+      if (node->alternate.first == node->alternate.last && Class == node->alternate.first->type)
+	{
+	  unsigned char *value= node->alternate.first->cclass.value;
+	  node->type= Class;
+	  node->cclass.value= value;
+	}
+      break;
+
+    case Sequence:
+      for (alt= node->sequence.first;  alt;  alt= alt->sequence.next)
+	mergeClasses(alt);
+      break;
+
+    case PeekFor:
+    case PeekNot:
+    case Query:
+    case Star:
+    case Plus:
+      mergeClasses(node->query.element);
+      break;
+    }
+}
+
+/* The set of bytes that can begin a match of node is accumulated in
+ * bits.  The result is non-zero if node can also succeed without
+ * consuming input, in which case it must be tried whatever the next
+ * byte is.  A semantic predicate may consume input, so it can begin a
+ * match with any byte or none; only an element that consumes input or a
+ * lookahead such as &'x' before it keeps its sequence from being tried
+ * at every byte.
+ */
+static int firstSet(Node *node, unsigned char bits[32]);
+
+static unsigned char	 (*ruleFirsts)[32]= 0;
+static char		*ruleFirstState= 0;	/* 0 unknown, 1 consuming, 2 nullable */
+
+static int ruleFirstSet(Node *rule, unsigned char bits[32])
+{
+  int id= rule->rule.id, c;
+  if (!ruleFirsts)
+    {
+      ruleFirsts= calloc(ruleCount + 1, 32);
+      ruleFirstState= calloc(ruleCount + 1, 1);
+    }
+  if (!ruleFirstState[id])
+    {
+      if (!rule->rule.expression || (RuleReached & rule->rule.flags))
+	{
+	  memset(bits, 255, 32);			/* undefined or left recursive */
+	  return 1;
+	}
+      rule->rule.flags |= RuleReached;
+      ruleFirstState[id]= firstSet(rule->rule.expression, ruleFirsts[id]) ? 2 : 1;
+      rule->rule.flags &= ~RuleReached;
+    }
+  for (c= 0;  c < 32;  ++c)
+    bits[c] |= ruleFirsts[id][c];
+  return 2 == ruleFirstState[id];
+}
+
+static int firstSet(Node *node, unsigned char bits[32])
+{
+  switch (node->type)
+    {
+    case Dot:
+      memset(bits, 255, 32);
+      return 0;
+
+    case Name:
+      return ruleFirstSet(node->name.rule, bits);
+
+    case Character:
+    case String:
+      {
+	unsigned char *ptr= (unsigned char *)node->string.value;
+	if (!*ptr) return 1;
+	charClassSet(bits, cnext(&ptr));
+	return 0;
+      }
+
+    case Class:
+      {
+	unsigned char cbits[32];
+	int c;
+	computeCharClass(node->cclass.value, cbits);
+	for (c= 0;  c < 32;  ++c)
+	  bits[c] |= cbits[c];
+	return 0;
+      }
+
+    case Predicate:
+      /* the text markers < and > (and peg's empty match) consume nothing */
+      if (strcmp(node->action.text, "YY_BEGIN") && strcmp(node->action.text, "YY_END")
+	  && strcmp(node->action.text, "1"))
+	memset(bits, 255, 32);
+      return 1;
+
+    case Action:
+    case PeekNot:
+      return 1;
+
+    case PeekFor:
+      {
+	unsigned char pbits[32];
+	int c;
+	memset(pbits, 0, 32);
+	if (firstSet(node->peekFor.element, pbits))
+	  return 1;
+	for (c= 0;  c < 32;  ++c)
+	  bits[c] |= pbits[c];
+	return 0;
+      }
+
+    case Alternate:
+      {
+	int nullable= 0;
+	for (node= node->alternate.first;  node;  node= node->alternate.next)
+	  nullable |= firstSet(node, bits);
+	return nullable;
+      }
+
+    case Sequence:
+      for (node= node->sequence.first;  node;  node= node->sequence.next)
+	if (!firstSet(node, bits))
+	  return 0;
+      return 1;
+
+    case Query:
+    case Star:
+      firstSet(node->query.element, bits);
+      return 1;
+
+    case Plus:
+      return firstSet(node->plus.element, bits);
+
+    default:
+      fprintf(stderr, "\nfirstSet: illegal node type %d\n", node->type);
+      exit(1);
+    }
+  return 1;
+}
+
 static void begin(void)		{ fprintf(output, "\n  {"); }
 static void end(void)		{ fprintf(output, "\n  }"); }
 static void label(int n)	{ fprintf(output, "\n  l%d:;\t", n); }
@@ -120,6 +352,132 @@ static void jump(int n)		{ fprintf(output, "  goto l%d;", n); }
 static void save(int n)		{ fprintf(output, "  int yypos%d= ctx->pos, yythunkpos%d= ctx->thunkpos;", n, n); }
 static void restore(int n)	{ fprintf(output,     "  ctx->pos= yypos%d; ctx->thunkpos= yythunkpos%d;", n, n); }
 
+static void Node_compile_c_ko(Node *node, int ko);
+
+/* Non-zero if the code of a predicate names yytext, yyleng or (as in
+ * ctx->text) text.  Only then is the current text copied out before it
+ * is evaluated; a function the predicate calls cannot ask for it.
+ */
+static int predicateUsesText(char *code)
+{
+  while (*code)
+    if (isalpha((unsigned char)*code) || '_' == *code)
+      {
+	char *name= code;
+	int   len;
+	while (isalnum((unsigned char)*code) || '_' == *code)
+	  ++code;
+	len= code - name;
+	if ((6 == len && (!strncmp(name, "yytext", 6) || !strncmp(name, "yyleng", 6)))
+	    || (4 == len && !strncmp(name, "text", 4)))
+	  return 1;
+      }
+    else if (isdigit((unsigned char)*code))
+      while (isalnum((unsigned char)*code) || '_' == *code)
+	++code;
+    else
+      ++code;
+  return 0;
+}
+
+/* Compile an ordered choice as a switch on the next input byte that
+ * jumps to the first alternative able to match it.  When an alternative
+ * fails, the later ones whose first sets exclude that byte are skipped
+ * without being called.  Returns 0 (generating nothing) if no
+ * alternative can be excluded by looking at its first byte.
+ */
+static int Alternate_compile_c_dispatch(Node *node, int ko)
+{
+  Node		 *alt;
+  int		  count= 0, useful= 0, i, c, ok, yyc;
+  unsigned char	(*firsts)[32];
+  int		 *always, *labels, *used, target[257];
+
+  for (alt= node->alternate.first;  alt;  alt= alt->alternate.next)
+    ++count;
+  firsts= calloc(count, 32);
+  always= calloc(count, sizeof(int));
+  labels= calloc(count + 1, sizeof(int));
+  used= calloc(count + 1, sizeof(int));
+  for (i= 0, alt= node->alternate.first;  alt;  ++i, alt= alt->alternate.next)
+    {
+      always[i]= firstSet(alt, firsts[i]);
+      if (!always[i])
+	{
+	  /* A full first set excludes no byte, so it is never tested */
+	  always[i]= 1;
+	  for (c= 0;  c < 32;  ++c)
+	    if (255 != firsts[i][c])
+	      always[i]= 0;
+	  if (!always[i])
+	    useful= 1;
+	}
+      labels[i]= yyl();
+    }
+  labels[count]= ko;
+
+  if (useful)
+    {
+      /* target[c] is the first alternative that can match byte c; target[256] is for end of input */
+      for (c= 0;  c <= 256;  ++c)
+	{
+	  for (i= 0;  i < count;  ++i)
+	    if (always[i] || (c < 256 && (firsts[i][c >> 3] & (1 << (c & 7)))))
+	      break;
+	  target[c]= i;
+	}
+      for (c= 0;  c <= 256;  ++c)
+	used[target[c]]= 1;
+      for (i= 1;  i < count;  ++i)
+	if (!always[i])
+	  used[i + 1]= 1;
+      ok= yyl();
+      yyc= yyl();
+      begin();
+      save(ok);
+      fprintf(output, "  int yyc%d= yypeek(ctx);", yyc);
+      fprintf(output, "\n  switch (yyc%d)\n    {", yyc);
+      for (i= 0;  i <= count;  ++i)
+	if (i != target[0])
+	  {
+	    int any= 0;
+	    for (c= 0;  c <= 256;  ++c)
+	      if (target[c] == i)
+		{
+		  fprintf(output, "%s case %d:", (any++ % 8) ? "" : "\n    ", c < 256 ? c : -1);
+		}
+	    if (any)
+	      fprintf(output, "  goto l%d;", labels[i]);
+	  }
+      fprintf(output, "\n    default:  goto l%d;\n    }", labels[target[0]]);
+      for (i= 0, alt= node->alternate.first;  alt;  ++i, alt= alt->alternate.next)
+	{
+	  if (used[i])
+	    label(labels[i]);
+	  if (i && !always[i])
+	    fprintf(output, "  if (!yyfirst(yyc%d, (unsigned char *)\"%s\")) goto l%d;", yyc, makeBitString(firsts[i]), labels[i + 1]);
+	  if (alt->alternate.next)
+	    {
+	      int next= yyl();
+	      Node_compile_c_ko(alt, next);
+	      jump(ok);
+	      label(next);
+	      restore(ok);
+	    }
+	  else
+	    Node_compile_c_ko(alt, ko);
+	}
+      end();
+      label(ok);
+    }
+
+  free(firsts);
+  free(always);
+  free(labels);
+  free(used);
+  return useful;
+}
+
 static void Node_compile_c_ko(Node *node, int ko)
 {
   assert(node);
@@ -168,10 +526,22 @@ static void Node_compile_c_ko(Node *node, int ko)
       break;
 
     case Predicate:
-      fprintf(output, "  yyText(ctx, ctx->begin, ctx->end);  if (!(%s)) goto l%d;", node->action.text, ko);
+      /* only predicates that look at the text need it copied out for them */
+      if (predicateUsesText(node->action.text))
+	fprintf(output, "  { int yyleng= YY_TEXT_LENGTH(ctx);  char *yytext= YY_TEXT_POINTER(ctx);  (void)yyleng;  (void)yytext;"
+		"  if (!(%s)) goto l%d; }", node->action.text, ko);
+      else
+	fprintf(output, "  if (!(%s)) goto l%d;", node->action.text, ko);
+      /* memoized rules restore only the text bounds they set themselves */
+      if (memoCount && !strcmp(node->action.text, "YY_BEGIN"))
+	fprintf(output, "  ctx->marked |= 1;");
+      if (memoCount && !strcmp(node->action.text, "YY_END"))
+	fprintf(output, "  ctx->marked |= 2;");
       break;
 
     case Alternate:
+      if (Alternate_compile_c_dispatch(node, ko))
+	break;
       {
 	int ok= yyl();
 	begin();
@@ -318,15 +688,22 @@ static void Rule_compile_c2(Node *node)
     fprintf(stderr, "rule '%s' used but not defined\n", node->rule.name);
   else
     {
-      int ko= yyl(), safe;
+      int ko= yyl(), safe, memo;
 
       if ((!(RuleUsed & node->rule.flags)) && (node != start))
 	fprintf(stderr, "rule '%s' defined but not used\n", node->rule.name);
 
       safe= ((Query == node->rule.expression->type) || (Star == node->rule.expression->type));
+      memo= (RuleMemo & node->rule.flags);
 
       fprintf(output, "\nYY_RULE(int) yy_%s(yycontext *ctx)\n{", node->rule.name);
-      if (!safe) save(0);
+      if (!safe || memo) save(0);
+      if (memo)
+	{
+	  fprintf(output, "  int yymarked0= ctx->marked;");
+	  fprintf(output, "\n  { int yyok= yyRecall(ctx, %d);  if (yyok >= 0) return yyok; }", node->rule.memo);
+	  fprintf(output, "  ctx->marked= 0;");
+	}
       if (node->rule.variables)
 	fprintf(output, "  yyDo(ctx, yyPush, %d, 0);", countVariables(node->rule.variables));
       fprintf(output, "\n  yyprintf((stderr, \"%%s\\n\", \"%s\"));", node->rule.name);
@@ -334,13 +711,19 @@ static void Rule_compile_c2(Node *node)
       fprintf(output, "\n  yyprintf((stderr, \"  ok   %%s @ %%s\\n\", \"%s\", ctx->buf+ctx->pos));", node->rule.name);
       if (node->rule.variables)
 	fprintf(output, "  yyDo(ctx, yyPop, %d, 0);", countVariables(node->rule.variables));
-      fprintf(output, "\n  return 1;");
+      if (memo)
+	fprintf(output, "\n  return yyMemo(ctx, %d, yypos0, yythunkpos0, yymarked0, 1);", node->rule.memo);
+      else
+	fprintf(output, "\n  return 1;");
       if (!safe)
 	{
 	  label(ko);
 	  restore(0);
 	  fprintf(output, "\n  yyprintf((stderr, \"  fail %%s @ %%s\\n\", \"%s\", ctx->buf+ctx->pos));", node->rule.name);
-	  fprintf(output, "\n  return 0;");
+	  if (memo)
+	    fprintf(output, "\n  return yyMemo(ctx, %d, yypos0, yythunkpos0, yymarked0, 0);", node->rule.memo);
+	  else
+	    fprintf(output, "\n  return 0;");
 	}
       fprintf(output, "\n}");
     }
@@ -374,6 +757,15 @@ static char *preamble= "\
 #ifndef YYPARSEFROM\n\
 #define YYPARSEFROM	yyparsefrom\n\
 #endif\n\
+#ifndef YYSETBUFFER\n\
+#define YYSETBUFFER	yysetbuffer\n\
+#endif\n\
+#ifndef YYMEMOREPORT\n\
+#define YYMEMOREPORT	yymemoreport\n\
+#endif\n\
+#ifndef YYRELEASE\n\
+#define YYRELEASE	yyrelease\n\
+#endif\n\
 #ifndef YY_INPUT\n\
 #define YY_INPUT(buf, result, max_size)			\\\n\
   {							\\\n\
@@ -382,6 +774,15 @@ static char *preamble= "\
     yyprintf((stderr, \"<%c>\", yyc));			\\\n\
   }\n\
 #endif\n\
+#ifndef YY_MALLOC\n\
+#define YY_MALLOC(C, N)		malloc(N)\n\
+#endif\n\
+#ifndef YY_REALLOC\n\
+#define YY_REALLOC(C, P, N)	realloc(P, N)\n\
+#endif\n\
+#ifndef YY_FREE\n\
+#define YY_FREE(C, P)		free(P)\n\
+#endif\n\
 #ifndef YY_BEGIN\n\
 #define YY_BEGIN	( ctx->begin= ctx->pos, 1)\n\
 #endif\n\
@@ -403,6 +804,23 @@ typedef struct _yycontext yycontext;\n\
 typedef void (*yyaction)(yycontext *ctx, char *yytext, int yyleng);\n\
 typedef struct _yythunk { int begin, end;  yyaction  action;  struct _yythunk *next; } yythunk;\n\
 \n\
+#if YYMEMOCOUNT\n\
+#ifndef YY_MEMO_SIZE\n\
+#define YY_MEMO_SIZE	16384\n\
+#endif\n\
+#ifndef YY_MEMO_SHARE\n\
+#define YY_MEMO_SHARE	16\n\
+#endif\n\
+#ifndef YY_MEMO_LIMIT\n\
+#define YY_MEMO_LIMIT	(256L << 20)\n\
+#endif\n\
+#ifndef YY_MEMO_DEPTH\n\
+#define YY_MEMO_DEPTH	0\n\
+#endif\n\
+typedef struct _yymemo { int memo, pos, gen, ok, next, marked, begin, end;  yythunk *thunks;  int thunkslen, thunkcount; } yymemo;\n\
+typedef struct _yyshared { struct _yyshared *next;  int size, used;  yythunk *thunks; } yyshared;\n\
+#endif\n\
+\n\
 struct _yycontext {\n\
   char     *buf;\n\
   int       buflen;\n\
@@ -420,6 +838,26 @@ struct _yycontext {\n\
   YYSTYPE  *val;\n\
   YYSTYPE  *vals;\n\
   int       valslen;\n\
+  int       nomem;\n\
+#if YYMEMOCOUNT\n\
+  yymemo   *memos;\n\
+  int       memosize;\n\
+  long      memobytes;\n\
+  long      sharedbytes;\n\
+  long      memolimit;\n\
+  int       memokeep;\n\
+  long      keptbytes;\n\
+  int       keptfrom;\n\
+  int       keptto;\n\
+  int       memodepth;\n\
+  int       memogen;\n\
+  int       marked;\n\
+  yyshared *shared;\n\
+  yyshared *spare;\n\
+  yyshared *mark;\n\
+  long      memohits[YYMEMOCOUNT];\n\
+  long      memomisses[YYMEMOCOUNT];\n\
+#endif\n\
 #ifdef YY_CTX_MEMBERS\n\
   YY_CTX_MEMBERS\n\
 #endif\n\
@@ -441,16 +879,37 @@ yycontext *yyctx= &yyctx0;\n\
 \n\
 YY_LOCAL(int) yyrefill(yycontext *ctx)\n\
 {\n\
+#ifdef YY_BUFFER_INPUT\n\
+  return 0;\n\
+#else\n\
   int yyn;\n\
   while (ctx->buflen - ctx->pos < 512)\n\
     {\n\
+      char *buf= (char *)YY_REALLOC(ctx, ctx->buf, ctx->buflen * 2);\n\
+      if (!buf)\n\
+	{\n\
+	  ctx->nomem= 1;\n\
+	  return 0;\n\
+	}\n\
+      ctx->buf= buf;\n\
       ctx->buflen *= 2;\n\
-      ctx->buf= (char *)realloc(ctx->buf, ctx->buflen);\n\
     }\n\
   YY_INPUT((ctx->buf + ctx->pos), yyn, (ctx->buflen - ctx->pos));\n\
   if (!yyn) return 0;\n\
   ctx->limit += yyn;\n\
   return 1;\n\
+#endif\n\
+}\n\
+\n\
+YY_LOCAL(int) yypeek(yycontext *ctx)\n\
+{\n\
+  if (ctx->pos >= ctx->limit && !yyrefill(ctx)) return -1;\n\
+  return (unsigned char)ctx->buf[ctx->pos];\n\
+}\n\
+\n\
+YY_LOCAL(int) yyfirst(int c, unsigned char *bits)\n\
+{\n\
+  return c >= 0 && (bits[c >> 3] & (1 << (c & 7)));\n\
 }\n\
 \n\
 YY_LOCAL(int) yymatchDot(yycontext *ctx)\n\
@@ -509,8 +968,14 @@ YY_LOCAL(void) yyDo(yycontext *ctx, yyaction action, int begin, int end)\n\
 {\n\
   while (ctx->thunkpos >= ctx->thunkslen)\n\
     {\n\
+      yythunk *thunks= (yythunk *)YY_REALLOC(ctx, ctx->thunks, sizeof(yythunk) * ctx->thunkslen * 2);\n\
+      if (!thunks)\n\
+	{\n\
+	  ctx->nomem= 1;\n\
+	  return;\n\
+	}\n\
+      ctx->thunks= thunks;\n\
       ctx->thunkslen *= 2;\n\
-      ctx->thunks= (yythunk *)realloc(ctx->thunks, sizeof(yythunk) * ctx->thunkslen);\n\
     }\n\
   ctx->thunks[ctx->thunkpos].begin=  begin;\n\
   ctx->thunks[ctx->thunkpos].end=    end;\n\
@@ -518,6 +983,13 @@ YY_LOCAL(void) yyDo(yycontext *ctx, yyaction action, int begin, int end)\n\
   ++ctx->thunkpos;\n\
 }\n\
 \n\
+#ifdef YY_BUFFER_TEXT\n\
+#define YY_TEXT_LENGTH(C)	((C)->end > (C)->begin ? (C)->end - (C)->begin : 0)\n\
+#define YY_TEXT_POINTER(C)	((C)->buf + (C)->begin)\n\
+#else\n\
+#define YY_TEXT_LENGTH(C)	yyText((C), (C)->begin, (C)->end)\n\
+#define YY_TEXT_POINTER(C)	((C)->text)\n\
+\n\
 YY_LOCAL(int) yyText(yycontext *ctx, int begin, int end)\n\
 {\n\
   int yyleng= end - begin;\n\
@@ -527,37 +999,77 @@ YY_LOCAL(int) yyText(yycontext *ctx, int begin, int end)\n\
     {\n\
       while (ctx->textlen < (yyleng + 1))\n\
 	{\n\
+	  char *text= (char *)YY_REALLOC(ctx, ctx->text, ctx->textlen * 2);\n\
+	  if (!text)\n\
+	    {\n\
+	      ctx->nomem= 1;\n\
+	      ctx->text[0]= '\\0';\n\
+	      return 0;\n\
+	    }\n\
+	  ctx->text= text;\n\
 	  ctx->textlen *= 2;\n\
-	  ctx->text= (char *)realloc(ctx->text, ctx->textlen);\n\
 	}\n\
       memcpy(ctx->text, ctx->buf + begin, yyleng);\n\
     }\n\
   ctx->text[yyleng]= '\\0';\n\
   return yyleng;\n\
 }\n\
+#endif\n\
 \n\
-YY_LOCAL(void) yyDone(yycontext *ctx)\n\
+YY_LOCAL(void) yyDoThunk(yycontext *ctx, yythunk *thunk, int pos)\n\
 {\n\
-  int pos;\n\
-  for (pos= 0;  pos < ctx->thunkpos;  ++pos)\n\
+#ifdef YY_BUFFER_TEXT\n\
+  int yyleng= thunk->end ? (thunk->end > thunk->begin ? thunk->end - thunk->begin : 0) : thunk->begin;\n\
+  char *yytext= ctx->buf + thunk->begin;\n\
+#else\n\
+  int yyleng= thunk->end ? yyText(ctx, thunk->begin, thunk->end) : thunk->begin;\n\
+  char *yytext= ctx->text;\n\
+#endif\n\
+  int i;\n\
+  if (!thunk->action)\n\
     {\n\
-      yythunk *thunk= &ctx->thunks[pos];\n\
-      int yyleng= thunk->end ? yyText(ctx, thunk->begin, thunk->end) : thunk->begin;\n\
-      yyprintf((stderr, \"DO [%d] %p %s\\n\", pos, thunk->action, ctx->text));\n\
-      thunk->action(ctx, ctx->text, yyleng);\n\
+      for (i= 0;  i < thunk->begin && !ctx->nomem;  ++i)\n\
+	yyDoThunk(ctx, thunk->next + i, i);\n\
+      return;\n\
     }\n\
+  yyprintf((stderr, \"DO [%d] %p %.*s\\n\", pos, thunk->action, thunk->end ? yyleng : 0, yytext));\n\
+  thunk->action(ctx, yytext, yyleng);\n\
+}\n\
+\n\
+YY_LOCAL(void) yyDone(yycontext *ctx)\n\
+{\n\
+  int pos;\n\
+  for (pos= 0;  pos < ctx->thunkpos && !ctx->nomem;  ++pos)\n\
+    yyDoThunk(ctx, &ctx->thunks[pos], pos);\n\
   ctx->thunkpos= 0;\n\
 }\n\
 \n\
 YY_LOCAL(void) yyCommit(yycontext *ctx)\n\
 {\n\
+#ifdef YY_BUFFER_INPUT\n\
+  ctx->buf += ctx->pos;\n\
+  ctx->limit -= ctx->pos;\n\
+#else\n\
   if ((ctx->limit -= ctx->pos))\n\
     {\n\
       memmove(ctx->buf, ctx->buf + ctx->pos, ctx->limit);\n\
     }\n\
+#endif\n\
   ctx->begin -= ctx->pos;\n\
   ctx->end -= ctx->pos;\n\
   ctx->pos= ctx->thunkpos= 0;\n\
+#if YYMEMOCOUNT\n\
+  ++ctx->memogen;\n\
+  ctx->sharedbytes= 0;\n\
+  ctx->mark= 0;\n\
+  while (ctx->shared)\n\
+    {\n\
+      yyshared *next= ctx->shared->next;\n\
+      ctx->shared->next= ctx->spare;\n\
+      ctx->spare= ctx->shared;\n\
+      ctx->shared= next;\n\
+    }\n\
+#endif\n\
 }\n\
 \n\
 YY_LOCAL(int) yyAccept(yycontext *ctx, int tp0)\n\
@@ -575,7 +1087,266 @@ YY_LOCAL(int) yyAccept(yycontext *ctx, int tp0)\n\
   return 1;\n\
 }\n\
 \n\
-YY_LOCAL(void) yyPush(yycontext *ctx, char *text, int count)  { ctx->val += count; }\n\
+#if YYMEMOCOUNT\n\
+\n\
+YY_LOCAL(int) yyRecall(yycontext *ctx, int memo)\n\
+{\n\
+  yymemo *m= &ctx->memos[(ctx->pos * YYMEMOCOUNT + memo) & (ctx->memosize - 1)];\n\
+  if (ctx->nomem)\n\
+    return 0;		/* the parse is being abandoned */\n\
+  if (m->gen != ctx->memogen || m->pos != ctx->pos || m->memo != memo)\n\
+    {\n\
+      if (YY_MEMO_DEPTH && ctx->memodepth >= YY_MEMO_DEPTH)\n\
+	{\n\
+	  ctx->nomem= 2;	/* nested too deeply for the stack */\n\
+	  return 0;\n\
+	}\n\
+      ++ctx->memodepth;\n\
+      ++ctx->memomisses[memo];\n\
+      return -1;\n\
+    }\n\
+  while (ctx->thunkpos + m->thunkcount >= ctx->thunkslen)\n\
+    {\n\
+      yythunk *thunks= (yythunk *)YY_REALLOC(ctx, ctx->thunks, sizeof(yythunk) * ctx->thunkslen * 2);\n\
+      if (!thunks)\n\
+	{\n\
+	  ctx->nomem= 1;\n\
+	  return 0;\n\
+	}\n\
+      ctx->thunks= thunks;\n\
+      ctx->thunkslen *= 2;\n\
+    }\n\
+  ++ctx->memohits[memo];\n\
+  if (m->thunkcount)\n\
+    memcpy(ctx->thunks + ctx->thunkpos, m->thunks, sizeof(yythunk) * m->thunkcount);\n\
+  ctx->thunkpos += m->thunkcount;\n\
+  ctx->pos= m->next;\n\
+  if (m->marked & 1) ctx->begin= m->begin;\n\
+  if (m->marked & 2) ctx->end= m->end;\n\
+  ctx->marked |= m->marked;\n\
+  yyprintf((stderr, \"  memo %d @ %s\\n\", memo, ctx->buf+ctx->pos));\n\
+  return m->ok;\n\
+}\n\
+\n\
+/* Whether the memo table and the shared actions may take bytes more:\n\
+ * they may take up to memolimit if the caller has set it, or else\n\
+ * YY_MEMO_LIMIT.  While memokeep is set they take what they need, and\n\
+ * yyKeepRoom holds the outcomes kept to the limit instead. */\n\
+\n\
+YY_LOCAL(int) yyMemoRoom(yycontext *ctx, long bytes)\n\
+{\n\
+  return ctx->memokeep || ctx->memobytes + ctx->sharedbytes + bytes <= (ctx->memolimit ? ctx->memolimit : YY_MEMO_LIMIT);\n\
+}\n\
+\n\
+/* Whether an outcome at pos that scheduled count actions may be kept\n\
+ * with the ones kept since yyparse() began, or since the last\n\
+ * yyResume(): together they may need up to the limit, for a table with\n\
+ * room for every memoized rule at each position they span, and the old\n\
+ * half of it while it is doubled, for their actions and for those\n\
+ * shared.  The count does not depend on the size of the table or on the\n\
+ * outcomes recorded before, so whether a parse fits does not either. */\n\
+\n\
+YY_LOCAL(int) yyKeepRoom(yycontext *ctx, int pos, int count)\n\
+{\n\
+  int len= 4;\n\
+  if (count > YY_MEMO_SHARE)\n\
+    {\n\
+      ctx->keptbytes += sizeof(yythunk) * count;\n\
+      count= 1;\n\
+    }\n\
+  while (len < count) len *= 2;\n\
+  if (count)\n\
+    ctx->keptbytes += sizeof(yythunk) * len;\n\
+  if (ctx->keptfrom < 0 || pos < ctx->keptfrom) ctx->keptfrom= pos;\n\
+  if (ctx->keptto < pos) ctx->keptto= pos;\n\
+  return ctx->keptbytes + 3L * sizeof(yymemo) * YYMEMOCOUNT * (ctx->keptto - ctx->keptfrom + 1)\n\
+    <= (ctx->memolimit ? ctx->memolimit : YY_MEMO_LIMIT);\n\
+}\n\
+\n\
+/* Thunks of a long result are moved to storage that lasts until the\n\
+ * next commit, and replaced by one thunk that runs them.  Results that\n\
+ * contain it, and every recall of it, then copy only that thunk. */\n\
+\n\
+YY_LOCAL(void) yyShare(yycontext *ctx, int thunkpos)\n\
+{\n\
+  int count= ctx->thunkpos - thunkpos;\n\
+  yyshared *s= ctx->shared, **spare= &ctx->spare;\n\
+  if (!s || s->used + count > s->size)\n\
+    {\n\
+      while ((s= *spare) && s->size < count)\n\
+	spare= &s->next;\n\
+      if (!yyMemoRoom(ctx, sizeof(yythunk) * (s ? s->size : count > 4096 ? count : 4096)))\n\
+	return;		/* the thunks stay where they are */\n\
+      if (s)\n\
+	*spare= s->next;\n\
+      else\n\
+	{\n\
+	  int size= count > 4096 ? count : 4096;\n\
+	  yythunk *thunks= (yythunk *)YY_MALLOC(ctx, sizeof(yythunk) * size);\n\
+	  if (!thunks || !(s= (yyshared *)YY_MALLOC(ctx, sizeof(yyshared))))\n\
+	    {\n\
+	      YY_FREE(ctx, thunks);\n\
+	      return;	/* the thunks stay where they are */\n\
+	    }\n\
+	  s->size= size;\n\
+	  s->thunks= thunks;\n\
+	}\n\
+      s->used= 0;\n\
+      s->next= ctx->shared;\n\
+      ctx->sharedbytes += sizeof(yythunk) * s->size;\n\
+      ctx->shared= s;\n\
+    }\n\
+  memcpy(s->thunks + s->used, ctx->thunks + thunkpos, sizeof(yythunk) * count);\n\
+  ctx->thunks[thunkpos].begin=  count;\n\
+  ctx->thunks[thunkpos].end=    0;\n\
+  ctx->thunks[thunkpos].action= 0;\n\
+  ctx->thunks[thunkpos].next=   s->thunks + s->used;\n\
+  ctx->thunkpos= thunkpos + 1;\n\
+  s->used += count;\n\
+}\n\
+\n\
+/* A result that would replace one recorded further on means that the\n\
+ * parse has backtracked across more text than the table covers, and\n\
+ * will want the results it is losing again.  The table is doubled\n\
+ * instead, for as long as it fits within the limit with the old table,\n\
+ * which is freed only once its results are copied.  While memokeep is\n\
+ * set no result of the parse is replaced: the table is doubled until\n\
+ * the new one has a place of its own. */\n\
+\n\
+YY_LOCAL(int) yyMemoGrow(yycontext *ctx)\n\
+{\n\
+  int size= ctx->memosize, i;\n\
+  yymemo *memos;\n\
+  if (!yyMemoRoom(ctx, sizeof(yymemo) * size * 2)\n\
+      || !(memos= (yymemo *)YY_MALLOC(ctx, sizeof(yymemo) * size * 2)))\n\
+    return 0;\n\
+  for (i= 0;  i < size;  ++i)\n\
+    {\n\
+      yymemo *m= &ctx->memos[i];\n\
+      int high= (m->pos * YYMEMOCOUNT + m->memo) & size;\n\
+      memos[i | high]= *m;\n\
+      memset(&memos[i | (size & ~high)], 0, sizeof(yymemo));\n\
+    }\n\
+  YY_FREE(ctx, ctx->memos);\n\
+  ctx->memos= memos;\n\
+  ctx->memosize= size * 2;\n\
+  ctx->memobytes += sizeof(yymemo) * size;\n\
+  return 1;\n\
+}\n\
+\n\
+YY_LOCAL(int) yyMemo(yycontext *ctx, int memo, int pos, int thunkpos, int marked, int ok)\n\
+{\n\
+  yymemo *m= &ctx->memos[(pos * YYMEMOCOUNT + memo) & (ctx->memosize - 1)];\n\
+  int count;\n\
+  --ctx->memodepth;\n\
+  if (ctx->memokeep && !yyKeepRoom(ctx, pos, ctx->thunkpos - thunkpos))\n\
+    {\n\
+      ctx->nomem= 1;\n\
+      ctx->marked |= marked;\n\
+      return ok;\n\
+    }\n\
+  if (m->gen == ctx->memogen && m->pos > pos)\n\
+    {\n\
+      yyMemoGrow(ctx);\n\
+      m= &ctx->memos[(pos * YYMEMOCOUNT + memo) & (ctx->memosize - 1)];\n\
+    }\n\
+  while (ctx->memokeep && m->gen == ctx->memogen)\n\
+    {\n\
+      if (!yyMemoGrow(ctx))\n\
+	{\n\
+	  ctx->nomem= 1;\n\
+	  ctx->marked |= marked;\n\
+	  return ok;\n\
+	}\n\
+      m= &ctx->memos[(pos * YYMEMOCOUNT + memo) & (ctx->memosize - 1)];\n\
+    }\n\
+  if (ctx->thunkpos - thunkpos > YY_MEMO_SHARE)\n\
+    yyShare(ctx, thunkpos);\n\
+  count= ctx->thunkpos - thunkpos;\n\
+  m->gen= ctx->memogen - 1;\n\
+  if (m->thunkslen < count)\n\
+    {\n\
+      int len= m->thunkslen ? m->thunkslen : 4;\n\
+      yythunk *thunks;\n\
+      while (len < count) len *= 2;\n\
+      if (!yyMemoRoom(ctx, sizeof(yythunk) * (len - m->thunkslen)))\n\
+	thunks= 0;\n\
+      else\n\
+	thunks= (yythunk *)YY_REALLOC(ctx, m->thunks, sizeof(yythunk) * len);\n\
+      if (!thunks)\n\
+	{\n\
+	  if (ctx->memokeep)\n\
+	    ctx->nomem= 1;\n\
+	  ctx->marked |= marked;\n\
+	  return ok;		/* not recorded */\n\
+	}\n\
+      ctx->memobytes += sizeof(yythunk) * (len - m->thunkslen);\n\
+      m->thunks= thunks;\n\
+      m->thunkslen= len;\n\
+    }\n\
+  if (count)\n\
+    memcpy(m->thunks, ctx->thunks + thunkpos, sizeof(yythunk) * count);\n\
+  m->thunkcount= count;\n\
+  m->memo= memo;\n\
+  m->pos= pos;\n\
+  m->gen= ctx->memogen;\n\
+  m->ok= ok;\n\
+  m->next= ctx->pos;\n\
+  m->marked= ctx->marked;\n\
+  m->begin= ctx->begin;\n\
+  m->end= ctx->end;\n\
+  ctx->marked |= marked;\n\
+  return ok;\n\
+}\n\
+\n\
+/* A parse abandoned for want of memory (nomem is 1) or of stack (nomem\n\
+ * is 2) can be resumed by the grammar, to try the input that ran out\n\
+ * another way: yyMark records where the attempt begins, and yyResume,\n\
+ * once it has failed, forgets every outcome recorded and takes back the\n\
+ * actions kept since the mark. */\n\
+\n\
+YY_LOCAL(void) yyMark(yycontext *ctx)\n\
+{\n\
+  ctx->mark= ctx->shared;\n\
+}\n\
+\n\
+YY_LOCAL(int) yyResume(yycontext *ctx)\n\
+{\n\
+  if (!ctx->nomem)\n\
+    return 0;\n\
+  ++ctx->memogen;\n\
+  while (ctx->shared && ctx->shared != ctx->mark)\n\
+    {\n\
+      yyshared *next= ctx->shared->next;\n\
+      ctx->sharedbytes -= sizeof(yythunk) * ctx->shared->size;\n\
+      ctx->shared->next= ctx->spare;\n\
+      ctx->spare= ctx->shared;\n\
+      ctx->shared= next;\n\
+    }\n\
+  ctx->keptbytes= 0;\n\
+  ctx->keptfrom= ctx->keptto= -1;\n\
+  ctx->nomem= 0;\n\
+  return 1;\n\
+}\n\
+\n\
+#endif\n\
+\n\
+YY_LOCAL(void) yyPush(yycontext *ctx, char *text, int count)\n\
+{\n\
+  long offset= ctx->val - ctx->vals + count;\n\
+  while (ctx->valslen <= offset)\n\
+    {\n\
+      YYSTYPE *vals= (YYSTYPE *)YY_REALLOC(ctx, ctx->vals, sizeof(YYSTYPE) * ctx->valslen * 2);\n\
+      if (!vals)\n\
+	{\n\
+	  ctx->nomem= 1;\n\
+	  return;\n\
+	}\n\
+      ctx->vals= vals;\n\
+      ctx->valslen *= 2;\n\
+    }\n\
+  ctx->val= ctx->vals + offset;\n\
+}\n\
 YY_LOCAL(void) yyPop(yycontext *ctx, char *text, int count)   { ctx->val -= count; }\n\
 YY_LOCAL(void) yySet(yycontext *ctx, char *text, int count)   { ctx->val[count]= ctx->yy; }\n\
 \n\
@@ -594,25 +1365,69 @@ typedef int (*yyrule)(yycontext *ctx);\n\
 YY_PARSE(int) YYPARSEFROM(YY_CTX_PARAM_ yyrule yystart)\n\
 {\n\
   int yyok;\n\
-  if (!yyctx->buflen)\n\
+  if (!yyctx->textlen)\n\
     {\n\
+#ifndef YY_BUFFER_INPUT\n\
+      yyctx->buf= (char *)YY_MALLOC(yyctx, 1024);\n\
+      yyctx->pos= yyctx->limit= 0;\n\
+#endif\n\
+      yyctx->text= (char *)YY_MALLOC(yyctx, 1024);\n\
+      yyctx->thunks= (yythunk *)YY_MALLOC(yyctx, sizeof(yythunk) * 32);\n\
+      yyctx->vals= (YYSTYPE *)YY_MALLOC(yyctx, sizeof(YYSTYPE) * 32);\n\
+#if YYMEMOCOUNT\n\
+      yyctx->memos= (yymemo *)YY_MALLOC(yyctx, sizeof(yymemo) * YY_MEMO_SIZE);\n\
+      yyctx->shared= yyctx->spare= yyctx->mark= 0;\n\
+#endif\n\
+      if (!yyctx->text || !yyctx->thunks || !yyctx->vals\n\
+#ifndef YY_BUFFER_INPUT\n\
+	  || !yyctx->buf\n\
+#endif\n\
+#if YYMEMOCOUNT\n\
+	  || !yyctx->memos\n\
+#endif\n\
+	  )\n\
+	{\n\
+#ifndef YY_BUFFER_INPUT\n\
+	  YY_FREE(yyctx, yyctx->buf);\n\
+#endif\n\
+	  YY_FREE(yyctx, yyctx->text);\n\
+	  YY_FREE(yyctx, yyctx->thunks);\n\
+	  YY_FREE(yyctx, yyctx->vals);\n\
+#if YYMEMOCOUNT\n\
+	  YY_FREE(yyctx, yyctx->memos);\n\
+#endif\n\
+	  return 0;\n\
+	}\n\
+#ifndef YY_BUFFER_INPUT\n\
       yyctx->buflen= 1024;\n\
-      yyctx->buf= (char *)malloc(yyctx->buflen);\n\
+#endif\n\
+#if YYMEMOCOUNT\n\
+      memset(yyctx->memos, 0, sizeof(yymemo) * YY_MEMO_SIZE);\n\
+      yyctx->memosize= YY_MEMO_SIZE;\n\
+      yyctx->memobytes= sizeof(yymemo) * YY_MEMO_SIZE;\n\
+      yyctx->sharedbytes= 0;\n\
+#endif\n\
       yyctx->textlen= 1024;\n\
-      yyctx->text= (char *)malloc(yyctx->textlen);\n\
       yyctx->thunkslen= 32;\n\
-      yyctx->thunks= (yythunk *)malloc(sizeof(yythunk) * yyctx->thunkslen);\n\
       yyctx->valslen= 32;\n\
-      yyctx->vals= (YYSTYPE *)malloc(sizeof(YYSTYPE) * yyctx->valslen);\n\
-      yyctx->begin= yyctx->end= yyctx->pos= yyctx->limit= yyctx->thunkpos= 0;\n\
+      yyctx->begin= yyctx->end= yyctx->thunkpos= 0;\n\
     }\n\
+#if YYMEMOCOUNT\n\
+  ++yyctx->memogen;\n\
+  yyctx->marked= 0;\n\
+  yyctx->memokeep= 0;\n\
+  yyctx->keptbytes= 0;\n\
+  yyctx->keptfrom= yyctx->keptto= -1;\n\
+  yyctx->memodepth= 0;\n\
+#endif\n\
+  yyctx->nomem= 0;\n\
   yyctx->begin= yyctx->end= yyctx->pos;\n\
   yyctx->thunkpos= 0;\n\
   yyctx->val= yyctx->vals;\n\
   yyok= yystart(yyctx);\n\
-  if (yyok) yyDone(yyctx);\n\
+  if (yyok && !yyctx->nomem) yyDone(yyctx);\n\
   yyCommit(yyctx);\n\
-  return yyok;\n\
+  return yyok && !yyctx->nomem;\n\
 }\n\
 \n\
 YY_PARSE(int) YYPARSE(YY_CTX_PARAM)\n\
@@ -620,6 +1435,82 @@ YY_PARSE(int) YYPARSE(YY_CTX_PARAM)\n\
   return YYPARSEFROM(YY_CTX_ARG_ yy_%s);\n\
 }\n\
 \n\
+#ifdef YY_BUFFER_INPUT\n\
+YY_PARSE(void) YYSETBUFFER(YY_CTX_PARAM_ char *yybuffer, int yylength)\n\
+{\n\
+  yyctx->buf= yybuffer;\n\
+  yyctx->limit= yylength;\n\
+  yyctx->begin= yyctx->end= yyctx->pos= yyctx->thunkpos= 0;\n\
+}\n\
+#endif\n\
+\n\
+YY_PARSE(void) YYRELEASE(YY_CTX_PARAM)\n\
+{\n\
+  if (yyctx->buflen)\n\
+    {\n\
+      yyctx->buflen= 0;\n\
+      YY_FREE(yyctx, yyctx->buf);\n\
+    }\n\
+  if (yyctx->textlen)\n\
+    {\n\
+      yyctx->textlen= 0;\n\
+      YY_FREE(yyctx, yyctx->text);\n\
+      YY_FREE(yyctx, yyctx->thunks);\n\
+      YY_FREE(yyctx, yyctx->vals);\n\
+#if YYMEMOCOUNT\n\
+      {\n\
+	yyshared *s, *next;\n\
+	int i;\n\
+	for (i= 0;  i < yyctx->memosize;  ++i)\n\
+	  YY_FREE(yyctx, yyctx->memos[i].thunks);\n\
+	YY_FREE(yyctx, yyctx->memos);\n\
+	for (s= yyctx->shared;  s;  s= next)\n\
+	  {\n\
+	    next= s->next;\n\
+	    YY_FREE(yyctx, s->thunks);\n\
+	    YY_FREE(yyctx, s);\n\
+	  }\n\
+	for (s= yyctx->spare;  s;  s= next)\n\
+	  {\n\
+	    next= s->next;\n\
+	    YY_FREE(yyctx, s->thunks);\n\
+	    YY_FREE(yyctx, s);\n\
+	  }\n\
+	yyctx->shared= yyctx->spare= yyctx->mark= 0;\n\
+      }\n\
+#endif\n\
+    }\n\
+}\n\
+\n\
+#endif\n\
+";
+
+static char *memofooter= "\
+\n\
+#ifndef YY_PART\n\
+\n\
+YY_PARSE(void) YYMEMOREPORT(YY_CTX_PARAM_ FILE *stream)\n\
+{\n\
+  long thunks[YYMEMOCOUNT], total= sizeof(yymemo) * yyctx->memosize;\n\
+  yyshared *s;\n\
+  int i;\n\
+  memset(thunks, 0, sizeof(thunks));\n\
+  for (i= 0;  i < yyctx->memosize;  ++i)\n\
+    if (yyctx->memos[i].thunkslen)\n\
+      thunks[yyctx->memos[i].memo] += sizeof(yythunk) * yyctx->memos[i].thunkslen;\n\
+  for (s= yyctx->shared;  s;  s= s->next)\n\
+    total += sizeof(yythunk) * s->size;\n\
+  for (s= yyctx->spare;  s;  s= s->next)\n\
+    total += sizeof(yythunk) * s->size;\n\
+  fprintf(stream, \"%-24s %12s %12s %12s\\n\", \"memo\", \"hits\", \"misses\", \"thunk bytes\");\n\
+  for (i= 0;  i < YYMEMOCOUNT;  ++i)\n\
+    {\n\
+      fprintf(stream, \"%-24s %12ld %12ld %12ld\\n\", yymemonames[i], yyctx->memohits[i], yyctx->memomisses[i], thunks[i]);\n\
+      total += thunks[i];\n\
+    }\n\
+  fprintf(stream, \"%d entries, %ld bytes\\n\", yyctx->memosize, total);\n\
+}\n\
+\n\
 #endif\n\
 ";
 
@@ -629,6 +1520,7 @@ void Rule_compile_c_header(void)
   fprintf(output, "\n");
   fprintf(output, "%s", header);
   fprintf(output, "#define YYRULECOUNT %d\n", ruleCount);
+  fprintf(output, "#define YYMEMOCOUNT %d\n", memoCount);
 }
 
 int consumesInput(Node *node)
@@ -698,6 +1590,8 @@ void Rule_compile_c(Node *node)
 
   for (n= rules;  n;  n= n->rule.next)
     consumesInput(n);
+  for (n= rules;  n;  n= n->rule.next)
+    mergeClasses(n->rule.expression);
 
   fprintf(output, "%s", preamble);
   for (n= node;  n;  n= n->rule.next)
@@ -712,6 +1606,18 @@ void Rule_compile_c(Node *node)
       undefineVariables(n->action.rule->rule.variables);
       fprintf(output, "}\n");
     }
+  if (memoCount)
+    {
+      int i;
+      fprintf(output, "\nstatic const char *yymemonames[]= {");
+      for (i= 0;  i < memoCount;  ++i)
+	for (n= node;  n;  n= n->rule.next)
+	  if ((RuleMemo & n->rule.flags) && i == n->rule.memo)
+	    fprintf(output, "\n  \"%s\",", n->rule.name);
+      fprintf(output, "\n};\n");
+    }
   Rule_compile_c2(node);
   fprintf(output, footer, start->rule.name);
+  if (memoCount)
+    fprintf(output, "%s", memofooter);
 }
@@ -0,0 +1,2240 @@
+/* A recursive-descent parser generated by peg 0.1.9 */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define YYRULECOUNT 22
+#define YYMEMOCOUNT 0
+
+# include <stdio.h>
+
+  typedef struct line line;
+
+  struct line
+  {
+    int	  number;
+    int	  length;
+    char *text;
+  };
+
+  line *lines= 0;
+  int   numLines= 0;
+  int   pc= -1, epc= -1;
+  int   batch= 0;
+
+  int nextline(char *buf, int max);
+
+# define min(x, y) ((x) < (y) ? (x) : (y))
+
+# define YY_INPUT(buf, result, max_size)	\
+  {						\
+    if ((pc >= 0) && (pc < numLines))		\
+      {						\
+        line *linep= lines+pc++;		\
+        result= min(max_size, linep->length);	\
+        memcpy(buf, linep->text, result);	\
+      }						\
+    else					\
+      result= nextline(buf, max_size);		\
+  }
+
+  union value {
+    int		  number;
+    char	 *string;
+    int		(*binop)(int lhs, int rhs);
+  };
+
+# define YYSTYPE union value
+
+  int variables[26];
+
+  void accept(int number, char *line);
+
+  void save(char *name);
+  void load(char *name);
+  void type(char *name);
+
+  int lessThan(int lhs, int rhs)	{ return lhs <  rhs; }
+  int lessEqual(int lhs, int rhs)	{ return lhs <= rhs; }
+  int notEqual(int lhs, int rhs)	{ return lhs != rhs; }
+  int equalTo(int lhs, int rhs)		{ return lhs == rhs; }
+  int greaterEqual(int lhs, int rhs)	{ return lhs >= rhs; }
+  int greaterThan(int lhs, int rhs)	{ return lhs >  rhs; }
+
+  int input(void);
+
+  int stack[1024], sp= 0;
+
+  char *help;
+
+  void error(char *fmt, ...);
+  int findLine(int n, int create);
+
+#ifndef YY_LOCAL
+#define YY_LOCAL(T)	static T
+#endif
+#ifndef YY_ACTION
+#define YY_ACTION(T)	static T
+#endif
+#ifndef YY_RULE
+#define YY_RULE(T)	static T
+#endif
+#ifndef YY_PARSE
+#define YY_PARSE(T)	T
+#endif
+#ifndef YYPARSE
+#define YYPARSE		yyparse
+#endif
+#ifndef YYPARSEFROM
+#define YYPARSEFROM	yyparsefrom
+#endif
+#ifndef YYSETBUFFER
+#define YYSETBUFFER	yysetbuffer
+#endif
+#ifndef YYMEMOREPORT
+#define YYMEMOREPORT	yymemoreport
+#endif
+#ifndef YYRELEASE
+#define YYRELEASE	yyrelease
+#endif
+#ifndef YY_INPUT
+#define YY_INPUT(buf, result, max_size)			\
+  {							\
+    int yyc= getchar();					\
+    result= (EOF == yyc) ? 0 : (*(buf)= yyc, 1);	\
+    yyprintf((stderr, "<%c>", yyc));			\
+  }
+#endif
+#ifndef YY_MALLOC
+#define YY_MALLOC(C, N)		malloc(N)
+#endif
+#ifndef YY_REALLOC
+#define YY_REALLOC(C, P, N)	realloc(P, N)
+#endif
+#ifndef YY_FREE
+#define YY_FREE(C, P)		free(P)
+#endif
+#ifndef YY_BEGIN
+#define YY_BEGIN	( ctx->begin= ctx->pos, 1)
+#endif
+#ifndef YY_END
+#define YY_END		( ctx->end= ctx->pos, 1)
+#endif
+#ifdef YY_DEBUG
+# define yyprintf(args)	fprintf args
+#else
+# define yyprintf(args)
+#endif
+#ifndef YYSTYPE
+#define YYSTYPE	int
+#endif
+
+#ifndef YY_PART
+
+typedef struct _yycontext yycontext;
+typedef void (*yyaction)(yycontext *ctx, char *yytext, int yyleng);
+typedef struct _yythunk { int begin, end;  yyaction  action;  struct _yythunk *next; } yythunk;
+
+#if YYMEMOCOUNT
+#ifndef YY_MEMO_SIZE
+#define YY_MEMO_SIZE	16384
+#endif
+#ifndef YY_MEMO_SHARE
+#define YY_MEMO_SHARE	16
+#endif
+#ifndef YY_MEMO_LIMIT
+#define YY_MEMO_LIMIT	(256L << 20)
+#endif
+#ifndef YY_MEMO_DEPTH
+#define YY_MEMO_DEPTH	0
+#endif
+typedef struct _yymemo { int memo, pos, gen, ok, next, marked, begin, end;  yythunk *thunks;  int thunkslen, thunkcount; } yymemo;
+typedef struct _yyshared { struct _yyshared *next;  int size, used;  yythunk *thunks; } yyshared;
+#endif
+
+struct _yycontext {
+  char     *buf;
+  int       buflen;
+  int       pos;
+  int       limit;
+  char     *text;
+  int       textlen;
+  int       begin;
+  int       end;
+  int       textmax;
+  yythunk  *thunks;
+  int       thunkslen;
+  int       thunkpos;
+  YYSTYPE   yy;
+  YYSTYPE  *val;
+  YYSTYPE  *vals;
+  int       valslen;
+  int       nomem;
+#if YYMEMOCOUNT
+  yymemo   *memos;
+  int       memosize;
+  long      memobytes;
+  long      sharedbytes;
+  long      memolimit;
+  int       memokeep;
+  long      keptbytes;
+  int       keptfrom;
+  int       keptto;
+  int       memodepth;
+  int       memogen;
+  int       marked;
+  yyshared *shared;
+  yyshared *spare;
+  yyshared *mark;
+  long      memohits[YYMEMOCOUNT];
+  long      memomisses[YYMEMOCOUNT];
+#endif
+#ifdef YY_CTX_MEMBERS
+  YY_CTX_MEMBERS
+#endif
+};
+
+#ifdef YY_CTX_LOCAL
+#define YY_CTX_PARAM_	yycontext *yyctx,
+#define YY_CTX_PARAM	yycontext *yyctx
+#define YY_CTX_ARG_	yyctx,
+#define YY_CTX_ARG	yyctx
+#else
+#define YY_CTX_PARAM_
+#define YY_CTX_PARAM
+#define YY_CTX_ARG_
+#define YY_CTX_ARG
+yycontext yyctx0;
+yycontext *yyctx= &yyctx0;
+#endif
+
+YY_LOCAL(int) yyrefill(yycontext *ctx)
+{
+#ifdef YY_BUFFER_INPUT
+  return 0;
+#else
+  int yyn;
+  while (ctx->buflen - ctx->pos < 512)
+    {
+      char *buf= (char *)YY_REALLOC(ctx, ctx->buf, ctx->buflen * 2);
+      if (!buf)
+	{
+	  ctx->nomem= 1;
+	  return 0;
+	}
+      ctx->buf= buf;
+      ctx->buflen *= 2;
+    }
+  YY_INPUT((ctx->buf + ctx->pos), yyn, (ctx->buflen - ctx->pos));
+  if (!yyn) return 0;
+  ctx->limit += yyn;
+  return 1;
+#endif
+}
+
+YY_LOCAL(int) yypeek(yycontext *ctx)
+{
+  if (ctx->pos >= ctx->limit && !yyrefill(ctx)) return -1;
+  return (unsigned char)ctx->buf[ctx->pos];
+}
+
+YY_LOCAL(int) yyfirst(int c, unsigned char *bits)
+{
+  return c >= 0 && (bits[c >> 3] & (1 << (c & 7)));
+}
+
+YY_LOCAL(int) yymatchDot(yycontext *ctx)
+{
+  if (ctx->pos >= ctx->limit && !yyrefill(ctx)) return 0;
+  ++ctx->pos;
+  return 1;
+}
+
+YY_LOCAL(int) yymatchChar(yycontext *ctx, int c)
+{
+  if (ctx->pos >= ctx->limit && !yyrefill(ctx)) return 0;
+  if ((unsigned char)ctx->buf[ctx->pos] == c)
+    {
+      ++ctx->pos;
+      yyprintf((stderr, "  ok   yymatchChar(ctx, %c) @ %s\n", c, ctx->buf+ctx->pos));
+      return 1;
+    }
+  yyprintf((stderr, "  fail yymatchChar(ctx, %c) @ %s\n", c, ctx->buf+ctx->pos));
+  return 0;
+}
+
+YY_LOCAL(int) yymatchString(yycontext *ctx, char *s)
+{
+  int yysav= ctx->pos;
+  while (*s)
+    {
+      if (ctx->pos >= ctx->limit && !yyrefill(ctx)) return 0;
+      if (ctx->buf[ctx->pos] != *s)
+        {
+          ctx->pos= yysav;
+          return 0;
+        }
+      ++s;
+      ++ctx->pos;
+    }
+  return 1;
+}
+
+YY_LOCAL(int) yymatchClass(yycontext *ctx, unsigned char *bits)
+{
+  int c;
+  if (ctx->pos >= ctx->limit && !yyrefill(ctx)) return 0;
+  c= (unsigned char)ctx->buf[ctx->pos];
+  if (bits[c >> 3] & (1 << (c & 7)))
+    {
+      ++ctx->pos;
+      yyprintf((stderr, "  ok   yymatchClass @ %s\n", ctx->buf+ctx->pos));
+      return 1;
+    }
+  yyprintf((stderr, "  fail yymatchClass @ %s\n", ctx->buf+ctx->pos));
+  return 0;
+}
+
+YY_LOCAL(void) yyDo(yycontext *ctx, yyaction action, int begin, int end)
+{
+  while (ctx->thunkpos >= ctx->thunkslen)
+    {
+      yythunk *thunks= (yythunk *)YY_REALLOC(ctx, ctx->thunks, sizeof(yythunk) * ctx->thunkslen * 2);
+      if (!thunks)
+	{
+	  ctx->nomem= 1;
+	  return;
+	}
+      ctx->thunks= thunks;
+      ctx->thunkslen *= 2;
+    }
+  ctx->thunks[ctx->thunkpos].begin=  begin;
+  ctx->thunks[ctx->thunkpos].end=    end;
+  ctx->thunks[ctx->thunkpos].action= action;
+  ++ctx->thunkpos;
+}
+
+#ifdef YY_BUFFER_TEXT
+#define YY_TEXT_LENGTH(C)	((C)->end > (C)->begin ? (C)->end - (C)->begin : 0)
+#define YY_TEXT_POINTER(C)	((C)->buf + (C)->begin)
+#else
+#define YY_TEXT_LENGTH(C)	yyText((C), (C)->begin, (C)->end)
+#define YY_TEXT_POINTER(C)	((C)->text)
+
+YY_LOCAL(int) yyText(yycontext *ctx, int begin, int end)
+{
+  int yyleng= end - begin;
+  if (yyleng <= 0)
+    yyleng= 0;
+  else
+    {
+      while (ctx->textlen < (yyleng + 1))
+	{
+	  char *text= (char *)YY_REALLOC(ctx, ctx->text, ctx->textlen * 2);
+	  if (!text)
+	    {
+	      ctx->nomem= 1;
+	      ctx->text[0]= '\0';
+	      return 0;
+	    }
+	  ctx->text= text;
+	  ctx->textlen *= 2;
+	}
+      memcpy(ctx->text, ctx->buf + begin, yyleng);
+    }
+  ctx->text[yyleng]= '\0';
+  return yyleng;
+}
+#endif
+
+YY_LOCAL(void) yyDoThunk(yycontext *ctx, yythunk *thunk, int pos)
+{
+#ifdef YY_BUFFER_TEXT
+  int yyleng= thunk->end ? (thunk->end > thunk->begin ? thunk->end - thunk->begin : 0) : thunk->begin;
+  char *yytext= ctx->buf + thunk->begin;
+#else
+  int yyleng= thunk->end ? yyText(ctx, thunk->begin, thunk->end) : thunk->begin;
+  char *yytext= ctx->text;
+#endif
+  int i;
+  if (!thunk->action)
+    {
+      for (i= 0;  i < thunk->begin && !ctx->nomem;  ++i)
+	yyDoThunk(ctx, thunk->next + i, i);
+      return;
+    }
+  yyprintf((stderr, "DO [%d] %p %.*s\n", pos, thunk->action, thunk->end ? yyleng : 0, yytext));
+  thunk->action(ctx, yytext, yyleng);
+}
+
+YY_LOCAL(void) yyDone(yycontext *ctx)
+{
+  int pos;
+  for (pos= 0;  pos < ctx->thunkpos && !ctx->nomem;  ++pos)
+    yyDoThunk(ctx, &ctx->thunks[pos], pos);
+  ctx->thunkpos= 0;
+}
+
+YY_LOCAL(void) yyCommit(yycontext *ctx)
+{
+#ifdef YY_BUFFER_INPUT
+  ctx->buf += ctx->pos;
+  ctx->limit -= ctx->pos;
+#else
+  if ((ctx->limit -= ctx->pos))
+    {
+      memmove(ctx->buf, ctx->buf + ctx->pos, ctx->limit);
+    }
+#endif
+  ctx->begin -= ctx->pos;
+  ctx->end -= ctx->pos;
+  ctx->pos= ctx->thunkpos= 0;
+#if YYMEMOCOUNT
+  ++ctx->memogen;
+  ctx->sharedbytes= 0;
+  ctx->mark= 0;
+  while (ctx->shared)
+    {
+      yyshared *next= ctx->shared->next;
+      ctx->shared->next= ctx->spare;
+      ctx->spare= ctx->shared;
+      ctx->shared= next;
+    }
+#endif
+}
+
+YY_LOCAL(int) yyAccept(yycontext *ctx, int tp0)
+{
+  if (tp0)
+    {
+      fprintf(stderr, "accept denied at %d\n", tp0);
+      return 0;
+    }
+  else
+    {
+      yyDone(ctx);
+      yyCommit(ctx);
+    }
+  return 1;
+}
+
+#if YYMEMOCOUNT
+
+YY_LOCAL(int) yyRecall(yycontext *ctx, int memo)
+{
+  yymemo *m= &ctx->memos[(ctx->pos * YYMEMOCOUNT + memo) & (ctx->memosize - 1)];
+  if (ctx->nomem)
+    return 0;		/* the parse is being abandoned */
+  if (m->gen != ctx->memogen || m->pos != ctx->pos || m->memo != memo)
+    {
+      if (YY_MEMO_DEPTH && ctx->memodepth >= YY_MEMO_DEPTH)
+	{
+	  ctx->nomem= 2;	/* nested too deeply for the stack */
+	  return 0;
+	}
+      ++ctx->memodepth;
+      ++ctx->memomisses[memo];
+      return -1;
+    }
+  while (ctx->thunkpos + m->thunkcount >= ctx->thunkslen)
+    {
+      yythunk *thunks= (yythunk *)YY_REALLOC(ctx, ctx->thunks, sizeof(yythunk) * ctx->thunkslen * 2);
+      if (!thunks)
+	{
+	  ctx->nomem= 1;
+	  return 0;
+	}
+      ctx->thunks= thunks;
+      ctx->thunkslen *= 2;
+    }
+  ++ctx->memohits[memo];
+  if (m->thunkcount)
+    memcpy(ctx->thunks + ctx->thunkpos, m->thunks, sizeof(yythunk) * m->thunkcount);
+  ctx->thunkpos += m->thunkcount;
+  ctx->pos= m->next;
+  if (m->marked & 1) ctx->begin= m->begin;
+  if (m->marked & 2) ctx->end= m->end;
+  ctx->marked |= m->marked;
+  yyprintf((stderr, "  memo %d @ %s\n", memo, ctx->buf+ctx->pos));
+  return m->ok;
+}
+
+/* Whether the memo table and the shared actions may take bytes more:
+ * they may take up to memolimit if the caller has set it, or else
+ * YY_MEMO_LIMIT.  While memokeep is set they take what they need, and
+ * yyKeepRoom holds the outcomes kept to the limit instead. */
+
+YY_LOCAL(int) yyMemoRoom(yycontext *ctx, long bytes)
+{
+  return ctx->memokeep || ctx->memobytes + ctx->sharedbytes + bytes <= (ctx->memolimit ? ctx->memolimit : YY_MEMO_LIMIT);
+}
+
+/* Whether an outcome at pos that scheduled count actions may be kept
+ * with the ones kept since yyparse() began, or since the last
+ * yyResume(): together they may need up to the limit, for a table with
+ * room for every memoized rule at each position they span, and the old
+ * half of it while it is doubled, for their actions and for those
+ * shared.  The count does not depend on the size of the table or on the
+ * outcomes recorded before, so whether a parse fits does not either. */
+
+YY_LOCAL(int) yyKeepRoom(yycontext *ctx, int pos, int count)
+{
+  int len= 4;
+  if (count > YY_MEMO_SHARE)
+    {
+      ctx->keptbytes += sizeof(yythunk) * count;
+      count= 1;
+    }
+  while (len < count) len *= 2;
+  if (count)
+    ctx->keptbytes += sizeof(yythunk) * len;
+  if (ctx->keptfrom < 0 || pos < ctx->keptfrom) ctx->keptfrom= pos;
+  if (ctx->keptto < pos) ctx->keptto= pos;
+  return ctx->keptbytes + 3L * sizeof(yymemo) * YYMEMOCOUNT * (ctx->keptto - ctx->keptfrom + 1)
+    <= (ctx->memolimit ? ctx->memolimit : YY_MEMO_LIMIT);
+}
+
+/* Thunks of a long result are moved to storage that lasts until the
+ * next commit, and replaced by one thunk that runs them.  Results that
+ * contain it, and every recall of it, then copy only that thunk. */
+
+YY_LOCAL(void) yyShare(yycontext *ctx, int thunkpos)
+{
+  int count= ctx->thunkpos - thunkpos;
+  yyshared *s= ctx->shared, **spare= &ctx->spare;
+  if (!s || s->used + count > s->size)
+    {
+      while ((s= *spare) && s->size < count)
+	spare= &s->next;
+      if (!yyMemoRoom(ctx, sizeof(yythunk) * (s ? s->size : count > 4096 ? count : 4096)))
+	return;		/* the thunks stay where they are */
+      if (s)
+	*spare= s->next;
+      else
+	{
+	  int size= count > 4096 ? count : 4096;
+	  yythunk *thunks= (yythunk *)YY_MALLOC(ctx, sizeof(yythunk) * size);
+	  if (!thunks || !(s= (yyshared *)YY_MALLOC(ctx, sizeof(yyshared))))
+	    {
+	      YY_FREE(ctx, thunks);
+	      return;	/* the thunks stay where they are */
+	    }
+	  s->size= size;
+	  s->thunks= thunks;
+	}
+      s->used= 0;
+      s->next= ctx->shared;
+      ctx->sharedbytes += sizeof(yythunk) * s->size;
+      ctx->shared= s;
+    }
+  memcpy(s->thunks + s->used, ctx->thunks + thunkpos, sizeof(yythunk) * count);
+  ctx->thunks[thunkpos].begin=  count;
+  ctx->thunks[thunkpos].end=    0;
+  ctx->thunks[thunkpos].action= 0;
+  ctx->thunks[thunkpos].next=   s->thunks + s->used;
+  ctx->thunkpos= thunkpos + 1;
+  s->used += count;
+}
+
+/* A result that would replace one recorded further on means that the
+ * parse has backtracked across more text than the table covers, and
+ * will want the results it is losing again.  The table is doubled
+ * instead, for as long as it fits within the limit with the old table,
+ * which is freed only once its results are copied.  While memokeep is
+ * set no result of the parse is replaced: the table is doubled until
+ * the new one has a place of its own. */
+
+YY_LOCAL(int) yyMemoGrow(yycontext *ctx)
+{
+  int size= ctx->memosize, i;
+  yymemo *memos;
+  if (!yyMemoRoom(ctx, sizeof(yymemo) * size * 2)
+      || !(memos= (yymemo *)YY_MALLOC(ctx, sizeof(yymemo) * size * 2)))
+    return 0;
+  for (i= 0;  i < size;  ++i)
+    {
+      yymemo *m= &ctx->memos[i];
+      int high= (m->pos * YYMEMOCOUNT + m->memo) & size;
+      memos[i | high]= *m;
+      memset(&memos[i | (size & ~high)], 0, sizeof(yymemo));
+    }
+  YY_FREE(ctx, ctx->memos);
+  ctx->memos= memos;
+  ctx->memosize= size * 2;
+  ctx->memobytes += sizeof(yymemo) * size;
+  return 1;
+}
+
+YY_LOCAL(int) yyMemo(yycontext *ctx, int memo, int pos, int thunkpos, int marked, int ok)
+{
+  yymemo *m= &ctx->memos[(pos * YYMEMOCOUNT + memo) & (ctx->memosize - 1)];
+  int count;
+  --ctx->memodepth;
+  if (ctx->memokeep && !yyKeepRoom(ctx, pos, ctx->thunkpos - thunkpos))
+    {
+      ctx->nomem= 1;
+      ctx->marked |= marked;
+      return ok;
+    }
+  if (m->gen == ctx->memogen && m->pos > pos)
+    {
+      yyMemoGrow(ctx);
+      m= &ctx->memos[(pos * YYMEMOCOUNT + memo) & (ctx->memosize - 1)];
+    }
+  while (ctx->memokeep && m->gen == ctx->memogen)
+    {
+      if (!yyMemoGrow(ctx))
+	{
+	  ctx->nomem= 1;
+	  ctx->marked |= marked;
+	  return ok;
+	}
+      m= &ctx->memos[(pos * YYMEMOCOUNT + memo) & (ctx->memosize - 1)];
+    }
+  if (ctx->thunkpos - thunkpos > YY_MEMO_SHARE)
+    yyShare(ctx, thunkpos);
+  count= ctx->thunkpos - thunkpos;
+  m->gen= ctx->memogen - 1;
+  if (m->thunkslen < count)
+    {
+      int len= m->thunkslen ? m->thunkslen : 4;
+      yythunk *thunks;
+      while (len < count) len *= 2;
+      if (!yyMemoRoom(ctx, sizeof(yythunk) * (len - m->thunkslen)))
+	thunks= 0;
+      else
+	thunks= (yythunk *)YY_REALLOC(ctx, m->thunks, sizeof(yythunk) * len);
+      if (!thunks)
+	{
+	  if (ctx->memokeep)
+	    ctx->nomem= 1;
+	  ctx->marked |= marked;
+	  return ok;		/* not recorded */
+	}
+      ctx->memobytes += sizeof(yythunk) * (len - m->thunkslen);
+      m->thunks= thunks;
+      m->thunkslen= len;
+    }
+  if (count)
+    memcpy(m->thunks, ctx->thunks + thunkpos, sizeof(yythunk) * count);
+  m->thunkcount= count;
+  m->memo= memo;
+  m->pos= pos;
+  m->gen= ctx->memogen;
+  m->ok= ok;
+  m->next= ctx->pos;
+  m->marked= ctx->marked;
+  m->begin= ctx->begin;
+  m->end= ctx->end;
+  ctx->marked |= marked;
+  return ok;
+}
+
+/* A parse abandoned for want of memory (nomem is 1) or of stack (nomem
+ * is 2) can be resumed by the grammar, to try the input that ran out
+ * another way: yyMark records where the attempt begins, and yyResume,
+ * once it has failed, forgets every outcome recorded and takes back the
+ * actions kept since the mark. */
+
+YY_LOCAL(void) yyMark(yycontext *ctx)
+{
+  ctx->mark= ctx->shared;
+}
+
+YY_LOCAL(int) yyResume(yycontext *ctx)
+{
+  if (!ctx->nomem)
+    return 0;
+  ++ctx->memogen;
+  while (ctx->shared && ctx->shared != ctx->mark)
+    {
+      yyshared *next= ctx->shared->next;
+      ctx->sharedbytes -= sizeof(yythunk) * ctx->shared->size;
+      ctx->shared->next= ctx->spare;
+      ctx->spare= ctx->shared;
+      ctx->shared= next;
+    }
+  ctx->keptbytes= 0;
+  ctx->keptfrom= ctx->keptto= -1;
+  ctx->nomem= 0;
+  return 1;
+}
+
+#endif
+
+YY_LOCAL(void) yyPush(yycontext *ctx, char *text, int count)
+{
+  long offset= ctx->val - ctx->vals + count;
+  while (ctx->valslen <= offset)
+    {
+      YYSTYPE *vals= (YYSTYPE *)YY_REALLOC(ctx, ctx->vals, sizeof(YYSTYPE) * ctx->valslen * 2);
+      if (!vals)
+	{
+	  ctx->nomem= 1;
+	  return;
+	}
+      ctx->vals= vals;
+      ctx->valslen *= 2;
+    }
+  ctx->val= ctx->vals + offset;
+}
+YY_LOCAL(void) yyPop(yycontext *ctx, char *text, int count)   { ctx->val -= count; }
+YY_LOCAL(void) yySet(yycontext *ctx, char *text, int count)   { ctx->val[count]= ctx->yy; }
+
+#endif /* YY_PART */
+
+#define	YYACCEPT	yyAccept(ctx, yythunkpos0)
+
+YY_RULE(int) yy_digit(yycontext *ctx); /* 22 */
+YY_RULE(int) yy_CLOSE(yycontext *ctx); /* 21 */
+YY_RULE(int) yy_OPEN(yycontext *ctx); /* 20 */
+YY_RULE(int) yy_SLASH(yycontext *ctx); /* 19 */
+YY_RULE(int) yy_STAR(yycontext *ctx); /* 18 */
+YY_RULE(int) yy_factor(yycontext *ctx); /* 17 */
+YY_RULE(int) yy_MINUS(yycontext *ctx); /* 16 */
+YY_RULE(int) yy_term(yycontext *ctx); /* 15 */
+YY_RULE(int) yy_PLUS(yycontext *ctx); /* 14 */
+YY_RULE(int) yy_COMMA(yycontext *ctx); /* 13 */
+YY_RULE(int) yy_string(yycontext *ctx); /* 12 */
+YY_RULE(int) yy_EQUAL(yycontext *ctx); /* 11 */
+YY_RULE(int) yy_var(yycontext *ctx); /* 10 */
+YY_RULE(int) yy_var_list(yycontext *ctx); /* 9 */
+YY_RULE(int) yy_relop(yycontext *ctx); /* 8 */
+YY_RULE(int) yy_expression(yycontext *ctx); /* 7 */
+YY_RULE(int) yy_expr_list(yycontext *ctx); /* 6 */
+YY_RULE(int) yy_number(yycontext *ctx); /* 5 */
+YY_RULE(int) yy_CR(yycontext *ctx); /* 4 */
+YY_RULE(int) yy_statement(yycontext *ctx); /* 3 */
+YY_RULE(int) yy__(yycontext *ctx); /* 2 */
+YY_RULE(int) yy_line(yycontext *ctx); /* 1 */
+
+YY_ACTION(void) yy_6_relop(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_6_relop\n"));
+   yy.binop= equalTo; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_5_relop(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_5_relop\n"));
+   yy.binop= greaterThan; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_4_relop(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_4_relop\n"));
+   yy.binop= greaterEqual; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_3_relop(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_3_relop\n"));
+   yy.binop= lessThan; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_2_relop(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_relop\n"));
+   yy.binop= notEqual; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_1_relop(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_relop\n"));
+   yy.binop= lessEqual; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_1_string(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_string\n"));
+   yy.string = yytext; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_1_number(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_number\n"));
+   yy.number = atoi(yytext); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_1_var(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_var\n"));
+   yy.number = yytext[0] - 'a' ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_1_factor(yycontext *ctx, char *yytext, int yyleng)
+{
+#define n ctx->val[-1]
+#define v ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_factor\n"));
+   yy.number = variables[v.number] ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef n
+#undef v
+}
+YY_ACTION(void) yy_3_term(yycontext *ctx, char *yytext, int yyleng)
+{
+#define r ctx->val[-1]
+#define l ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_3_term\n"));
+   yy.number = l.number ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef r
+#undef l
+}
+YY_ACTION(void) yy_2_term(yycontext *ctx, char *yytext, int yyleng)
+{
+#define r ctx->val[-1]
+#define l ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_term\n"));
+   l.number /= r.number ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef r
+#undef l
+}
+YY_ACTION(void) yy_1_term(yycontext *ctx, char *yytext, int yyleng)
+{
+#define r ctx->val[-1]
+#define l ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_term\n"));
+   l.number *= r.number ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef r
+#undef l
+}
+YY_ACTION(void) yy_4_expression(yycontext *ctx, char *yytext, int yyleng)
+{
+#define r ctx->val[-1]
+#define l ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_4_expression\n"));
+   yy.number = l.number ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef r
+#undef l
+}
+YY_ACTION(void) yy_3_expression(yycontext *ctx, char *yytext, int yyleng)
+{
+#define r ctx->val[-1]
+#define l ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_3_expression\n"));
+   l.number -= r.number ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef r
+#undef l
+}
+YY_ACTION(void) yy_2_expression(yycontext *ctx, char *yytext, int yyleng)
+{
+#define r ctx->val[-1]
+#define l ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_expression\n"));
+   l.number += r.number ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef r
+#undef l
+}
+YY_ACTION(void) yy_1_expression(yycontext *ctx, char *yytext, int yyleng)
+{
+#define r ctx->val[-1]
+#define l ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_expression\n"));
+   l.number = -l.number ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef r
+#undef l
+}
+YY_ACTION(void) yy_2_var_list(yycontext *ctx, char *yytext, int yyleng)
+{
+#define v ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_var_list\n"));
+   variables[v.number]= input(); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef v
+}
+YY_ACTION(void) yy_1_var_list(yycontext *ctx, char *yytext, int yyleng)
+{
+#define v ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_var_list\n"));
+   variables[v.number]= input(); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef v
+}
+YY_ACTION(void) yy_5_expr_list(yycontext *ctx, char *yytext, int yyleng)
+{
+#define e ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_5_expr_list\n"));
+   printf("\n"); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef e
+}
+YY_ACTION(void) yy_4_expr_list(yycontext *ctx, char *yytext, int yyleng)
+{
+#define e ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_4_expr_list\n"));
+   printf("%d", e.number); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef e
+}
+YY_ACTION(void) yy_3_expr_list(yycontext *ctx, char *yytext, int yyleng)
+{
+#define e ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_3_expr_list\n"));
+   printf("%s", e.string); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef e
+}
+YY_ACTION(void) yy_2_expr_list(yycontext *ctx, char *yytext, int yyleng)
+{
+#define e ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_expr_list\n"));
+   printf("%d", e.number); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef e
+}
+YY_ACTION(void) yy_1_expr_list(yycontext *ctx, char *yytext, int yyleng)
+{
+#define e ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_expr_list\n"));
+   printf("%s", e.string); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef e
+}
+YY_ACTION(void) yy_16_statement(yycontext *ctx, char *yytext, int yyleng)
+{
+#define s ctx->val[-1]
+#define v ctx->val[-2]
+#define e ctx->val[-3]
+#define e2 ctx->val[-4]
+#define r ctx->val[-5]
+#define e1 ctx->val[-6]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_16_statement\n"));
+   fprintf(stderr, "%s", help); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+}
+YY_ACTION(void) yy_15_statement(yycontext *ctx, char *yytext, int yyleng)
+{
+#define s ctx->val[-1]
+#define v ctx->val[-2]
+#define e ctx->val[-3]
+#define e2 ctx->val[-4]
+#define r ctx->val[-5]
+#define e1 ctx->val[-6]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_15_statement\n"));
+   system("ls *.bas"); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+}
+YY_ACTION(void) yy_14_statement(yycontext *ctx, char *yytext, int yyleng)
+{
+#define s ctx->val[-1]
+#define v ctx->val[-2]
+#define e ctx->val[-3]
+#define e2 ctx->val[-4]
+#define r ctx->val[-5]
+#define e1 ctx->val[-6]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_14_statement\n"));
+   type(s.string); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+}
+YY_ACTION(void) yy_13_statement(yycontext *ctx, char *yytext, int yyleng)
+{
+#define s ctx->val[-1]
+#define v ctx->val[-2]
+#define e ctx->val[-3]
+#define e2 ctx->val[-4]
+#define r ctx->val[-5]
+#define e1 ctx->val[-6]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_13_statement\n"));
+   load(s.string); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+}
+YY_ACTION(void) yy_12_statement(yycontext *ctx, char *yytext, int yyleng)
+{
+#define s ctx->val[-1]
+#define v ctx->val[-2]
+#define e ctx->val[-3]
+#define e2 ctx->val[-4]
+#define r ctx->val[-5]
+#define e1 ctx->val[-6]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_12_statement\n"));
+   save(s.string); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+}
+YY_ACTION(void) yy_11_statement(yycontext *ctx, char *yytext, int yyleng)
+{
+#define s ctx->val[-1]
+#define v ctx->val[-2]
+#define e ctx->val[-3]
+#define e2 ctx->val[-4]
+#define r ctx->val[-5]
+#define e1 ctx->val[-6]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_11_statement\n"));
+   exit(0); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+}
+YY_ACTION(void) yy_10_statement(yycontext *ctx, char *yytext, int yyleng)
+{
+#define s ctx->val[-1]
+#define v ctx->val[-2]
+#define e ctx->val[-3]
+#define e2 ctx->val[-4]
+#define r ctx->val[-5]
+#define e1 ctx->val[-6]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_10_statement\n"));
+   pc= -1;  if (batch) exit(0); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+}
+YY_ACTION(void) yy_9_statement(yycontext *ctx, char *yytext, int yyleng)
+{
+#define s ctx->val[-1]
+#define v ctx->val[-2]
+#define e ctx->val[-3]
+#define e2 ctx->val[-4]
+#define r ctx->val[-5]
+#define e1 ctx->val[-6]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_9_statement\n"));
+   pc= 0; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+}
+YY_ACTION(void) yy_8_statement(yycontext *ctx, char *yytext, int yyleng)
+{
+#define s ctx->val[-1]
+#define v ctx->val[-2]
+#define e ctx->val[-3]
+#define e2 ctx->val[-4]
+#define r ctx->val[-5]
+#define e1 ctx->val[-6]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_8_statement\n"));
+   load(s.string);  pc= 0; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+}
+YY_ACTION(void) yy_7_statement(yycontext *ctx, char *yytext, int yyleng)
+{
+#define s ctx->val[-1]
+#define v ctx->val[-2]
+#define e ctx->val[-3]
+#define e2 ctx->val[-4]
+#define r ctx->val[-5]
+#define e1 ctx->val[-6]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_7_statement\n"));
+   int i;  for (i= 0;  i < numLines;  ++i) printf("%5d %s", lines[i].number, lines[i].text); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+}
+YY_ACTION(void) yy_6_statement(yycontext *ctx, char *yytext, int yyleng)
+{
+#define s ctx->val[-1]
+#define v ctx->val[-2]
+#define e ctx->val[-3]
+#define e2 ctx->val[-4]
+#define r ctx->val[-5]
+#define e1 ctx->val[-6]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_6_statement\n"));
+   while (numLines) accept(lines->number, "\n"); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+}
+YY_ACTION(void) yy_5_statement(yycontext *ctx, char *yytext, int yyleng)
+{
+#define s ctx->val[-1]
+#define v ctx->val[-2]
+#define e ctx->val[-3]
+#define e2 ctx->val[-4]
+#define r ctx->val[-5]
+#define e1 ctx->val[-6]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_5_statement\n"));
+   epc= pc;  if ((pc= sp ? stack[--sp] : -1) < 0) error("no gosub"); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+}
+YY_ACTION(void) yy_4_statement(yycontext *ctx, char *yytext, int yyleng)
+{
+#define s ctx->val[-1]
+#define v ctx->val[-2]
+#define e ctx->val[-3]
+#define e2 ctx->val[-4]
+#define r ctx->val[-5]
+#define e1 ctx->val[-6]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_4_statement\n"));
+   epc= pc;  if (sp < 1024) stack[sp++]= pc, pc= findLine(e.number, 0); else error("too many gosubs");
+							  if (pc < 0) error("no such line"); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+}
+YY_ACTION(void) yy_3_statement(yycontext *ctx, char *yytext, int yyleng)
+{
+#define s ctx->val[-1]
+#define v ctx->val[-2]
+#define e ctx->val[-3]
+#define e2 ctx->val[-4]
+#define r ctx->val[-5]
+#define e1 ctx->val[-6]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_3_statement\n"));
+   variables[v.number]= e.number; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+}
+YY_ACTION(void) yy_2_statement(yycontext *ctx, char *yytext, int yyleng)
+{
+#define s ctx->val[-1]
+#define v ctx->val[-2]
+#define e ctx->val[-3]
+#define e2 ctx->val[-4]
+#define r ctx->val[-5]
+#define e1 ctx->val[-6]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_statement\n"));
+   epc= pc;  if ((pc= findLine(e.number, 0)) < 0) error("no such line"); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+}
+YY_ACTION(void) yy_1_statement(yycontext *ctx, char *yytext, int yyleng)
+{
+#define s ctx->val[-1]
+#define v ctx->val[-2]
+#define e ctx->val[-3]
+#define e2 ctx->val[-4]
+#define r ctx->val[-5]
+#define e1 ctx->val[-6]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_statement\n"));
+   if (!r.binop(e1.number, e2.number)) yythunkpos= 0; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+}
+YY_ACTION(void) yy_3_line(yycontext *ctx, char *yytext, int yyleng)
+{
+#define n ctx->val[-1]
+#define s ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_3_line\n"));
+   exit(0); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef n
+#undef s
+}
+YY_ACTION(void) yy_2_line(yycontext *ctx, char *yytext, int yyleng)
+{
+#define n ctx->val[-1]
+#define s ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_line\n"));
+   epc= pc;  error("syntax error"); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef n
+#undef s
+}
+YY_ACTION(void) yy_1_line(yycontext *ctx, char *yytext, int yyleng)
+{
+#define n ctx->val[-1]
+#define s ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_line\n"));
+   accept(n.number, yytext); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef n
+#undef s
+}
+
+YY_RULE(int) yy_digit(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "digit"));  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l1;
+  yyprintf((stderr, "  ok   %s @ %s\n", "digit", ctx->buf+ctx->pos));
+  return 1;
+  l1:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "digit", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_CLOSE(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "CLOSE"));  if (!yymatchChar(ctx, ')')) goto l2;  if (!yy__(ctx)) goto l2;
+  yyprintf((stderr, "  ok   %s @ %s\n", "CLOSE", ctx->buf+ctx->pos));
+  return 1;
+  l2:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CLOSE", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_OPEN(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "OPEN"));  if (!yymatchChar(ctx, '(')) goto l3;  if (!yy__(ctx)) goto l3;
+  yyprintf((stderr, "  ok   %s @ %s\n", "OPEN", ctx->buf+ctx->pos));
+  return 1;
+  l3:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OPEN", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_SLASH(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "SLASH"));  if (!yymatchChar(ctx, '/')) goto l4;  if (!yy__(ctx)) goto l4;
+  yyprintf((stderr, "  ok   %s @ %s\n", "SLASH", ctx->buf+ctx->pos));
+  return 1;
+  l4:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SLASH", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_STAR(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "STAR"));  if (!yymatchChar(ctx, '*')) goto l5;  if (!yy__(ctx)) goto l5;
+  yyprintf((stderr, "  ok   %s @ %s\n", "STAR", ctx->buf+ctx->pos));
+  return 1;
+  l5:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "STAR", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_factor(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "factor"));
+  {  int yypos10= ctx->pos, yythunkpos10= ctx->thunkpos;  int yyc11= yypeek(ctx);
+  switch (yyc11)
+    {
+     case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104:
+     case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112:
+     case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120:
+     case 121: case 122:  goto l7;
+     case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+     case 56: case 57:  goto l8;
+     case 40:  goto l9;
+    default:  goto l6;
+    }
+  l7:;	  if (!yy_var(ctx)) goto l12;  yyDo(ctx, yySet, -2, 0);  yyDo(ctx, yy_1_factor, ctx->begin, ctx->end);  goto l10;
+  l12:;	  ctx->pos= yypos10; ctx->thunkpos= yythunkpos10;
+  l8:;	  if (!yyfirst(yyc11, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l9;  if (!yy_number(ctx)) goto l13;  yyDo(ctx, yySet, -1, 0);  goto l10;
+  l13:;	  ctx->pos= yypos10; ctx->thunkpos= yythunkpos10;
+  l9:;	  if (!yyfirst(yyc11, (unsigned char *)"\000\000\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l6;  if (!yy_OPEN(ctx)) goto l6;  if (!yy_expression(ctx)) goto l6;  if (!yy_CLOSE(ctx)) goto l6;
+  }
+  l10:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "factor", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 2, 0);
+  return 1;
+  l6:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "factor", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_MINUS(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "MINUS"));  if (!yymatchChar(ctx, '-')) goto l14;  if (!yy__(ctx)) goto l14;
+  yyprintf((stderr, "  ok   %s @ %s\n", "MINUS", ctx->buf+ctx->pos));
+  return 1;
+  l14:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "MINUS", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_term(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "term"));  if (!yy_factor(ctx)) goto l15;  yyDo(ctx, yySet, -2, 0);
+  l16:;	
+  {  int yypos17= ctx->pos, yythunkpos17= ctx->thunkpos;
+  {  int yypos20= ctx->pos, yythunkpos20= ctx->thunkpos;  int yyc21= yypeek(ctx);
+  switch (yyc21)
+    {
+     case 42:  goto l18;
+     case 47:  goto l19;
+    default:  goto l17;
+    }
+  l18:;	  if (!yy_STAR(ctx)) goto l22;  if (!yy_factor(ctx)) goto l22;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_1_term, ctx->begin, ctx->end);  goto l20;
+  l22:;	  ctx->pos= yypos20; ctx->thunkpos= yythunkpos20;
+  l19:;	  if (!yyfirst(yyc21, (unsigned char *)"\000\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l17;  if (!yy_SLASH(ctx)) goto l17;  if (!yy_factor(ctx)) goto l17;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_2_term, ctx->begin, ctx->end);
+  }
+  l20:;	  goto l16;
+  l17:;	  ctx->pos= yypos17; ctx->thunkpos= yythunkpos17;
+  }  yyDo(ctx, yy_3_term, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "term", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 2, 0);
+  return 1;
+  l15:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "term", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_PLUS(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "PLUS"));  if (!yymatchChar(ctx, '+')) goto l23;  if (!yy__(ctx)) goto l23;
+  yyprintf((stderr, "  ok   %s @ %s\n", "PLUS", ctx->buf+ctx->pos));
+  return 1;
+  l23:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "PLUS", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_COMMA(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "COMMA"));  if (!yymatchChar(ctx, ',')) goto l24;  if (!yy__(ctx)) goto l24;
+  yyprintf((stderr, "  ok   %s @ %s\n", "COMMA", ctx->buf+ctx->pos));
+  return 1;
+  l24:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "COMMA", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_string(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "string"));  if (!yymatchChar(ctx, '"')) goto l25;  if (!(YY_BEGIN)) goto l25;
+  l26:;	
+  {  int yypos27= ctx->pos, yythunkpos27= ctx->thunkpos;  if (!yymatchClass(ctx, (unsigned char *)"\377\377\377\377\373\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l27;  goto l26;
+  l27:;	  ctx->pos= yypos27; ctx->thunkpos= yythunkpos27;
+  }  if (!(YY_END)) goto l25;  if (!yymatchChar(ctx, '"')) goto l25;  if (!yy__(ctx)) goto l25;  yyDo(ctx, yy_1_string, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "string", ctx->buf+ctx->pos));
+  return 1;
+  l25:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "string", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_EQUAL(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "EQUAL"));  if (!yymatchChar(ctx, '=')) goto l28;  if (!yy__(ctx)) goto l28;
+  yyprintf((stderr, "  ok   %s @ %s\n", "EQUAL", ctx->buf+ctx->pos));
+  return 1;
+  l28:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EQUAL", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_var(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "var"));  if (!(YY_BEGIN)) goto l29;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l29;  if (!(YY_END)) goto l29;  if (!yy__(ctx)) goto l29;  yyDo(ctx, yy_1_var, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "var", ctx->buf+ctx->pos));
+  return 1;
+  l29:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "var", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_var_list(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "var_list"));  if (!yy_var(ctx)) goto l30;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_1_var_list, ctx->begin, ctx->end);
+  l31:;	
+  {  int yypos32= ctx->pos, yythunkpos32= ctx->thunkpos;  if (!yy_COMMA(ctx)) goto l32;  if (!yy_var(ctx)) goto l32;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_2_var_list, ctx->begin, ctx->end);  goto l31;
+  l32:;	  ctx->pos= yypos32; ctx->thunkpos= yythunkpos32;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "var_list", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 1, 0);
+  return 1;
+  l30:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "var_list", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_relop(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "relop"));
+  {  int yypos40= ctx->pos, yythunkpos40= ctx->thunkpos;  int yyc41= yypeek(ctx);
+  switch (yyc41)
+    {
+     case 60:  goto l34;
+     case 62:  goto l37;
+     case 61:  goto l39;
+    default:  goto l33;
+    }
+  l34:;	  if (!yymatchString(ctx, "<=")) goto l42;  if (!yy__(ctx)) goto l42;  yyDo(ctx, yy_1_relop, ctx->begin, ctx->end);  goto l40;
+  l42:;	  ctx->pos= yypos40; ctx->thunkpos= yythunkpos40;  if (!yyfirst(yyc41, (unsigned char *)"\000\000\000\000\000\000\000\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l36;  if (!yymatchString(ctx, "<>")) goto l43;  if (!yy__(ctx)) goto l43;  yyDo(ctx, yy_2_relop, ctx->begin, ctx->end);  goto l40;
+  l43:;	  ctx->pos= yypos40; ctx->thunkpos= yythunkpos40;
+  l36:;	  if (!yyfirst(yyc41, (unsigned char *)"\000\000\000\000\000\000\000\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l37;  if (!yymatchChar(ctx, '<')) goto l44;  if (!yy__(ctx)) goto l44;  yyDo(ctx, yy_3_relop, ctx->begin, ctx->end);  goto l40;
+  l44:;	  ctx->pos= yypos40; ctx->thunkpos= yythunkpos40;
+  l37:;	  if (!yyfirst(yyc41, (unsigned char *)"\000\000\000\000\000\000\000\100\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l38;  if (!yymatchString(ctx, ">=")) goto l45;  if (!yy__(ctx)) goto l45;  yyDo(ctx, yy_4_relop, ctx->begin, ctx->end);  goto l40;
+  l45:;	  ctx->pos= yypos40; ctx->thunkpos= yythunkpos40;
+  l38:;	  if (!yyfirst(yyc41, (unsigned char *)"\000\000\000\000\000\000\000\100\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l39;  if (!yymatchChar(ctx, '>')) goto l46;  if (!yy__(ctx)) goto l46;  yyDo(ctx, yy_5_relop, ctx->begin, ctx->end);  goto l40;
+  l46:;	  ctx->pos= yypos40; ctx->thunkpos= yythunkpos40;
+  l39:;	  if (!yyfirst(yyc41, (unsigned char *)"\000\000\000\000\000\000\000\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l33;  if (!yymatchChar(ctx, '=')) goto l33;  if (!yy__(ctx)) goto l33;  yyDo(ctx, yy_6_relop, ctx->begin, ctx->end);
+  }
+  l40:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "relop", ctx->buf+ctx->pos));
+  return 1;
+  l33:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "relop", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_expression(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "expression"));
+  {  int yypos50= ctx->pos, yythunkpos50= ctx->thunkpos;  int yyc51= yypeek(ctx);
+  switch (yyc51)
+    {
+     case 40: case 43: case 48: case 49: case 50: case 51: case 52: case 53:
+     case 54: case 55: case 56: case 57: case 97: case 98: case 99: case 100:
+     case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108:
+     case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116:
+     case 117: case 118: case 119: case 120: case 121: case 122:  goto l48;
+     case 45:  goto l49;
+    default:  goto l47;
+    }
+  l48:;	
+  {  int yypos53= ctx->pos, yythunkpos53= ctx->thunkpos;  if (!yy_PLUS(ctx)) goto l53;  goto l54;
+  l53:;	  ctx->pos= yypos53; ctx->thunkpos= yythunkpos53;
+  }
+  l54:;	  if (!yy_term(ctx)) goto l52;  yyDo(ctx, yySet, -2, 0);  goto l50;
+  l52:;	  ctx->pos= yypos50; ctx->thunkpos= yythunkpos50;
+  l49:;	  if (!yyfirst(yyc51, (unsigned char *)"\000\000\000\000\000\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l47;  if (!yy_MINUS(ctx)) goto l47;  if (!yy_term(ctx)) goto l47;  yyDo(ctx, yySet, -2, 0);  yyDo(ctx, yy_1_expression, ctx->begin, ctx->end);
+  }
+  l50:;	
+  l55:;	
+  {  int yypos56= ctx->pos, yythunkpos56= ctx->thunkpos;
+  {  int yypos59= ctx->pos, yythunkpos59= ctx->thunkpos;  int yyc60= yypeek(ctx);
+  switch (yyc60)
+    {
+     case 43:  goto l57;
+     case 45:  goto l58;
+    default:  goto l56;
+    }
+  l57:;	  if (!yy_PLUS(ctx)) goto l61;  if (!yy_term(ctx)) goto l61;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_2_expression, ctx->begin, ctx->end);  goto l59;
+  l61:;	  ctx->pos= yypos59; ctx->thunkpos= yythunkpos59;
+  l58:;	  if (!yyfirst(yyc60, (unsigned char *)"\000\000\000\000\000\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l56;  if (!yy_MINUS(ctx)) goto l56;  if (!yy_term(ctx)) goto l56;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_3_expression, ctx->begin, ctx->end);
+  }
+  l59:;	  goto l55;
+  l56:;	  ctx->pos= yypos56; ctx->thunkpos= yythunkpos56;
+  }  yyDo(ctx, yy_4_expression, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "expression", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 2, 0);
+  return 1;
+  l47:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "expression", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_expr_list(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "expr_list"));
+  {  int yypos63= ctx->pos, yythunkpos63= ctx->thunkpos;
+  {  int yypos67= ctx->pos, yythunkpos67= ctx->thunkpos;  int yyc68= yypeek(ctx);
+  switch (yyc68)
+    {
+     case 34:  goto l65;
+     case 40: case 43: case 45: case 48: case 49: case 50: case 51: case 52:
+     case 53: case 54: case 55: case 56: case 57: case 97: case 98: case 99:
+     case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107:
+     case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115:
+     case 116: case 117: case 118: case 119: case 120: case 121: case 122:  goto l66;
+    default:  goto l63;
+    }
+  l65:;	  if (!yy_string(ctx)) goto l69;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_1_expr_list, ctx->begin, ctx->end);  goto l67;
+  l69:;	  ctx->pos= yypos67; ctx->thunkpos= yythunkpos67;
+  l66:;	  if (!yyfirst(yyc68, (unsigned char *)"\000\000\000\000\000\051\377\003\000\000\000\000\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l63;  if (!yy_expression(ctx)) goto l63;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_2_expr_list, ctx->begin, ctx->end);
+  }
+  l67:;	  goto l64;
+  l63:;	  ctx->pos= yypos63; ctx->thunkpos= yythunkpos63;
+  }
+  l64:;	
+  l70:;	
+  {  int yypos71= ctx->pos, yythunkpos71= ctx->thunkpos;  if (!yy_COMMA(ctx)) goto l71;
+  {  int yypos74= ctx->pos, yythunkpos74= ctx->thunkpos;  int yyc75= yypeek(ctx);
+  switch (yyc75)
+    {
+     case 34:  goto l72;
+     case 40: case 43: case 45: case 48: case 49: case 50: case 51: case 52:
+     case 53: case 54: case 55: case 56: case 57: case 97: case 98: case 99:
+     case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107:
+     case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115:
+     case 116: case 117: case 118: case 119: case 120: case 121: case 122:  goto l73;
+    default:  goto l71;
+    }
+  l72:;	  if (!yy_string(ctx)) goto l76;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_3_expr_list, ctx->begin, ctx->end);  goto l74;
+  l76:;	  ctx->pos= yypos74; ctx->thunkpos= yythunkpos74;
+  l73:;	  if (!yyfirst(yyc75, (unsigned char *)"\000\000\000\000\000\051\377\003\000\000\000\000\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l71;  if (!yy_expression(ctx)) goto l71;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_4_expr_list, ctx->begin, ctx->end);
+  }
+  l74:;	  goto l70;
+  l71:;	  ctx->pos= yypos71; ctx->thunkpos= yythunkpos71;
+  }
+  {  int yypos79= ctx->pos, yythunkpos79= ctx->thunkpos;  int yyc80= yypeek(ctx);
+  switch (yyc80)
+    {
+     case 44:  goto l77;
+    default:  goto l78;
+    }
+  l77:;	  if (!yy_COMMA(ctx)) goto l81;  goto l79;
+  l81:;	  ctx->pos= yypos79; ctx->thunkpos= yythunkpos79;
+  l78:;	
+  {  int yypos82= ctx->pos, yythunkpos82= ctx->thunkpos;  if (!yy_COMMA(ctx)) goto l82;  goto l62;
+  l82:;	  ctx->pos= yypos82; ctx->thunkpos= yythunkpos82;
+  }  yyDo(ctx, yy_5_expr_list, ctx->begin, ctx->end);
+  }
+  l79:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "expr_list", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 1, 0);
+  return 1;
+  l62:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "expr_list", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_number(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "number"));  if (!(YY_BEGIN)) goto l83;  if (!yy_digit(ctx)) goto l83;
+  l84:;	
+  {  int yypos85= ctx->pos, yythunkpos85= ctx->thunkpos;  if (!yy_digit(ctx)) goto l85;  goto l84;
+  l85:;	  ctx->pos= yypos85; ctx->thunkpos= yythunkpos85;
+  }  if (!(YY_END)) goto l83;  if (!yy__(ctx)) goto l83;  yyDo(ctx, yy_1_number, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "number", ctx->buf+ctx->pos));
+  return 1;
+  l83:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "number", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_CR(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "CR"));
+  {  int yypos89= ctx->pos, yythunkpos89= ctx->thunkpos;  int yyc90= yypeek(ctx);
+  switch (yyc90)
+    {
+     case 10: case 13:  goto l87;
+    default:  goto l86;
+    }
+  l87:;	  if (!yymatchClass(ctx, (unsigned char *)"\000\044\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l91;  goto l89;
+  l91:;	  ctx->pos= yypos89; ctx->thunkpos= yythunkpos89;  if (!yyfirst(yyc90, (unsigned char *)"\000\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l86;  if (!yymatchString(ctx, "\r\n")) goto l86;
+  }
+  l89:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "CR", ctx->buf+ctx->pos));
+  return 1;
+  l86:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CR", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_statement(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 6, 0);
+  yyprintf((stderr, "%s\n", "statement"));
+  {  int yypos112= ctx->pos, yythunkpos112= ctx->thunkpos;  int yyc113= yypeek(ctx);
+  switch (yyc113)
+    {
+     case 112:  goto l93;
+     case 105:  goto l94;
+     case 103:  goto l95;
+     case 108:  goto l97;
+     case 114:  goto l99;
+     case 99:  goto l100;
+     case 101:  goto l104;
+     case 98: case 113:  goto l106;
+     case 115:  goto l107;
+     case 116:  goto l109;
+     case 100:  goto l110;
+     case 104:  goto l111;
+    default:  goto l92;
+    }
+  l93:;	  if (!yymatchString(ctx, "print")) goto l114;  if (!yy__(ctx)) goto l114;  if (!yy_expr_list(ctx)) goto l114;  goto l112;
+  l114:;	  ctx->pos= yypos112; ctx->thunkpos= yythunkpos112;
+  l94:;	  if (!yyfirst(yyc113, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l95;  if (!yymatchString(ctx, "if")) goto l115;  if (!yy__(ctx)) goto l115;  if (!yy_expression(ctx)) goto l115;  yyDo(ctx, yySet, -6, 0);  if (!yy_relop(ctx)) goto l115;  yyDo(ctx, yySet, -5, 0);  if (!yy_expression(ctx)) goto l115;  yyDo(ctx, yySet, -4, 0);  yyDo(ctx, yy_1_statement, ctx->begin, ctx->end);  if (!yymatchString(ctx, "then")) goto l115;  if (!yy__(ctx)) goto l115;  if (!yy_statement(ctx)) goto l115;  goto l112;
+  l115:;	  ctx->pos= yypos112; ctx->thunkpos= yythunkpos112;
+  l95:;	  if (!yyfirst(yyc113, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l96;  if (!yymatchString(ctx, "goto")) goto l116;  if (!yy__(ctx)) goto l116;  if (!yy_expression(ctx)) goto l116;  yyDo(ctx, yySet, -3, 0);  yyDo(ctx, yy_2_statement, ctx->begin, ctx->end);  goto l112;
+  l116:;	  ctx->pos= yypos112; ctx->thunkpos= yythunkpos112;
+  l96:;	  if (!yyfirst(yyc113, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l97;  if (!yymatchString(ctx, "input")) goto l117;  if (!yy__(ctx)) goto l117;  if (!yy_var_list(ctx)) goto l117;  goto l112;
+  l117:;	  ctx->pos= yypos112; ctx->thunkpos= yythunkpos112;
+  l97:;	  if (!yyfirst(yyc113, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\000\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l98;  if (!yymatchString(ctx, "let")) goto l118;  if (!yy__(ctx)) goto l118;  if (!yy_var(ctx)) goto l118;  yyDo(ctx, yySet, -2, 0);  if (!yy_EQUAL(ctx)) goto l118;  if (!yy_expression(ctx)) goto l118;  yyDo(ctx, yySet, -3, 0);  yyDo(ctx, yy_3_statement, ctx->begin, ctx->end);  goto l112;
+  l118:;	  ctx->pos= yypos112; ctx->thunkpos= yythunkpos112;
+  l98:;	  if (!yyfirst(yyc113, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l99;  if (!yymatchString(ctx, "gosub")) goto l119;  if (!yy__(ctx)) goto l119;  if (!yy_expression(ctx)) goto l119;  yyDo(ctx, yySet, -3, 0);  yyDo(ctx, yy_4_statement, ctx->begin, ctx->end);  goto l112;
+  l119:;	  ctx->pos= yypos112; ctx->thunkpos= yythunkpos112;
+  l99:;	  if (!yyfirst(yyc113, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l100;  if (!yymatchString(ctx, "return")) goto l120;  if (!yy__(ctx)) goto l120;  yyDo(ctx, yy_5_statement, ctx->begin, ctx->end);  goto l112;
+  l120:;	  ctx->pos= yypos112; ctx->thunkpos= yythunkpos112;
+  l100:;	  if (!yyfirst(yyc113, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l101;  if (!yymatchString(ctx, "clear")) goto l121;  if (!yy__(ctx)) goto l121;  yyDo(ctx, yy_6_statement, ctx->begin, ctx->end);  goto l112;
+  l121:;	  ctx->pos= yypos112; ctx->thunkpos= yythunkpos112;
+  l101:;	  if (!yyfirst(yyc113, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\000\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l102;  if (!yymatchString(ctx, "list")) goto l122;  if (!yy__(ctx)) goto l122;  yyDo(ctx, yy_7_statement, ctx->begin, ctx->end);  goto l112;
+  l122:;	  ctx->pos= yypos112; ctx->thunkpos= yythunkpos112;
+  l102:;	  if (!yyfirst(yyc113, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l103;  if (!yymatchString(ctx, "run")) goto l123;  if (!yy__(ctx)) goto l123;  if (!yy_string(ctx)) goto l123;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_8_statement, ctx->begin, ctx->end);  goto l112;
+  l123:;	  ctx->pos= yypos112; ctx->thunkpos= yythunkpos112;
+  l103:;	  if (!yyfirst(yyc113, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l104;  if (!yymatchString(ctx, "run")) goto l124;  if (!yy__(ctx)) goto l124;  yyDo(ctx, yy_9_statement, ctx->begin, ctx->end);  goto l112;
+  l124:;	  ctx->pos= yypos112; ctx->thunkpos= yythunkpos112;
+  l104:;	  if (!yyfirst(yyc113, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l105;  if (!yymatchString(ctx, "end")) goto l125;  if (!yy__(ctx)) goto l125;  yyDo(ctx, yy_10_statement, ctx->begin, ctx->end);  goto l112;
+  l125:;	  ctx->pos= yypos112; ctx->thunkpos= yythunkpos112;
+  l105:;	  if (!yyfirst(yyc113, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l106;  if (!yymatchString(ctx, "rem")) goto l126;  if (!yy__(ctx)) goto l126;
+  l127:;	
+  {  int yypos128= ctx->pos, yythunkpos128= ctx->thunkpos;
+  {  int yypos129= ctx->pos, yythunkpos129= ctx->thunkpos;  if (!yy_CR(ctx)) goto l129;  goto l128;
+  l129:;	  ctx->pos= yypos129; ctx->thunkpos= yythunkpos129;
+  }  if (!yymatchDot(ctx)) goto l128;  goto l127;
+  l128:;	  ctx->pos= yypos128; ctx->thunkpos= yythunkpos128;
+  }  goto l112;
+  l126:;	  ctx->pos= yypos112; ctx->thunkpos= yythunkpos112;
+  l106:;	  if (!yyfirst(yyc113, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\044\000\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l107;
+  {  int yypos134= ctx->pos, yythunkpos134= ctx->thunkpos;  int yyc135= yypeek(ctx);
+  switch (yyc135)
+    {
+     case 98:  goto l131;
+     case 113:  goto l132;
+     case 101:  goto l133;
+    default:  goto l130;
+    }
+  l131:;	  if (!yymatchString(ctx, "bye")) goto l136;  goto l134;
+  l136:;	  ctx->pos= yypos134; ctx->thunkpos= yythunkpos134;
+  l132:;	  if (!yyfirst(yyc135, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l133;  if (!yymatchString(ctx, "quit")) goto l137;  goto l134;
+  l137:;	  ctx->pos= yypos134; ctx->thunkpos= yythunkpos134;
+  l133:;	  if (!yyfirst(yyc135, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l130;  if (!yymatchString(ctx, "exit")) goto l130;
+  }
+  l134:;	  if (!yy__(ctx)) goto l130;  yyDo(ctx, yy_11_statement, ctx->begin, ctx->end);  goto l112;
+  l130:;	  ctx->pos= yypos112; ctx->thunkpos= yythunkpos112;
+  l107:;	  if (!yyfirst(yyc113, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l108;  if (!yymatchString(ctx, "save")) goto l138;  if (!yy__(ctx)) goto l138;  if (!yy_string(ctx)) goto l138;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_12_statement, ctx->begin, ctx->end);  goto l112;
+  l138:;	  ctx->pos= yypos112; ctx->thunkpos= yythunkpos112;
+  l108:;	  if (!yyfirst(yyc113, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\000\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l109;  if (!yymatchString(ctx, "load")) goto l139;  if (!yy__(ctx)) goto l139;  if (!yy_string(ctx)) goto l139;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_13_statement, ctx->begin, ctx->end);  goto l112;
+  l139:;	  ctx->pos= yypos112; ctx->thunkpos= yythunkpos112;
+  l109:;	  if (!yyfirst(yyc113, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l110;  if (!yymatchString(ctx, "type")) goto l140;  if (!yy__(ctx)) goto l140;  if (!yy_string(ctx)) goto l140;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_14_statement, ctx->begin, ctx->end);  goto l112;
+  l140:;	  ctx->pos= yypos112; ctx->thunkpos= yythunkpos112;
+  l110:;	  if (!yyfirst(yyc113, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l111;  if (!yymatchString(ctx, "dir")) goto l141;  if (!yy__(ctx)) goto l141;  yyDo(ctx, yy_15_statement, ctx->begin, ctx->end);  goto l112;
+  l141:;	  ctx->pos= yypos112; ctx->thunkpos= yythunkpos112;
+  l111:;	  if (!yyfirst(yyc113, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l92;  if (!yymatchString(ctx, "help")) goto l92;  if (!yy__(ctx)) goto l92;  yyDo(ctx, yy_16_statement, ctx->begin, ctx->end);
+  }
+  l112:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "statement", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 6, 0);
+  return 1;
+  l92:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "statement", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy__(yycontext *ctx)
+{
+  yyprintf((stderr, "%s\n", "_"));
+  l143:;	
+  {  int yypos144= ctx->pos, yythunkpos144= ctx->thunkpos;  if (!yymatchClass(ctx, (unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l144;  goto l143;
+  l144:;	  ctx->pos= yypos144; ctx->thunkpos= yythunkpos144;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "_", ctx->buf+ctx->pos));
+  return 1;
+}
+YY_RULE(int) yy_line(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "line"));
+  {  int yypos151= ctx->pos, yythunkpos151= ctx->thunkpos;  int yyc152= yypeek(ctx);
+  switch (yyc152)
+    {
+     case 9: case 32: case 98: case 99: case 100: case 101: case 103: case 104:
+     case 105: case 108: case 112: case 113: case 114: case 115: case 116:  goto l146;
+     case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+     case 56: case 57:  goto l147;
+     case 10: case 13:  goto l148;
+    default:  goto l149;
+    }
+  l146:;	  if (!yy__(ctx)) goto l153;  if (!yy_statement(ctx)) goto l153;  yyDo(ctx, yySet, -2, 0);  if (!yy_CR(ctx)) goto l153;  goto l151;
+  l153:;	  ctx->pos= yypos151; ctx->thunkpos= yythunkpos151;
+  l147:;	  if (!yyfirst(yyc152, (unsigned char *)"\000\002\000\000\001\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l148;  if (!yy__(ctx)) goto l154;  if (!yy_number(ctx)) goto l154;  yyDo(ctx, yySet, -1, 0);  if (!(YY_BEGIN)) goto l154;
+  l155:;	
+  {  int yypos156= ctx->pos, yythunkpos156= ctx->thunkpos;
+  {  int yypos157= ctx->pos, yythunkpos157= ctx->thunkpos;  if (!yy_CR(ctx)) goto l157;  goto l156;
+  l157:;	  ctx->pos= yypos157; ctx->thunkpos= yythunkpos157;
+  }  if (!yymatchDot(ctx)) goto l156;  goto l155;
+  l156:;	  ctx->pos= yypos156; ctx->thunkpos= yythunkpos156;
+  }  if (!yy_CR(ctx)) goto l154;  if (!(YY_END)) goto l154;  yyDo(ctx, yy_1_line, ctx->begin, ctx->end);  goto l151;
+  l154:;	  ctx->pos= yypos151; ctx->thunkpos= yythunkpos151;
+  l148:;	  if (!yyfirst(yyc152, (unsigned char *)"\000\046\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l149;  if (!yy__(ctx)) goto l158;  if (!yy_CR(ctx)) goto l158;  goto l151;
+  l158:;	  ctx->pos= yypos151; ctx->thunkpos= yythunkpos151;
+  l149:;	  if (!yy__(ctx)) goto l159;  if (!(YY_BEGIN)) goto l159;
+  l160:;	
+  {  int yypos161= ctx->pos, yythunkpos161= ctx->thunkpos;
+  {  int yypos162= ctx->pos, yythunkpos162= ctx->thunkpos;  if (!yy_CR(ctx)) goto l162;  goto l161;
+  l162:;	  ctx->pos= yypos162; ctx->thunkpos= yythunkpos162;
+  }  if (!yymatchDot(ctx)) goto l161;  goto l160;
+  l161:;	  ctx->pos= yypos161; ctx->thunkpos= yythunkpos161;
+  }  if (!yy_CR(ctx)) goto l159;  if (!(YY_END)) goto l159;  yyDo(ctx, yy_2_line, ctx->begin, ctx->end);  goto l151;
+  l159:;	  ctx->pos= yypos151; ctx->thunkpos= yythunkpos151;  if (!yy__(ctx)) goto l145;
+  {  int yypos163= ctx->pos, yythunkpos163= ctx->thunkpos;  if (!yymatchDot(ctx)) goto l163;  goto l145;
+  l163:;	  ctx->pos= yypos163; ctx->thunkpos= yythunkpos163;
+  }  yyDo(ctx, yy_3_line, ctx->begin, ctx->end);
+  }
+  l151:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "line", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 2, 0);
+  return 1;
+  l145:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "line", ctx->buf+ctx->pos));
+  return 0;
+}
+
+#ifndef YY_PART
+
+typedef int (*yyrule)(yycontext *ctx);
+
+YY_PARSE(int) YYPARSEFROM(YY_CTX_PARAM_ yyrule yystart)
+{
+  int yyok;
+  if (!yyctx->textlen)
+    {
+#ifndef YY_BUFFER_INPUT
+      yyctx->buf= (char *)YY_MALLOC(yyctx, 1024);
+      yyctx->pos= yyctx->limit= 0;
+#endif
+      yyctx->text= (char *)YY_MALLOC(yyctx, 1024);
+      yyctx->thunks= (yythunk *)YY_MALLOC(yyctx, sizeof(yythunk) * 32);
+      yyctx->vals= (YYSTYPE *)YY_MALLOC(yyctx, sizeof(YYSTYPE) * 32);
+#if YYMEMOCOUNT
+      yyctx->memos= (yymemo *)YY_MALLOC(yyctx, sizeof(yymemo) * YY_MEMO_SIZE);
+      yyctx->shared= yyctx->spare= yyctx->mark= 0;
+#endif
+      if (!yyctx->text || !yyctx->thunks || !yyctx->vals
+#ifndef YY_BUFFER_INPUT
+	  || !yyctx->buf
+#endif
+#if YYMEMOCOUNT
+	  || !yyctx->memos
+#endif
+	  )
+	{
+#ifndef YY_BUFFER_INPUT
+	  YY_FREE(yyctx, yyctx->buf);
+#endif
+	  YY_FREE(yyctx, yyctx->text);
+	  YY_FREE(yyctx, yyctx->thunks);
+	  YY_FREE(yyctx, yyctx->vals);
+#if YYMEMOCOUNT
+	  YY_FREE(yyctx, yyctx->memos);
+#endif
+	  return 0;
+	}
+#ifndef YY_BUFFER_INPUT
+      yyctx->buflen= 1024;
+#endif
+#if YYMEMOCOUNT
+      memset(yyctx->memos, 0, sizeof(yymemo) * YY_MEMO_SIZE);
+      yyctx->memosize= YY_MEMO_SIZE;
+      yyctx->memobytes= sizeof(yymemo) * YY_MEMO_SIZE;
+      yyctx->sharedbytes= 0;
+#endif
+      yyctx->textlen= 1024;
+      yyctx->thunkslen= 32;
+      yyctx->valslen= 32;
+      yyctx->begin= yyctx->end= yyctx->thunkpos= 0;
+    }
+#if YYMEMOCOUNT
+  ++yyctx->memogen;
+  yyctx->marked= 0;
+  yyctx->memokeep= 0;
+  yyctx->keptbytes= 0;
+  yyctx->keptfrom= yyctx->keptto= -1;
+  yyctx->memodepth= 0;
+#endif
+  yyctx->nomem= 0;
+  yyctx->begin= yyctx->end= yyctx->pos;
+  yyctx->thunkpos= 0;
+  yyctx->val= yyctx->vals;
+  yyok= yystart(yyctx);
+  if (yyok && !yyctx->nomem) yyDone(yyctx);
+  yyCommit(yyctx);
+  return yyok && !yyctx->nomem;
+}
+
+YY_PARSE(int) YYPARSE(YY_CTX_PARAM)
+{
+  return YYPARSEFROM(YY_CTX_ARG_ yy_line);
+}
+
+#ifdef YY_BUFFER_INPUT
+YY_PARSE(void) YYSETBUFFER(YY_CTX_PARAM_ char *yybuffer, int yylength)
+{
+  yyctx->buf= yybuffer;
+  yyctx->limit= yylength;
+  yyctx->begin= yyctx->end= yyctx->pos= yyctx->thunkpos= 0;
+}
+#endif
+
+YY_PARSE(void) YYRELEASE(YY_CTX_PARAM)
+{
+  if (yyctx->buflen)
+    {
+      yyctx->buflen= 0;
+      YY_FREE(yyctx, yyctx->buf);
+    }
+  if (yyctx->textlen)
+    {
+      yyctx->textlen= 0;
+      YY_FREE(yyctx, yyctx->text);
+      YY_FREE(yyctx, yyctx->thunks);
+      YY_FREE(yyctx, yyctx->vals);
+#if YYMEMOCOUNT
+      {
+	yyshared *s, *next;
+	int i;
+	for (i= 0;  i < yyctx->memosize;  ++i)
+	  YY_FREE(yyctx, yyctx->memos[i].thunks);
+	YY_FREE(yyctx, yyctx->memos);
+	for (s= yyctx->shared;  s;  s= next)
+	  {
+	    next= s->next;
+	    YY_FREE(yyctx, s->thunks);
+	    YY_FREE(yyctx, s);
+	  }
+	for (s= yyctx->spare;  s;  s= next)
+	  {
+	    next= s->next;
+	    YY_FREE(yyctx, s->thunks);
+	    YY_FREE(yyctx, s);
+	  }
+	yyctx->shared= yyctx->spare= yyctx->mark= 0;
+      }
+#endif
+    }
+}
+
+#endif
+
+
+#include <unistd.h>
+#include <stdarg.h>
+
+char *help=
+  "print <num>|<string> [, <num>|<string> ...] [,]\n"
+  "if <expr> <|<=|<>|=|>=|> <expr> then <stmt>\n"
+  "input <var> [, <var> ...]     let <var> = <expr>\n"
+  "goto <expr>                   gosub <expr>\n"
+  "end                           return\n"
+  "list                          clear\n"
+  "run [\"filename\"]              rem <comment...>\n"
+  "dir                           type \"filename\"\n"
+  "save \"filename\"               load \"filename\"\n"
+  "bye|quit|exit                 help\n"
+  ;
+
+void error(char *fmt, ...)
+{
+  va_list ap;
+  va_start(ap, fmt);
+  if (epc > 0)
+    fprintf(stderr, "\nline %d: %s", lines[epc-1].number, lines[epc-1].text);
+  else
+    fprintf(stderr, "\n");
+  vfprintf(stderr, fmt, ap);
+  fprintf(stderr, "\n");
+  va_end(ap);
+  epc= pc= -1;
+}
+
+#ifdef USE_READLINE
+# include <readline/readline.h>
+# include <readline/history.h>
+#endif
+
+int nextline(char *buf, int max)
+{
+  pc= -1;
+  if (batch) exit(0);
+  if (isatty(fileno(stdin)))
+    {
+#    ifdef USE_READLINE
+      char *line= readline(">");
+      if (line)
+	{
+	  int len= strlen(line);
+	  if (len >= max) len= max - 1;
+	  strncpy(buf, line, len);
+	  (buf)[len]= '\n';
+	  add_history(line);
+	  free(line);
+	  return len + 1;
+	}
+      else
+	{
+	  printf("\n");
+	  return 0;
+	}
+#    endif
+      putchar('>');
+      fflush(stdout);
+    }
+  return fgets(buf, max, stdin) ? strlen(buf) : 0;
+}
+
+int maxLines= 0;
+
+int findLine(int n, int create)
+{
+  int lo= 0, hi= numLines - 1;
+  while (lo <= hi)
+    {
+      int mid= (lo + hi) / 2, lno= lines[mid].number;
+      if (lno > n)
+	hi= mid - 1;
+      else if (lno < n)
+	lo= mid + 1;
+      else
+	return mid;
+    }
+  if (create)
+    {
+      if (numLines == maxLines)
+	{
+	  maxLines *= 2;
+	  lines= realloc(lines, sizeof(line) * maxLines);
+	}
+      if (lo < numLines)
+	memmove(lines + lo + 1, lines + lo, sizeof(line) * (numLines - lo));
+      ++numLines;
+      lines[lo].number= n;
+      lines[lo].text= 0;
+      return lo;
+    }
+  return -1;
+}
+
+void accept(int n, char *s)
+{
+  if (s[0] < 32)	/* delete */
+    {
+      int lno= findLine(n, 0);
+      if (lno >= 0)
+	{
+	  if (lno < numLines - 1)
+	    memmove(lines + lno, lines + lno + 1, sizeof(line) * (numLines - lno - 1));
+	  --numLines;
+	}
+    }
+  else			/* insert */
+    {
+      int lno= findLine(n, 1);
+      if (lines[lno].text) free(lines[lno].text);
+      lines[lno].length= strlen(s);
+      lines[lno].text= strdup(s);
+    }
+}
+
+char *extend(char *name)
+{
+  static char path[1024];
+  int len= strlen(name);
+  sprintf(path, "%s%s", name, (((len > 4) && !strcasecmp(".bas", name + len - 4)) ? "" : ".bas"));
+  return path;
+}
+
+void save(char *name)
+{
+  FILE *f= fopen(name= extend(name), "w");
+  if (!f)
+    perror(name);
+  else
+    {
+      int i;
+      for (i= 0;  i < numLines;  ++i)
+	fprintf(f, "%d %s", lines[i].number, lines[i].text);
+      fclose(f);
+    }
+}
+
+void load(char *name)
+{
+  FILE *f= fopen(name= extend(name), "r");
+  if (!f)
+    perror(name);
+  else
+    {
+      int  lineNumber;
+      char lineText[1024];
+      while ((1 == fscanf(f, " %d ", &lineNumber)) && fgets(lineText, sizeof(lineText), f))
+	accept(lineNumber, lineText);
+      fclose(f);
+    }
+}
+
+void type(char *name)
+{
+  FILE *f= fopen(name= extend(name), "r");
+  if (!f)
+    perror(name);
+  else
+    {
+      int  c, d;
+      while ((c= getc(f)) >= 0)
+	putchar(d= c);
+      fclose(f);
+      if ('\n' != d && '\r' != d) putchar('\n');
+    }
+}
+
+int input(void)
+{
+  char line[32];
+  fgets(line, sizeof(line), stdin);
+  return atoi(line);
+}
+
+int main(int argc, char **argv)
+{
+  lines= malloc(sizeof(line) * (maxLines= 32));
+  numLines= 0;
+
+  if (argc > 1)
+    {
+      batch= 1;
+      while (argc-- > 1)
+	load(*++argv);
+      pc= 0;
+    }
+
+  while (!feof(stdin))
+    yyparse();
+
+  return 0;
+}
+
@@ -0,0 +1,18 @@
+#include <stdio.h>
+
+#define YY_CTX_LOCAL
+#define YY_BUFFER_INPUT
+
+#include "test.peg.c"
+
+int main()
+{
+  char input[1024];
+  int length= fread(input, 1, sizeof(input), stdin);
+  yycontext ctx;
+  memset(&ctx, 0, sizeof(yycontext));
+  yysetbuffer(&ctx, input, length);
+  while (yyparse(&ctx));
+  yyrelease(&ctx);
+  return 0;
+}
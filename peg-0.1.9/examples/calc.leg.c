@@ -0,0 +1,1242 @@
+/* A recursive-descent parser generated by peg 0.1.9 */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define YYRULECOUNT 16
+#define YYMEMOCOUNT 0
+
+#include <stdio.h>
+int vars[26];
+
+#ifndef YY_LOCAL
+#define YY_LOCAL(T)	static T
+#endif
+#ifndef YY_ACTION
+#define YY_ACTION(T)	static T
+#endif
+#ifndef YY_RULE
+#define YY_RULE(T)	static T
+#endif
+#ifndef YY_PARSE
+#define YY_PARSE(T)	T
+#endif
+#ifndef YYPARSE
+#define YYPARSE		yyparse
+#endif
+#ifndef YYPARSEFROM
+#define YYPARSEFROM	yyparsefrom
+#endif
+#ifndef YYSETBUFFER
+#define YYSETBUFFER	yysetbuffer
+#endif
+#ifndef YYMEMOREPORT
+#define YYMEMOREPORT	yymemoreport
+#endif
+#ifndef YYRELEASE
+#define YYRELEASE	yyrelease
+#endif
+#ifndef YY_INPUT
+#define YY_INPUT(buf, result, max_size)			\
+  {							\
+    int yyc= getchar();					\
+    result= (EOF == yyc) ? 0 : (*(buf)= yyc, 1);	\
+    yyprintf((stderr, "<%c>", yyc));			\
+  }
+#endif
+#ifndef YY_MALLOC
+#define YY_MALLOC(C, N)		malloc(N)
+#endif
+#ifndef YY_REALLOC
+#define YY_REALLOC(C, P, N)	realloc(P, N)
+#endif
+#ifndef YY_FREE
+#define YY_FREE(C, P)		free(P)
+#endif
+#ifndef YY_BEGIN
+#define YY_BEGIN	( ctx->begin= ctx->pos, 1)
+#endif
+#ifndef YY_END
+#define YY_END		( ctx->end= ctx->pos, 1)
+#endif
+#ifdef YY_DEBUG
+# define yyprintf(args)	fprintf args
+#else
+# define yyprintf(args)
+#endif
+#ifndef YYSTYPE
+#define YYSTYPE	int
+#endif
+
+#ifndef YY_PART
+
+typedef struct _yycontext yycontext;
+typedef void (*yyaction)(yycontext *ctx, char *yytext, int yyleng);
+typedef struct _yythunk { int begin, end;  yyaction  action;  struct _yythunk *next; } yythunk;
+
+#if YYMEMOCOUNT
+#ifndef YY_MEMO_SIZE
+#define YY_MEMO_SIZE	16384
+#endif
+#ifndef YY_MEMO_SHARE
+#define YY_MEMO_SHARE	16
+#endif
+#ifndef YY_MEMO_LIMIT
+#define YY_MEMO_LIMIT	(256L << 20)
+#endif
+#ifndef YY_MEMO_DEPTH
+#define YY_MEMO_DEPTH	0
+#endif
+typedef struct _yymemo { int memo, pos, gen, ok, next, marked, begin, end;  yythunk *thunks;  int thunkslen, thunkcount; } yymemo;
+typedef struct _yyshared { struct _yyshared *next;  int size, used;  yythunk *thunks; } yyshared;
+#endif
+
+struct _yycontext {
+  char     *buf;
+  int       buflen;
+  int       pos;
+  int       limit;
+  char     *text;
+  int       textlen;
+  int       begin;
+  int       end;
+  int       textmax;
+  yythunk  *thunks;
+  int       thunkslen;
+  int       thunkpos;
+  YYSTYPE   yy;
+  YYSTYPE  *val;
+  YYSTYPE  *vals;
+  int       valslen;
+  int       nomem;
+#if YYMEMOCOUNT
+  yymemo   *memos;
+  int       memosize;
+  long      memobytes;
+  long      sharedbytes;
+  long      memolimit;
+  int       memokeep;
+  long      keptbytes;
+  int       keptfrom;
+  int       keptto;
+  int       memodepth;
+  int       memogen;
+  int       marked;
+  yyshared *shared;
+  yyshared *spare;
+  yyshared *mark;
+  long      memohits[YYMEMOCOUNT];
+  long      memomisses[YYMEMOCOUNT];
+#endif
+#ifdef YY_CTX_MEMBERS
+  YY_CTX_MEMBERS
+#endif
+};
+
+#ifdef YY_CTX_LOCAL
+#define YY_CTX_PARAM_	yycontext *yyctx,
+#define YY_CTX_PARAM	yycontext *yyctx
+#define YY_CTX_ARG_	yyctx,
+#define YY_CTX_ARG	yyctx
+#else
+#define YY_CTX_PARAM_
+#define YY_CTX_PARAM
+#define YY_CTX_ARG_
+#define YY_CTX_ARG
+yycontext yyctx0;
+yycontext *yyctx= &yyctx0;
+#endif
+
+YY_LOCAL(int) yyrefill(yycontext *ctx)
+{
+#ifdef YY_BUFFER_INPUT
+  return 0;
+#else
+  int yyn;
+  while (ctx->buflen - ctx->pos < 512)
+    {
+      char *buf= (char *)YY_REALLOC(ctx, ctx->buf, ctx->buflen * 2);
+      if (!buf)
+	{
+	  ctx->nomem= 1;
+	  return 0;
+	}
+      ctx->buf= buf;
+      ctx->buflen *= 2;
+    }
+  YY_INPUT((ctx->buf + ctx->pos), yyn, (ctx->buflen - ctx->pos));
+  if (!yyn) return 0;
+  ctx->limit += yyn;
+  return 1;
+#endif
+}
+
+YY_LOCAL(int) yypeek(yycontext *ctx)
+{
+  if (ctx->pos >= ctx->limit && !yyrefill(ctx)) return -1;
+  return (unsigned char)ctx->buf[ctx->pos];
+}
+
+YY_LOCAL(int) yyfirst(int c, unsigned char *bits)
+{
+  return c >= 0 && (bits[c >> 3] & (1 << (c & 7)));
+}
+
+YY_LOCAL(int) yymatchDot(yycontext *ctx)
+{
+  if (ctx->pos >= ctx->limit && !yyrefill(ctx)) return 0;
+  ++ctx->pos;
+  return 1;
+}
+
+YY_LOCAL(int) yymatchChar(yycontext *ctx, int c)
+{
+  if (ctx->pos >= ctx->limit && !yyrefill(ctx)) return 0;
+  if ((unsigned char)ctx->buf[ctx->pos] == c)
+    {
+      ++ctx->pos;
+      yyprintf((stderr, "  ok   yymatchChar(ctx, %c) @ %s\n", c, ctx->buf+ctx->pos));
+      return 1;
+    }
+  yyprintf((stderr, "  fail yymatchChar(ctx, %c) @ %s\n", c, ctx->buf+ctx->pos));
+  return 0;
+}
+
+YY_LOCAL(int) yymatchString(yycontext *ctx, char *s)
+{
+  int yysav= ctx->pos;
+  while (*s)
+    {
+      if (ctx->pos >= ctx->limit && !yyrefill(ctx)) return 0;
+      if (ctx->buf[ctx->pos] != *s)
+        {
+          ctx->pos= yysav;
+          return 0;
+        }
+      ++s;
+      ++ctx->pos;
+    }
+  return 1;
+}
+
+YY_LOCAL(int) yymatchClass(yycontext *ctx, unsigned char *bits)
+{
+  int c;
+  if (ctx->pos >= ctx->limit && !yyrefill(ctx)) return 0;
+  c= (unsigned char)ctx->buf[ctx->pos];
+  if (bits[c >> 3] & (1 << (c & 7)))
+    {
+      ++ctx->pos;
+      yyprintf((stderr, "  ok   yymatchClass @ %s\n", ctx->buf+ctx->pos));
+      return 1;
+    }
+  yyprintf((stderr, "  fail yymatchClass @ %s\n", ctx->buf+ctx->pos));
+  return 0;
+}
+
+YY_LOCAL(void) yyDo(yycontext *ctx, yyaction action, int begin, int end)
+{
+  while (ctx->thunkpos >= ctx->thunkslen)
+    {
+      yythunk *thunks= (yythunk *)YY_REALLOC(ctx, ctx->thunks, sizeof(yythunk) * ctx->thunkslen * 2);
+      if (!thunks)
+	{
+	  ctx->nomem= 1;
+	  return;
+	}
+      ctx->thunks= thunks;
+      ctx->thunkslen *= 2;
+    }
+  ctx->thunks[ctx->thunkpos].begin=  begin;
+  ctx->thunks[ctx->thunkpos].end=    end;
+  ctx->thunks[ctx->thunkpos].action= action;
+  ++ctx->thunkpos;
+}
+
+#ifdef YY_BUFFER_TEXT
+#define YY_TEXT_LENGTH(C)	((C)->end > (C)->begin ? (C)->end - (C)->begin : 0)
+#define YY_TEXT_POINTER(C)	((C)->buf + (C)->begin)
+#else
+#define YY_TEXT_LENGTH(C)	yyText((C), (C)->begin, (C)->end)
+#define YY_TEXT_POINTER(C)	((C)->text)
+
+YY_LOCAL(int) yyText(yycontext *ctx, int begin, int end)
+{
+  int yyleng= end - begin;
+  if (yyleng <= 0)
+    yyleng= 0;
+  else
+    {
+      while (ctx->textlen < (yyleng + 1))
+	{
+	  char *text= (char *)YY_REALLOC(ctx, ctx->text, ctx->textlen * 2);
+	  if (!text)
+	    {
+	      ctx->nomem= 1;
+	      ctx->text[0]= '\0';
+	      return 0;
+	    }
+	  ctx->text= text;
+	  ctx->textlen *= 2;
+	}
+      memcpy(ctx->text, ctx->buf + begin, yyleng);
+    }
+  ctx->text[yyleng]= '\0';
+  return yyleng;
+}
+#endif
+
+YY_LOCAL(void) yyDoThunk(yycontext *ctx, yythunk *thunk, int pos)
+{
+#ifdef YY_BUFFER_TEXT
+  int yyleng= thunk->end ? (thunk->end > thunk->begin ? thunk->end - thunk->begin : 0) : thunk->begin;
+  char *yytext= ctx->buf + thunk->begin;
+#else
+  int yyleng= thunk->end ? yyText(ctx, thunk->begin, thunk->end) : thunk->begin;
+  char *yytext= ctx->text;
+#endif
+  int i;
+  if (!thunk->action)
+    {
+      for (i= 0;  i < thunk->begin && !ctx->nomem;  ++i)
+	yyDoThunk(ctx, thunk->next + i, i);
+      return;
+    }
+  yyprintf((stderr, "DO [%d] %p %.*s\n", pos, thunk->action, thunk->end ? yyleng : 0, yytext));
+  thunk->action(ctx, yytext, yyleng);
+}
+
+YY_LOCAL(void) yyDone(yycontext *ctx)
+{
+  int pos;
+  for (pos= 0;  pos < ctx->thunkpos && !ctx->nomem;  ++pos)
+    yyDoThunk(ctx, &ctx->thunks[pos], pos);
+  ctx->thunkpos= 0;
+}
+
+YY_LOCAL(void) yyCommit(yycontext *ctx)
+{
+#ifdef YY_BUFFER_INPUT
+  ctx->buf += ctx->pos;
+  ctx->limit -= ctx->pos;
+#else
+  if ((ctx->limit -= ctx->pos))
+    {
+      memmove(ctx->buf, ctx->buf + ctx->pos, ctx->limit);
+    }
+#endif
+  ctx->begin -= ctx->pos;
+  ctx->end -= ctx->pos;
+  ctx->pos= ctx->thunkpos= 0;
+#if YYMEMOCOUNT
+  ++ctx->memogen;
+  ctx->sharedbytes= 0;
+  ctx->mark= 0;
+  while (ctx->shared)
+    {
+      yyshared *next= ctx->shared->next;
+      ctx->shared->next= ctx->spare;
+      ctx->spare= ctx->shared;
+      ctx->shared= next;
+    }
+#endif
+}
+
+YY_LOCAL(int) yyAccept(yycontext *ctx, int tp0)
+{
+  if (tp0)
+    {
+      fprintf(stderr, "accept denied at %d\n", tp0);
+      return 0;
+    }
+  else
+    {
+      yyDone(ctx);
+      yyCommit(ctx);
+    }
+  return 1;
+}
+
+#if YYMEMOCOUNT
+
+YY_LOCAL(int) yyRecall(yycontext *ctx, int memo)
+{
+  yymemo *m= &ctx->memos[(ctx->pos * YYMEMOCOUNT + memo) & (ctx->memosize - 1)];
+  if (ctx->nomem)
+    return 0;		/* the parse is being abandoned */
+  if (m->gen != ctx->memogen || m->pos != ctx->pos || m->memo != memo)
+    {
+      if (YY_MEMO_DEPTH && ctx->memodepth >= YY_MEMO_DEPTH)
+	{
+	  ctx->nomem= 2;	/* nested too deeply for the stack */
+	  return 0;
+	}
+      ++ctx->memodepth;
+      ++ctx->memomisses[memo];
+      return -1;
+    }
+  while (ctx->thunkpos + m->thunkcount >= ctx->thunkslen)
+    {
+      yythunk *thunks= (yythunk *)YY_REALLOC(ctx, ctx->thunks, sizeof(yythunk) * ctx->thunkslen * 2);
+      if (!thunks)
+	{
+	  ctx->nomem= 1;
+	  return 0;
+	}
+      ctx->thunks= thunks;
+      ctx->thunkslen *= 2;
+    }
+  ++ctx->memohits[memo];
+  if (m->thunkcount)
+    memcpy(ctx->thunks + ctx->thunkpos, m->thunks, sizeof(yythunk) * m->thunkcount);
+  ctx->thunkpos += m->thunkcount;
+  ctx->pos= m->next;
+  if (m->marked & 1) ctx->begin= m->begin;
+  if (m->marked & 2) ctx->end= m->end;
+  ctx->marked |= m->marked;
+  yyprintf((stderr, "  memo %d @ %s\n", memo, ctx->buf+ctx->pos));
+  return m->ok;
+}
+
+/* Whether the memo table and the shared actions may take bytes more:
+ * they may take up to memolimit if the caller has set it, or else
+ * YY_MEMO_LIMIT.  While memokeep is set they take what they need, and
+ * yyKeepRoom holds the outcomes kept to the limit instead. */
+
+YY_LOCAL(int) yyMemoRoom(yycontext *ctx, long bytes)
+{
+  return ctx->memokeep || ctx->memobytes + ctx->sharedbytes + bytes <= (ctx->memolimit ? ctx->memolimit : YY_MEMO_LIMIT);
+}
+
+/* Whether an outcome at pos that scheduled count actions may be kept
+ * with the ones kept since yyparse() began, or since the last
+ * yyResume(): together they may need up to the limit, for a table with
+ * room for every memoized rule at each position they span, and the old
+ * half of it while it is doubled, for their actions and for those
+ * shared.  The count does not depend on the size of the table or on the
+ * outcomes recorded before, so whether a parse fits does not either. */
+
+YY_LOCAL(int) yyKeepRoom(yycontext *ctx, int pos, int count)
+{
+  int len= 4;
+  if (count > YY_MEMO_SHARE)
+    {
+      ctx->keptbytes += sizeof(yythunk) * count;
+      count= 1;
+    }
+  while (len < count) len *= 2;
+  if (count)
+    ctx->keptbytes += sizeof(yythunk) * len;
+  if (ctx->keptfrom < 0 || pos < ctx->keptfrom) ctx->keptfrom= pos;
+  if (ctx->keptto < pos) ctx->keptto= pos;
+  return ctx->keptbytes + 3L * sizeof(yymemo) * YYMEMOCOUNT * (ctx->keptto - ctx->keptfrom + 1)
+    <= (ctx->memolimit ? ctx->memolimit : YY_MEMO_LIMIT);
+}
+
+/* Thunks of a long result are moved to storage that lasts until the
+ * next commit, and replaced by one thunk that runs them.  Results that
+ * contain it, and every recall of it, then copy only that thunk. */
+
+YY_LOCAL(void) yyShare(yycontext *ctx, int thunkpos)
+{
+  int count= ctx->thunkpos - thunkpos;
+  yyshared *s= ctx->shared, **spare= &ctx->spare;
+  if (!s || s->used + count > s->size)
+    {
+      while ((s= *spare) && s->size < count)
+	spare= &s->next;
+      if (!yyMemoRoom(ctx, sizeof(yythunk) * (s ? s->size : count > 4096 ? count : 4096)))
+	return;		/* the thunks stay where they are */
+      if (s)
+	*spare= s->next;
+      else
+	{
+	  int size= count > 4096 ? count : 4096;
+	  yythunk *thunks= (yythunk *)YY_MALLOC(ctx, sizeof(yythunk) * size);
+	  if (!thunks || !(s= (yyshared *)YY_MALLOC(ctx, sizeof(yyshared))))
+	    {
+	      YY_FREE(ctx, thunks);
+	      return;	/* the thunks stay where they are */
+	    }
+	  s->size= size;
+	  s->thunks= thunks;
+	}
+      s->used= 0;
+      s->next= ctx->shared;
+      ctx->sharedbytes += sizeof(yythunk) * s->size;
+      ctx->shared= s;
+    }
+  memcpy(s->thunks + s->used, ctx->thunks + thunkpos, sizeof(yythunk) * count);
+  ctx->thunks[thunkpos].begin=  count;
+  ctx->thunks[thunkpos].end=    0;
+  ctx->thunks[thunkpos].action= 0;
+  ctx->thunks[thunkpos].next=   s->thunks + s->used;
+  ctx->thunkpos= thunkpos + 1;
+  s->used += count;
+}
+
+/* A result that would replace one recorded further on means that the
+ * parse has backtracked across more text than the table covers, and
+ * will want the results it is losing again.  The table is doubled
+ * instead, for as long as it fits within the limit with the old table,
+ * which is freed only once its results are copied.  While memokeep is
+ * set no result of the parse is replaced: the table is doubled until
+ * the new one has a place of its own. */
+
+YY_LOCAL(int) yyMemoGrow(yycontext *ctx)
+{
+  int size= ctx->memosize, i;
+  yymemo *memos;
+  if (!yyMemoRoom(ctx, sizeof(yymemo) * size * 2)
+      || !(memos= (yymemo *)YY_MALLOC(ctx, sizeof(yymemo) * size * 2)))
+    return 0;
+  for (i= 0;  i < size;  ++i)
+    {
+      yymemo *m= &ctx->memos[i];
+      int high= (m->pos * YYMEMOCOUNT + m->memo) & size;
+      memos[i | high]= *m;
+      memset(&memos[i | (size & ~high)], 0, sizeof(yymemo));
+    }
+  YY_FREE(ctx, ctx->memos);
+  ctx->memos= memos;
+  ctx->memosize= size * 2;
+  ctx->memobytes += sizeof(yymemo) * size;
+  return 1;
+}
+
+YY_LOCAL(int) yyMemo(yycontext *ctx, int memo, int pos, int thunkpos, int marked, int ok)
+{
+  yymemo *m= &ctx->memos[(pos * YYMEMOCOUNT + memo) & (ctx->memosize - 1)];
+  int count;
+  --ctx->memodepth;
+  if (ctx->memokeep && !yyKeepRoom(ctx, pos, ctx->thunkpos - thunkpos))
+    {
+      ctx->nomem= 1;
+      ctx->marked |= marked;
+      return ok;
+    }
+  if (m->gen == ctx->memogen && m->pos > pos)
+    {
+      yyMemoGrow(ctx);
+      m= &ctx->memos[(pos * YYMEMOCOUNT + memo) & (ctx->memosize - 1)];
+    }
+  while (ctx->memokeep && m->gen == ctx->memogen)
+    {
+      if (!yyMemoGrow(ctx))
+	{
+	  ctx->nomem= 1;
+	  ctx->marked |= marked;
+	  return ok;
+	}
+      m= &ctx->memos[(pos * YYMEMOCOUNT + memo) & (ctx->memosize - 1)];
+    }
+  if (ctx->thunkpos - thunkpos > YY_MEMO_SHARE)
+    yyShare(ctx, thunkpos);
+  count= ctx->thunkpos - thunkpos;
+  m->gen= ctx->memogen - 1;
+  if (m->thunkslen < count)
+    {
+      int len= m->thunkslen ? m->thunkslen : 4;
+      yythunk *thunks;
+      while (len < count) len *= 2;
+      if (!yyMemoRoom(ctx, sizeof(yythunk) * (len - m->thunkslen)))
+	thunks= 0;
+      else
+	thunks= (yythunk *)YY_REALLOC(ctx, m->thunks, sizeof(yythunk) * len);
+      if (!thunks)
+	{
+	  if (ctx->memokeep)
+	    ctx->nomem= 1;
+	  ctx->marked |= marked;
+	  return ok;		/* not recorded */
+	}
+      ctx->memobytes += sizeof(yythunk) * (len - m->thunkslen);
+      m->thunks= thunks;
+      m->thunkslen= len;
+    }
+  if (count)
+    memcpy(m->thunks, ctx->thunks + thunkpos, sizeof(yythunk) * count);
+  m->thunkcount= count;
+  m->memo= memo;
+  m->pos= pos;
+  m->gen= ctx->memogen;
+  m->ok= ok;
+  m->next= ctx->pos;
+  m->marked= ctx->marked;
+  m->begin= ctx->begin;
+  m->end= ctx->end;
+  ctx->marked |= marked;
+  return ok;
+}
+
+/* A parse abandoned for want of memory (nomem is 1) or of stack (nomem
+ * is 2) can be resumed by the grammar, to try the input that ran out
+ * another way: yyMark records where the attempt begins, and yyResume,
+ * once it has failed, forgets every outcome recorded and takes back the
+ * actions kept since the mark. */
+
+YY_LOCAL(void) yyMark(yycontext *ctx)
+{
+  ctx->mark= ctx->shared;
+}
+
+YY_LOCAL(int) yyResume(yycontext *ctx)
+{
+  if (!ctx->nomem)
+    return 0;
+  ++ctx->memogen;
+  while (ctx->shared && ctx->shared != ctx->mark)
+    {
+      yyshared *next= ctx->shared->next;
+      ctx->sharedbytes -= sizeof(yythunk) * ctx->shared->size;
+      ctx->shared->next= ctx->spare;
+      ctx->spare= ctx->shared;
+      ctx->shared= next;
+    }
+  ctx->keptbytes= 0;
+  ctx->keptfrom= ctx->keptto= -1;
+  ctx->nomem= 0;
+  return 1;
+}
+
+#endif
+
+YY_LOCAL(void) yyPush(yycontext *ctx, char *text, int count)
+{
+  long offset= ctx->val - ctx->vals + count;
+  while (ctx->valslen <= offset)
+    {
+      YYSTYPE *vals= (YYSTYPE *)YY_REALLOC(ctx, ctx->vals, sizeof(YYSTYPE) * ctx->valslen * 2);
+      if (!vals)
+	{
+	  ctx->nomem= 1;
+	  return;
+	}
+      ctx->vals= vals;
+      ctx->valslen *= 2;
+    }
+  ctx->val= ctx->vals + offset;
+}
+YY_LOCAL(void) yyPop(yycontext *ctx, char *text, int count)   { ctx->val -= count; }
+YY_LOCAL(void) yySet(yycontext *ctx, char *text, int count)   { ctx->val[count]= ctx->yy; }
+
+#endif /* YY_PART */
+
+#define	YYACCEPT	yyAccept(ctx, yythunkpos0)
+
+YY_RULE(int) yy_CLOSE(yycontext *ctx); /* 16 */
+YY_RULE(int) yy_OPEN(yycontext *ctx); /* 15 */
+YY_RULE(int) yy_NUMBER(yycontext *ctx); /* 14 */
+YY_RULE(int) yy_DIVIDE(yycontext *ctx); /* 13 */
+YY_RULE(int) yy_TIMES(yycontext *ctx); /* 12 */
+YY_RULE(int) yy_Value(yycontext *ctx); /* 11 */
+YY_RULE(int) yy_MINUS(yycontext *ctx); /* 10 */
+YY_RULE(int) yy_PLUS(yycontext *ctx); /* 9 */
+YY_RULE(int) yy_Product(yycontext *ctx); /* 8 */
+YY_RULE(int) yy_Sum(yycontext *ctx); /* 7 */
+YY_RULE(int) yy_ASSIGN(yycontext *ctx); /* 6 */
+YY_RULE(int) yy_ID(yycontext *ctx); /* 5 */
+YY_RULE(int) yy_EOL(yycontext *ctx); /* 4 */
+YY_RULE(int) yy_Expr(yycontext *ctx); /* 3 */
+YY_RULE(int) yy__(yycontext *ctx); /* 2 */
+YY_RULE(int) yy_Stmt(yycontext *ctx); /* 1 */
+
+YY_ACTION(void) yy_1_ID(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_ID\n"));
+   yy= yytext[0] - 'a'; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_1_NUMBER(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_NUMBER\n"));
+   yy= atoi(yytext); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
+YY_ACTION(void) yy_3_Value(yycontext *ctx, char *yytext, int yyleng)
+{
+#define i ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_3_Value\n"));
+   yy= i; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef i
+}
+YY_ACTION(void) yy_2_Value(yycontext *ctx, char *yytext, int yyleng)
+{
+#define i ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_Value\n"));
+   yy= vars[i]; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef i
+}
+YY_ACTION(void) yy_1_Value(yycontext *ctx, char *yytext, int yyleng)
+{
+#define i ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_Value\n"));
+   yy= atoi(yytext); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef i
+}
+YY_ACTION(void) yy_3_Product(yycontext *ctx, char *yytext, int yyleng)
+{
+#define r ctx->val[-1]
+#define l ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_3_Product\n"));
+   yy= l; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef r
+#undef l
+}
+YY_ACTION(void) yy_2_Product(yycontext *ctx, char *yytext, int yyleng)
+{
+#define r ctx->val[-1]
+#define l ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_Product\n"));
+   l /= r; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef r
+#undef l
+}
+YY_ACTION(void) yy_1_Product(yycontext *ctx, char *yytext, int yyleng)
+{
+#define r ctx->val[-1]
+#define l ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_Product\n"));
+   l *= r; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef r
+#undef l
+}
+YY_ACTION(void) yy_3_Sum(yycontext *ctx, char *yytext, int yyleng)
+{
+#define r ctx->val[-1]
+#define l ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_3_Sum\n"));
+   yy= l; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef r
+#undef l
+}
+YY_ACTION(void) yy_2_Sum(yycontext *ctx, char *yytext, int yyleng)
+{
+#define r ctx->val[-1]
+#define l ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_Sum\n"));
+   l -= r; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef r
+#undef l
+}
+YY_ACTION(void) yy_1_Sum(yycontext *ctx, char *yytext, int yyleng)
+{
+#define r ctx->val[-1]
+#define l ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_Sum\n"));
+   l += r; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef r
+#undef l
+}
+YY_ACTION(void) yy_2_Expr(yycontext *ctx, char *yytext, int yyleng)
+{
+#define s ctx->val[-1]
+#define i ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_Expr\n"));
+   yy= s; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef s
+#undef i
+}
+YY_ACTION(void) yy_1_Expr(yycontext *ctx, char *yytext, int yyleng)
+{
+#define s ctx->val[-1]
+#define i ctx->val[-2]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_Expr\n"));
+   yy= vars[i]= s; ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef s
+#undef i
+}
+YY_ACTION(void) yy_2_Stmt(yycontext *ctx, char *yytext, int yyleng)
+{
+#define e ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_2_Stmt\n"));
+   printf("error\n"); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef e
+}
+YY_ACTION(void) yy_1_Stmt(yycontext *ctx, char *yytext, int yyleng)
+{
+#define e ctx->val[-1]
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_Stmt\n"));
+   printf("%d\n", e); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+#undef e
+}
+
+YY_RULE(int) yy_CLOSE(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "CLOSE"));  if (!yymatchChar(ctx, ')')) goto l1;  if (!yy__(ctx)) goto l1;
+  yyprintf((stderr, "  ok   %s @ %s\n", "CLOSE", ctx->buf+ctx->pos));
+  return 1;
+  l1:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CLOSE", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_OPEN(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "OPEN"));  if (!yymatchChar(ctx, '(')) goto l2;  if (!yy__(ctx)) goto l2;
+  yyprintf((stderr, "  ok   %s @ %s\n", "OPEN", ctx->buf+ctx->pos));
+  return 1;
+  l2:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OPEN", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_NUMBER(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "NUMBER"));  if (!(YY_BEGIN)) goto l3;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l3;
+  l4:;	
+  {  int yypos5= ctx->pos, yythunkpos5= ctx->thunkpos;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l5;  goto l4;
+  l5:;	  ctx->pos= yypos5; ctx->thunkpos= yythunkpos5;
+  }  if (!(YY_END)) goto l3;  if (!yy__(ctx)) goto l3;  yyDo(ctx, yy_1_NUMBER, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "NUMBER", ctx->buf+ctx->pos));
+  return 1;
+  l3:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "NUMBER", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_DIVIDE(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "DIVIDE"));  if (!yymatchChar(ctx, '/')) goto l6;  if (!yy__(ctx)) goto l6;
+  yyprintf((stderr, "  ok   %s @ %s\n", "DIVIDE", ctx->buf+ctx->pos));
+  return 1;
+  l6:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DIVIDE", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_TIMES(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "TIMES"));  if (!yymatchChar(ctx, '*')) goto l7;  if (!yy__(ctx)) goto l7;
+  yyprintf((stderr, "  ok   %s @ %s\n", "TIMES", ctx->buf+ctx->pos));
+  return 1;
+  l7:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TIMES", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Value(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Value"));
+  {  int yypos12= ctx->pos, yythunkpos12= ctx->thunkpos;  int yyc13= yypeek(ctx);
+  switch (yyc13)
+    {
+     case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+     case 56: case 57:  goto l9;
+     case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104:
+     case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112:
+     case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120:
+     case 121: case 122:  goto l10;
+     case 40:  goto l11;
+    default:  goto l8;
+    }
+  l9:;	  if (!yy_NUMBER(ctx)) goto l14;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_1_Value, ctx->begin, ctx->end);  goto l12;
+  l14:;	  ctx->pos= yypos12; ctx->thunkpos= yythunkpos12;
+  l10:;	  if (!yyfirst(yyc13, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l11;  if (!yy_ID(ctx)) goto l15;  yyDo(ctx, yySet, -1, 0);
+  {  int yypos16= ctx->pos, yythunkpos16= ctx->thunkpos;  if (!yy_ASSIGN(ctx)) goto l16;  goto l15;
+  l16:;	  ctx->pos= yypos16; ctx->thunkpos= yythunkpos16;
+  }  yyDo(ctx, yy_2_Value, ctx->begin, ctx->end);  goto l12;
+  l15:;	  ctx->pos= yypos12; ctx->thunkpos= yythunkpos12;
+  l11:;	  if (!yyfirst(yyc13, (unsigned char *)"\000\000\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l8;  if (!yy_OPEN(ctx)) goto l8;  if (!yy_Expr(ctx)) goto l8;  yyDo(ctx, yySet, -1, 0);  if (!yy_CLOSE(ctx)) goto l8;  yyDo(ctx, yy_3_Value, ctx->begin, ctx->end);
+  }
+  l12:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Value", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 1, 0);
+  return 1;
+  l8:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Value", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_MINUS(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "MINUS"));  if (!yymatchChar(ctx, '-')) goto l17;  if (!yy__(ctx)) goto l17;
+  yyprintf((stderr, "  ok   %s @ %s\n", "MINUS", ctx->buf+ctx->pos));
+  return 1;
+  l17:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "MINUS", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_PLUS(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "PLUS"));  if (!yymatchChar(ctx, '+')) goto l18;  if (!yy__(ctx)) goto l18;
+  yyprintf((stderr, "  ok   %s @ %s\n", "PLUS", ctx->buf+ctx->pos));
+  return 1;
+  l18:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "PLUS", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Product(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "Product"));  if (!yy_Value(ctx)) goto l19;  yyDo(ctx, yySet, -2, 0);
+  l20:;	
+  {  int yypos21= ctx->pos, yythunkpos21= ctx->thunkpos;
+  {  int yypos24= ctx->pos, yythunkpos24= ctx->thunkpos;  int yyc25= yypeek(ctx);
+  switch (yyc25)
+    {
+     case 42:  goto l22;
+     case 47:  goto l23;
+    default:  goto l21;
+    }
+  l22:;	  if (!yy_TIMES(ctx)) goto l26;  if (!yy_Value(ctx)) goto l26;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_1_Product, ctx->begin, ctx->end);  goto l24;
+  l26:;	  ctx->pos= yypos24; ctx->thunkpos= yythunkpos24;
+  l23:;	  if (!yyfirst(yyc25, (unsigned char *)"\000\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l21;  if (!yy_DIVIDE(ctx)) goto l21;  if (!yy_Value(ctx)) goto l21;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_2_Product, ctx->begin, ctx->end);
+  }
+  l24:;	  goto l20;
+  l21:;	  ctx->pos= yypos21; ctx->thunkpos= yythunkpos21;
+  }  yyDo(ctx, yy_3_Product, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Product", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 2, 0);
+  return 1;
+  l19:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Product", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Sum(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "Sum"));  if (!yy_Product(ctx)) goto l27;  yyDo(ctx, yySet, -2, 0);
+  l28:;	
+  {  int yypos29= ctx->pos, yythunkpos29= ctx->thunkpos;
+  {  int yypos32= ctx->pos, yythunkpos32= ctx->thunkpos;  int yyc33= yypeek(ctx);
+  switch (yyc33)
+    {
+     case 43:  goto l30;
+     case 45:  goto l31;
+    default:  goto l29;
+    }
+  l30:;	  if (!yy_PLUS(ctx)) goto l34;  if (!yy_Product(ctx)) goto l34;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_1_Sum, ctx->begin, ctx->end);  goto l32;
+  l34:;	  ctx->pos= yypos32; ctx->thunkpos= yythunkpos32;
+  l31:;	  if (!yyfirst(yyc33, (unsigned char *)"\000\000\000\000\000\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l29;  if (!yy_MINUS(ctx)) goto l29;  if (!yy_Product(ctx)) goto l29;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_2_Sum, ctx->begin, ctx->end);
+  }
+  l32:;	  goto l28;
+  l29:;	  ctx->pos= yypos29; ctx->thunkpos= yythunkpos29;
+  }  yyDo(ctx, yy_3_Sum, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Sum", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 2, 0);
+  return 1;
+  l27:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Sum", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_ASSIGN(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "ASSIGN"));  if (!yymatchChar(ctx, '=')) goto l35;  if (!yy__(ctx)) goto l35;
+  yyprintf((stderr, "  ok   %s @ %s\n", "ASSIGN", ctx->buf+ctx->pos));
+  return 1;
+  l35:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ASSIGN", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_ID(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "ID"));  if (!(YY_BEGIN)) goto l36;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l36;  if (!(YY_END)) goto l36;  if (!yy__(ctx)) goto l36;  yyDo(ctx, yy_1_ID, ctx->begin, ctx->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ID", ctx->buf+ctx->pos));
+  return 1;
+  l36:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ID", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_EOL(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "EOL"));
+  {  int yypos41= ctx->pos, yythunkpos41= ctx->thunkpos;  int yyc42= yypeek(ctx);
+  switch (yyc42)
+    {
+     case 10:  goto l38;
+     case 13:  goto l39;
+     case 59:  goto l40;
+    default:  goto l37;
+    }
+  l38:;	  if (!yymatchChar(ctx, '\n')) goto l43;  goto l41;
+  l43:;	  ctx->pos= yypos41; ctx->thunkpos= yythunkpos41;
+  l39:;	  if (!yyfirst(yyc42, (unsigned char *)"\000\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l40;  if (!yymatchString(ctx, "\r\n")) goto l44;  goto l41;
+  l44:;	  ctx->pos= yypos41; ctx->thunkpos= yythunkpos41;
+  l40:;	  if (!yyfirst(yyc42, (unsigned char *)"\000\040\000\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l37;  if (!yymatchClass(ctx, (unsigned char *)"\000\040\000\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l37;
+  }
+  l41:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "EOL", ctx->buf+ctx->pos));
+  return 1;
+  l37:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EOL", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy_Expr(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "Expr"));
+  {  int yypos48= ctx->pos, yythunkpos48= ctx->thunkpos;  int yyc49= yypeek(ctx);
+  switch (yyc49)
+    {
+     case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104:
+     case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112:
+     case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120:
+     case 121: case 122:  goto l46;
+     case 40: case 48: case 49: case 50: case 51: case 52: case 53: case 54:
+     case 55: case 56: case 57:  goto l47;
+    default:  goto l45;
+    }
+  l46:;	  if (!yy_ID(ctx)) goto l50;  yyDo(ctx, yySet, -2, 0);  if (!yy_ASSIGN(ctx)) goto l50;  if (!yy_Sum(ctx)) goto l50;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_1_Expr, ctx->begin, ctx->end);  goto l48;
+  l50:;	  ctx->pos= yypos48; ctx->thunkpos= yythunkpos48;
+  l47:;	  if (!yyfirst(yyc49, (unsigned char *)"\000\000\000\000\000\001\377\003\000\000\000\000\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l45;  if (!yy_Sum(ctx)) goto l45;  yyDo(ctx, yySet, -1, 0);  yyDo(ctx, yy_2_Expr, ctx->begin, ctx->end);
+  }
+  l48:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Expr", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 2, 0);
+  return 1;
+  l45:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Expr", ctx->buf+ctx->pos));
+  return 0;
+}
+YY_RULE(int) yy__(yycontext *ctx)
+{
+  yyprintf((stderr, "%s\n", "_"));
+  l52:;	
+  {  int yypos53= ctx->pos, yythunkpos53= ctx->thunkpos;  if (!yymatchClass(ctx, (unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l53;  goto l52;
+  l53:;	  ctx->pos= yypos53; ctx->thunkpos= yythunkpos53;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "_", ctx->buf+ctx->pos));
+  return 1;
+}
+YY_RULE(int) yy_Stmt(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;  yyDo(ctx, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Stmt"));
+  {  int yypos57= ctx->pos, yythunkpos57= ctx->thunkpos;  int yyc58= yypeek(ctx);
+  switch (yyc58)
+    {
+     case 9: case 32: case 40: case 48: case 49: case 50: case 51: case 52:
+     case 53: case 54: case 55: case 56: case 57: case 97: case 98: case 99:
+     case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107:
+     case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115:
+     case 116: case 117: case 118: case 119: case 120: case 121: case 122:  goto l55;
+    default:  goto l56;
+    }
+  l55:;	  if (!yy__(ctx)) goto l59;  if (!yy_Expr(ctx)) goto l59;  yyDo(ctx, yySet, -1, 0);  if (!yy_EOL(ctx)) goto l59;  yyDo(ctx, yy_1_Stmt, ctx->begin, ctx->end);  goto l57;
+  l59:;	  ctx->pos= yypos57; ctx->thunkpos= yythunkpos57;
+  l56:;	
+  l60:;	
+  {  int yypos61= ctx->pos, yythunkpos61= ctx->thunkpos;
+  {  int yypos62= ctx->pos, yythunkpos62= ctx->thunkpos;  if (!yy_EOL(ctx)) goto l62;  goto l61;
+  l62:;	  ctx->pos= yypos62; ctx->thunkpos= yythunkpos62;
+  }  if (!yymatchDot(ctx)) goto l61;  goto l60;
+  l61:;	  ctx->pos= yypos61; ctx->thunkpos= yythunkpos61;
+  }  if (!yy_EOL(ctx)) goto l54;  yyDo(ctx, yy_2_Stmt, ctx->begin, ctx->end);
+  }
+  l57:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Stmt", ctx->buf+ctx->pos));  yyDo(ctx, yyPop, 1, 0);
+  return 1;
+  l54:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Stmt", ctx->buf+ctx->pos));
+  return 0;
+}
+
+#ifndef YY_PART
+
+typedef int (*yyrule)(yycontext *ctx);
+
+YY_PARSE(int) YYPARSEFROM(YY_CTX_PARAM_ yyrule yystart)
+{
+  int yyok;
+  if (!yyctx->textlen)
+    {
+#ifndef YY_BUFFER_INPUT
+      yyctx->buf= (char *)YY_MALLOC(yyctx, 1024);
+      yyctx->pos= yyctx->limit= 0;
+#endif
+      yyctx->text= (char *)YY_MALLOC(yyctx, 1024);
+      yyctx->thunks= (yythunk *)YY_MALLOC(yyctx, sizeof(yythunk) * 32);
+      yyctx->vals= (YYSTYPE *)YY_MALLOC(yyctx, sizeof(YYSTYPE) * 32);
+#if YYMEMOCOUNT
+      yyctx->memos= (yymemo *)YY_MALLOC(yyctx, sizeof(yymemo) * YY_MEMO_SIZE);
+      yyctx->shared= yyctx->spare= yyctx->mark= 0;
+#endif
+      if (!yyctx->text || !yyctx->thunks || !yyctx->vals
+#ifndef YY_BUFFER_INPUT
+	  || !yyctx->buf
+#endif
+#if YYMEMOCOUNT
+	  || !yyctx->memos
+#endif
+	  )
+	{
+#ifndef YY_BUFFER_INPUT
+	  YY_FREE(yyctx, yyctx->buf);
+#endif
+	  YY_FREE(yyctx, yyctx->text);
+	  YY_FREE(yyctx, yyctx->thunks);
+	  YY_FREE(yyctx, yyctx->vals);
+#if YYMEMOCOUNT
+	  YY_FREE(yyctx, yyctx->memos);
+#endif
+	  return 0;
+	}
+#ifndef YY_BUFFER_INPUT
+      yyctx->buflen= 1024;
+#endif
+#if YYMEMOCOUNT
+      memset(yyctx->memos, 0, sizeof(yymemo) * YY_MEMO_SIZE);
+      yyctx->memosize= YY_MEMO_SIZE;
+      yyctx->memobytes= sizeof(yymemo) * YY_MEMO_SIZE;
+      yyctx->sharedbytes= 0;
+#endif
+      yyctx->textlen= 1024;
+      yyctx->thunkslen= 32;
+      yyctx->valslen= 32;
+      yyctx->begin= yyctx->end= yyctx->thunkpos= 0;
+    }
+#if YYMEMOCOUNT
+  ++yyctx->memogen;
+  yyctx->marked= 0;
+  yyctx->memokeep= 0;
+  yyctx->keptbytes= 0;
+  yyctx->keptfrom= yyctx->keptto= -1;
+  yyctx->memodepth= 0;
+#endif
+  yyctx->nomem= 0;
+  yyctx->begin= yyctx->end= yyctx->pos;
+  yyctx->thunkpos= 0;
+  yyctx->val= yyctx->vals;
+  yyok= yystart(yyctx);
+  if (yyok && !yyctx->nomem) yyDone(yyctx);
+  yyCommit(yyctx);
+  return yyok && !yyctx->nomem;
+}
+
+YY_PARSE(int) YYPARSE(YY_CTX_PARAM)
+{
+  return YYPARSEFROM(YY_CTX_ARG_ yy_Stmt);
+}
+
+#ifdef YY_BUFFER_INPUT
+YY_PARSE(void) YYSETBUFFER(YY_CTX_PARAM_ char *yybuffer, int yylength)
+{
+  yyctx->buf= yybuffer;
+  yyctx->limit= yylength;
+  yyctx->begin= yyctx->end= yyctx->pos= yyctx->thunkpos= 0;
+}
+#endif
+
+YY_PARSE(void) YYRELEASE(YY_CTX_PARAM)
+{
+  if (yyctx->buflen)
+    {
+      yyctx->buflen= 0;
+      YY_FREE(yyctx, yyctx->buf);
+    }
+  if (yyctx->textlen)
+    {
+      yyctx->textlen= 0;
+      YY_FREE(yyctx, yyctx->text);
+      YY_FREE(yyctx, yyctx->thunks);
+      YY_FREE(yyctx, yyctx->vals);
+#if YYMEMOCOUNT
+      {
+	yyshared *s, *next;
+	int i;
+	for (i= 0;  i < yyctx->memosize;  ++i)
+	  YY_FREE(yyctx, yyctx->memos[i].thunks);
+	YY_FREE(yyctx, yyctx->memos);
+	for (s= yyctx->shared;  s;  s= next)
+	  {
+	    next= s->next;
+	    YY_FREE(yyctx, s->thunks);
+	    YY_FREE(yyctx, s);
+	  }
+	for (s= yyctx->spare;  s;  s= next)
+	  {
+	    next= s->next;
+	    YY_FREE(yyctx, s->thunks);
+	    YY_FREE(yyctx, s);
+	  }
+	yyctx->shared= yyctx->spare= yyctx->mark= 0;
+      }
+#endif
+    }
+}
+
+#endif
+
+
+int main()
+{
+  while (yyparse());
+
+  return 0;
+}
+
@@ -3,7 +3,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#define YYRULECOUNT 36
+#define YYRULECOUNT 38
+#define YYMEMOCOUNT 0
 
 # include "tree.h"
 # include "version.h"
@@ -64,6 +65,15 @@
 #ifndef YYPARSEFROM
 #define YYPARSEFROM	yyparsefrom
 #endif
+#ifndef YYSETBUFFER
+#define YYSETBUFFER	yysetbuffer
+#endif
+#ifndef YYMEMOREPORT
+#define YYMEMOREPORT	yymemoreport
+#endif
+#ifndef YYRELEASE
+#define YYRELEASE	yyrelease
+#endif
 #ifndef YY_INPUT
 #define YY_INPUT(buf, result, max_size)			\
   {							\
@@ -72,6 +82,15 @@
     yyprintf((stderr, "<%c>", yyc));			\
   }
 #endif
+#ifndef YY_MALLOC
+#define YY_MALLOC(C, N)		malloc(N)
+#endif
+#ifndef YY_REALLOC
+#define YY_REALLOC(C, P, N)	realloc(P, N)
+#endif
+#ifndef YY_FREE
+#define YY_FREE(C, P)		free(P)
+#endif
 #ifndef YY_BEGIN
 #define YY_BEGIN	( ctx->begin= ctx->pos, 1)
 #endif
@@ -93,6 +112,23 @@ typedef struct _yycontext yycontext;
 typedef void (*yyaction)(yycontext *ctx, char *yytext, int yyleng);
 typedef struct _yythunk { int begin, end;  yyaction  action;  struct _yythunk *next; } yythunk;
 
+#if YYMEMOCOUNT
+#ifndef YY_MEMO_SIZE
+#define YY_MEMO_SIZE	16384
+#endif
+#ifndef YY_MEMO_SHARE
+#define YY_MEMO_SHARE	16
+#endif
+#ifndef YY_MEMO_LIMIT
+#define YY_MEMO_LIMIT	(256L << 20)
+#endif
+#ifndef YY_MEMO_DEPTH
+#define YY_MEMO_DEPTH	0
+#endif
+typedef struct _yymemo { int memo, pos, gen, ok, next, marked, begin, end;  yythunk *thunks;  int thunkslen, thunkcount; } yymemo;
+typedef struct _yyshared { struct _yyshared *next;  int size, used;  yythunk *thunks; } yyshared;
+#endif
+
 struct _yycontext {
   char     *buf;
   int       buflen;
@@ -110,6 +146,26 @@ struct _yycontext {
   YYSTYPE  *val;
   YYSTYPE  *vals;
   int       valslen;
+  int       nomem;
+#if YYMEMOCOUNT
+  yymemo   *memos;
+  int       memosize;
+  long      memobytes;
+  long      sharedbytes;
+  long      memolimit;
+  int       memokeep;
+  long      keptbytes;
+  int       keptfrom;
+  int       keptto;
+  int       memodepth;
+  int       memogen;
+  int       marked;
+  yyshared *shared;
+  yyshared *spare;
+  yyshared *mark;
+  long      memohits[YYMEMOCOUNT];
+  long      memomisses[YYMEMOCOUNT];
+#endif
 #ifdef YY_CTX_MEMBERS
   YY_CTX_MEMBERS
 #endif
@@ -131,16 +187,37 @@ yycontext *yyctx= &yyctx0;
 
 YY_LOCAL(int) yyrefill(yycontext *ctx)
 {
+#ifdef YY_BUFFER_INPUT
+  return 0;
+#else
   int yyn;
   while (ctx->buflen - ctx->pos < 512)
     {
+      char *buf= (char *)YY_REALLOC(ctx, ctx->buf, ctx->buflen * 2);
+      if (!buf)
+	{
+	  ctx->nomem= 1;
+	  return 0;
+	}
+      ctx->buf= buf;
       ctx->buflen *= 2;
-      ctx->buf= (char *)realloc(ctx->buf, ctx->buflen);
     }
   YY_INPUT((ctx->buf + ctx->pos), yyn, (ctx->buflen - ctx->pos));
   if (!yyn) return 0;
   ctx->limit += yyn;
   return 1;
+#endif
+}
+
+YY_LOCAL(int) yypeek(yycontext *ctx)
+{
+  if (ctx->pos >= ctx->limit && !yyrefill(ctx)) return -1;
+  return (unsigned char)ctx->buf[ctx->pos];
+}
+
+YY_LOCAL(int) yyfirst(int c, unsigned char *bits)
+{
+  return c >= 0 && (bits[c >> 3] & (1 << (c & 7)));
 }
 
 YY_LOCAL(int) yymatchDot(yycontext *ctx)
@@ -199,8 +276,14 @@ YY_LOCAL(void) yyDo(yycontext *ctx, yyaction action, int begin, int end)
 {
   while (ctx->thunkpos >= ctx->thunkslen)
     {
+      yythunk *thunks= (yythunk *)YY_REALLOC(ctx, ctx->thunks, sizeof(yythunk) * ctx->thunkslen * 2);
+      if (!thunks)
+	{
+	  ctx->nomem= 1;
+	  return;
+	}
+      ctx->thunks= thunks;
       ctx->thunkslen *= 2;
-      ctx->thunks= (yythunk *)realloc(ctx->thunks, sizeof(yythunk) * ctx->thunkslen);
     }
   ctx->thunks[ctx->thunkpos].begin=  begin;
   ctx->thunks[ctx->thunkpos].end=    end;
@@ -208,6 +291,13 @@ YY_LOCAL(void) yyDo(yycontext *ctx, yyaction action, int begin, int end)
   ++ctx->thunkpos;
 }
 
+#ifdef YY_BUFFER_TEXT
+#define YY_TEXT_LENGTH(C)	((C)->end > (C)->begin ? (C)->end - (C)->begin : 0)
+#define YY_TEXT_POINTER(C)	((C)->buf + (C)->begin)
+#else
+#define YY_TEXT_LENGTH(C)	yyText((C), (C)->begin, (C)->end)
+#define YY_TEXT_POINTER(C)	((C)->text)
+
 YY_LOCAL(int) yyText(yycontext *ctx, int begin, int end)
 {
   int yyleng= end - begin;
@@ -217,37 +307,77 @@ YY_LOCAL(int) yyText(yycontext *ctx, int begin, int end)
     {
       while (ctx->textlen < (yyleng + 1))
 	{
+	  char *text= (char *)YY_REALLOC(ctx, ctx->text, ctx->textlen * 2);
+	  if (!text)
+	    {
+	      ctx->nomem= 1;
+	      ctx->text[0]= '\0';
+	      return 0;
+	    }
+	  ctx->text= text;
 	  ctx->textlen *= 2;
-	  ctx->text= (char *)realloc(ctx->text, ctx->textlen);
 	}
       memcpy(ctx->text, ctx->buf + begin, yyleng);
     }
   ctx->text[yyleng]= '\0';
   return yyleng;
 }
+#endif
 
-YY_LOCAL(void) yyDone(yycontext *ctx)
+YY_LOCAL(void) yyDoThunk(yycontext *ctx, yythunk *thunk, int pos)
 {
-  int pos;
-  for (pos= 0;  pos < ctx->thunkpos;  ++pos)
+#ifdef YY_BUFFER_TEXT
+  int yyleng= thunk->end ? (thunk->end > thunk->begin ? thunk->end - thunk->begin : 0) : thunk->begin;
+  char *yytext= ctx->buf + thunk->begin;
+#else
+  int yyleng= thunk->end ? yyText(ctx, thunk->begin, thunk->end) : thunk->begin;
+  char *yytext= ctx->text;
+#endif
+  int i;
+  if (!thunk->action)
     {
-      yythunk *thunk= &ctx->thunks[pos];
-      int yyleng= thunk->end ? yyText(ctx, thunk->begin, thunk->end) : thunk->begin;
-      yyprintf((stderr, "DO [%d] %p %s\n", pos, thunk->action, ctx->text));
-      thunk->action(ctx, ctx->text, yyleng);
+      for (i= 0;  i < thunk->begin && !ctx->nomem;  ++i)
+	yyDoThunk(ctx, thunk->next + i, i);
+      return;
     }
+  yyprintf((stderr, "DO [%d] %p %.*s\n", pos, thunk->action, thunk->end ? yyleng : 0, yytext));
+  thunk->action(ctx, yytext, yyleng);
+}
+
+YY_LOCAL(void) yyDone(yycontext *ctx)
+{
+  int pos;
+  for (pos= 0;  pos < ctx->thunkpos && !ctx->nomem;  ++pos)
+    yyDoThunk(ctx, &ctx->thunks[pos], pos);
   ctx->thunkpos= 0;
 }
 
 YY_LOCAL(void) yyCommit(yycontext *ctx)
 {
+#ifdef YY_BUFFER_INPUT
+  ctx->buf += ctx->pos;
+  ctx->limit -= ctx->pos;
+#else
   if ((ctx->limit -= ctx->pos))
     {
       memmove(ctx->buf, ctx->buf + ctx->pos, ctx->limit);
     }
+#endif
   ctx->begin -= ctx->pos;
   ctx->end -= ctx->pos;
   ctx->pos= ctx->thunkpos= 0;
+#if YYMEMOCOUNT
+  ++ctx->memogen;
+  ctx->sharedbytes= 0;
+  ctx->mark= 0;
+  while (ctx->shared)
+    {
+      yyshared *next= ctx->shared->next;
+      ctx->shared->next= ctx->spare;
+      ctx->spare= ctx->shared;
+      ctx->shared= next;
+    }
+#endif
 }
 
 YY_LOCAL(int) yyAccept(yycontext *ctx, int tp0)
@@ -265,7 +395,266 @@ YY_LOCAL(int) yyAccept(yycontext *ctx, int tp0)
   return 1;
 }
 
-YY_LOCAL(void) yyPush(yycontext *ctx, char *text, int count)  { ctx->val += count; }
+#if YYMEMOCOUNT
+
+YY_LOCAL(int) yyRecall(yycontext *ctx, int memo)
+{
+  yymemo *m= &ctx->memos[(ctx->pos * YYMEMOCOUNT + memo) & (ctx->memosize - 1)];
+  if (ctx->nomem)
+    return 0;		/* the parse is being abandoned */
+  if (m->gen != ctx->memogen || m->pos != ctx->pos || m->memo != memo)
+    {
+      if (YY_MEMO_DEPTH && ctx->memodepth >= YY_MEMO_DEPTH)
+	{
+	  ctx->nomem= 2;	/* nested too deeply for the stack */
+	  return 0;
+	}
+      ++ctx->memodepth;
+      ++ctx->memomisses[memo];
+      return -1;
+    }
+  while (ctx->thunkpos + m->thunkcount >= ctx->thunkslen)
+    {
+      yythunk *thunks= (yythunk *)YY_REALLOC(ctx, ctx->thunks, sizeof(yythunk) * ctx->thunkslen * 2);
+      if (!thunks)
+	{
+	  ctx->nomem= 1;
+	  return 0;
+	}
+      ctx->thunks= thunks;
+      ctx->thunkslen *= 2;
+    }
+  ++ctx->memohits[memo];
+  if (m->thunkcount)
+    memcpy(ctx->thunks + ctx->thunkpos, m->thunks, sizeof(yythunk) * m->thunkcount);
+  ctx->thunkpos += m->thunkcount;
+  ctx->pos= m->next;
+  if (m->marked & 1) ctx->begin= m->begin;
+  if (m->marked & 2) ctx->end= m->end;
+  ctx->marked |= m->marked;
+  yyprintf((stderr, "  memo %d @ %s\n", memo, ctx->buf+ctx->pos));
+  return m->ok;
+}
+
+/* Whether the memo table and the shared actions may take bytes more:
+ * they may take up to memolimit if the caller has set it, or else
+ * YY_MEMO_LIMIT.  While memokeep is set they take what they need, and
+ * yyKeepRoom holds the outcomes kept to the limit instead. */
+
+YY_LOCAL(int) yyMemoRoom(yycontext *ctx, long bytes)
+{
+  return ctx->memokeep || ctx->memobytes + ctx->sharedbytes + bytes <= (ctx->memolimit ? ctx->memolimit : YY_MEMO_LIMIT);
+}
+
+/* Whether an outcome at pos that scheduled count actions may be kept
+ * with the ones kept since yyparse() began, or since the last
+ * yyResume(): together they may need up to the limit, for a table with
+ * room for every memoized rule at each position they span, and the old
+ * half of it while it is doubled, for their actions and for those
+ * shared.  The count does not depend on the size of the table or on the
+ * outcomes recorded before, so whether a parse fits does not either. */
+
+YY_LOCAL(int) yyKeepRoom(yycontext *ctx, int pos, int count)
+{
+  int len= 4;
+  if (count > YY_MEMO_SHARE)
+    {
+      ctx->keptbytes += sizeof(yythunk) * count;
+      count= 1;
+    }
+  while (len < count) len *= 2;
+  if (count)
+    ctx->keptbytes += sizeof(yythunk) * len;
+  if (ctx->keptfrom < 0 || pos < ctx->keptfrom) ctx->keptfrom= pos;
+  if (ctx->keptto < pos) ctx->keptto= pos;
+  return ctx->keptbytes + 3L * sizeof(yymemo) * YYMEMOCOUNT * (ctx->keptto - ctx->keptfrom + 1)
+    <= (ctx->memolimit ? ctx->memolimit : YY_MEMO_LIMIT);
+}
+
+/* Thunks of a long result are moved to storage that lasts until the
+ * next commit, and replaced by one thunk that runs them.  Results that
+ * contain it, and every recall of it, then copy only that thunk. */
+
+YY_LOCAL(void) yyShare(yycontext *ctx, int thunkpos)
+{
+  int count= ctx->thunkpos - thunkpos;
+  yyshared *s= ctx->shared, **spare= &ctx->spare;
+  if (!s || s->used + count > s->size)
+    {
+      while ((s= *spare) && s->size < count)
+	spare= &s->next;
+      if (!yyMemoRoom(ctx, sizeof(yythunk) * (s ? s->size : count > 4096 ? count : 4096)))
+	return;		/* the thunks stay where they are */
+      if (s)
+	*spare= s->next;
+      else
+	{
+	  int size= count > 4096 ? count : 4096;
+	  yythunk *thunks= (yythunk *)YY_MALLOC(ctx, sizeof(yythunk) * size);
+	  if (!thunks || !(s= (yyshared *)YY_MALLOC(ctx, sizeof(yyshared))))
+	    {
+	      YY_FREE(ctx, thunks);
+	      return;	/* the thunks stay where they are */
+	    }
+	  s->size= size;
+	  s->thunks= thunks;
+	}
+      s->used= 0;
+      s->next= ctx->shared;
+      ctx->sharedbytes += sizeof(yythunk) * s->size;
+      ctx->shared= s;
+    }
+  memcpy(s->thunks + s->used, ctx->thunks + thunkpos, sizeof(yythunk) * count);
+  ctx->thunks[thunkpos].begin=  count;
+  ctx->thunks[thunkpos].end=    0;
+  ctx->thunks[thunkpos].action= 0;
+  ctx->thunks[thunkpos].next=   s->thunks + s->used;
+  ctx->thunkpos= thunkpos + 1;
+  s->used += count;
+}
+
+/* A result that would replace one recorded further on means that the
+ * parse has backtracked across more text than the table covers, and
+ * will want the results it is losing again.  The table is doubled
+ * instead, for as long as it fits within the limit with the old table,
+ * which is freed only once its results are copied.  While memokeep is
+ * set no result of the parse is replaced: the table is doubled until
+ * the new one has a place of its own. */
+
+YY_LOCAL(int) yyMemoGrow(yycontext *ctx)
+{
+  int size= ctx->memosize, i;
+  yymemo *memos;
+  if (!yyMemoRoom(ctx, sizeof(yymemo) * size * 2)
+      || !(memos= (yymemo *)YY_MALLOC(ctx, sizeof(yymemo) * size * 2)))
+    return 0;
+  for (i= 0;  i < size;  ++i)
+    {
+      yymemo *m= &ctx->memos[i];
+      int high= (m->pos * YYMEMOCOUNT + m->memo) & size;
+      memos[i | high]= *m;
+      memset(&memos[i | (size & ~high)], 0, sizeof(yymemo));
+    }
+  YY_FREE(ctx, ctx->memos);
+  ctx->memos= memos;
+  ctx->memosize= size * 2;
+  ctx->memobytes += sizeof(yymemo) * size;
+  return 1;
+}
+
+YY_LOCAL(int) yyMemo(yycontext *ctx, int memo, int pos, int thunkpos, int marked, int ok)
+{
+  yymemo *m= &ctx->memos[(pos * YYMEMOCOUNT + memo) & (ctx->memosize - 1)];
+  int count;
+  --ctx->memodepth;
+  if (ctx->memokeep && !yyKeepRoom(ctx, pos, ctx->thunkpos - thunkpos))
+    {
+      ctx->nomem= 1;
+      ctx->marked |= marked;
+      return ok;
+    }
+  if (m->gen == ctx->memogen && m->pos > pos)
+    {
+      yyMemoGrow(ctx);
+      m= &ctx->memos[(pos * YYMEMOCOUNT + memo) & (ctx->memosize - 1)];
+    }
+  while (ctx->memokeep && m->gen == ctx->memogen)
+    {
+      if (!yyMemoGrow(ctx))
+	{
+	  ctx->nomem= 1;
+	  ctx->marked |= marked;
+	  return ok;
+	}
+      m= &ctx->memos[(pos * YYMEMOCOUNT + memo) & (ctx->memosize - 1)];
+    }
+  if (ctx->thunkpos - thunkpos > YY_MEMO_SHARE)
+    yyShare(ctx, thunkpos);
+  count= ctx->thunkpos - thunkpos;
+  m->gen= ctx->memogen - 1;
+  if (m->thunkslen < count)
+    {
+      int len= m->thunkslen ? m->thunkslen : 4;
+      yythunk *thunks;
+      while (len < count) len *= 2;
+      if (!yyMemoRoom(ctx, sizeof(yythunk) * (len - m->thunkslen)))
+	thunks= 0;
+      else
+	thunks= (yythunk *)YY_REALLOC(ctx, m->thunks, sizeof(yythunk) * len);
+      if (!thunks)
+	{
+	  if (ctx->memokeep)
+	    ctx->nomem= 1;
+	  ctx->marked |= marked;
+	  return ok;		/* not recorded */
+	}
+      ctx->memobytes += sizeof(yythunk) * (len - m->thunkslen);
+      m->thunks= thunks;
+      m->thunkslen= len;
+    }
+  if (count)
+    memcpy(m->thunks, ctx->thunks + thunkpos, sizeof(yythunk) * count);
+  m->thunkcount= count;
+  m->memo= memo;
+  m->pos= pos;
+  m->gen= ctx->memogen;
+  m->ok= ok;
+  m->next= ctx->pos;
+  m->marked= ctx->marked;
+  m->begin= ctx->begin;
+  m->end= ctx->end;
+  ctx->marked |= marked;
+  return ok;
+}
+
+/* A parse abandoned for want of memory (nomem is 1) or of stack (nomem
+ * is 2) can be resumed by the grammar, to try the input that ran out
+ * another way: yyMark records where the attempt begins, and yyResume,
+ * once it has failed, forgets every outcome recorded and takes back the
+ * actions kept since the mark. */
+
+YY_LOCAL(void) yyMark(yycontext *ctx)
+{
+  ctx->mark= ctx->shared;
+}
+
+YY_LOCAL(int) yyResume(yycontext *ctx)
+{
+  if (!ctx->nomem)
+    return 0;
+  ++ctx->memogen;
+  while (ctx->shared && ctx->shared != ctx->mark)
+    {
+      yyshared *next= ctx->shared->next;
+      ctx->sharedbytes -= sizeof(yythunk) * ctx->shared->size;
+      ctx->shared->next= ctx->spare;
+      ctx->spare= ctx->shared;
+      ctx->shared= next;
+    }
+  ctx->keptbytes= 0;
+  ctx->keptfrom= ctx->keptto= -1;
+  ctx->nomem= 0;
+  return 1;
+}
+
+#endif
+
+YY_LOCAL(void) yyPush(yycontext *ctx, char *text, int count)
+{
+  long offset= ctx->val - ctx->vals + count;
+  while (ctx->valslen <= offset)
+    {
+      YYSTYPE *vals= (YYSTYPE *)YY_REALLOC(ctx, ctx->vals, sizeof(YYSTYPE) * ctx->valslen * 2);
+      if (!vals)
+	{
+	  ctx->nomem= 1;
+	  return;
+	}
+      ctx->vals= vals;
+      ctx->valslen *= 2;
+    }
+  ctx->val= ctx->vals + offset;
+}
 YY_LOCAL(void) yyPop(yycontext *ctx, char *text, int count)   { ctx->val -= count; }
 YY_LOCAL(void) yySet(yycontext *ctx, char *text, int count)   { ctx->val[count]= ctx->yy; }
 
@@ -273,39 +662,41 @@ YY_LOCAL(void) yySet(yycontext *ctx, char *text, int count)   { ctx->val[count]=
 
 #define	YYACCEPT	yyAccept(ctx, yythunkpos0)
 
-YY_RULE(int) yy_end_of_line(yycontext *ctx); /* 36 */
-YY_RULE(int) yy_comment(yycontext *ctx); /* 35 */
-YY_RULE(int) yy_space(yycontext *ctx); /* 34 */
-YY_RULE(int) yy_braces(yycontext *ctx); /* 33 */
-YY_RULE(int) yy_range(yycontext *ctx); /* 32 */
-YY_RULE(int) yy_char(yycontext *ctx); /* 31 */
-YY_RULE(int) yy_END(yycontext *ctx); /* 30 */
-YY_RULE(int) yy_BEGIN(yycontext *ctx); /* 29 */
-YY_RULE(int) yy_DOT(yycontext *ctx); /* 28 */
-YY_RULE(int) yy_class(yycontext *ctx); /* 27 */
-YY_RULE(int) yy_literal(yycontext *ctx); /* 26 */
-YY_RULE(int) yy_CLOSE(yycontext *ctx); /* 25 */
-YY_RULE(int) yy_OPEN(yycontext *ctx); /* 24 */
-YY_RULE(int) yy_COLON(yycontext *ctx); /* 23 */
-YY_RULE(int) yy_PLUS(yycontext *ctx); /* 22 */
-YY_RULE(int) yy_STAR(yycontext *ctx); /* 21 */
-YY_RULE(int) yy_QUESTION(yycontext *ctx); /* 20 */
-YY_RULE(int) yy_primary(yycontext *ctx); /* 19 */
-YY_RULE(int) yy_NOT(yycontext *ctx); /* 18 */
-YY_RULE(int) yy_suffix(yycontext *ctx); /* 17 */
-YY_RULE(int) yy_action(yycontext *ctx); /* 16 */
-YY_RULE(int) yy_AND(yycontext *ctx); /* 15 */
-YY_RULE(int) yy_prefix(yycontext *ctx); /* 14 */
-YY_RULE(int) yy_BAR(yycontext *ctx); /* 13 */
-YY_RULE(int) yy_sequence(yycontext *ctx); /* 12 */
-YY_RULE(int) yy_SEMICOLON(yycontext *ctx); /* 11 */
-YY_RULE(int) yy_expression(yycontext *ctx); /* 10 */
-YY_RULE(int) yy_EQUAL(yycontext *ctx); /* 9 */
-YY_RULE(int) yy_identifier(yycontext *ctx); /* 8 */
-YY_RULE(int) yy_RPERCENT(yycontext *ctx); /* 7 */
-YY_RULE(int) yy_end_of_file(yycontext *ctx); /* 6 */
-YY_RULE(int) yy_trailer(yycontext *ctx); /* 5 */
-YY_RULE(int) yy_definition(yycontext *ctx); /* 4 */
+YY_RULE(int) yy_end_of_line(yycontext *ctx); /* 38 */
+YY_RULE(int) yy_comment(yycontext *ctx); /* 37 */
+YY_RULE(int) yy_space(yycontext *ctx); /* 36 */
+YY_RULE(int) yy_braces(yycontext *ctx); /* 35 */
+YY_RULE(int) yy_range(yycontext *ctx); /* 34 */
+YY_RULE(int) yy_char(yycontext *ctx); /* 33 */
+YY_RULE(int) yy_END(yycontext *ctx); /* 32 */
+YY_RULE(int) yy_BEGIN(yycontext *ctx); /* 31 */
+YY_RULE(int) yy_DOT(yycontext *ctx); /* 30 */
+YY_RULE(int) yy_class(yycontext *ctx); /* 29 */
+YY_RULE(int) yy_literal(yycontext *ctx); /* 28 */
+YY_RULE(int) yy_CLOSE(yycontext *ctx); /* 27 */
+YY_RULE(int) yy_OPEN(yycontext *ctx); /* 26 */
+YY_RULE(int) yy_COLON(yycontext *ctx); /* 25 */
+YY_RULE(int) yy_PLUS(yycontext *ctx); /* 24 */
+YY_RULE(int) yy_STAR(yycontext *ctx); /* 23 */
+YY_RULE(int) yy_QUESTION(yycontext *ctx); /* 22 */
+YY_RULE(int) yy_primary(yycontext *ctx); /* 21 */
+YY_RULE(int) yy_NOT(yycontext *ctx); /* 20 */
+YY_RULE(int) yy_suffix(yycontext *ctx); /* 19 */
+YY_RULE(int) yy_action(yycontext *ctx); /* 18 */
+YY_RULE(int) yy_AND(yycontext *ctx); /* 17 */
+YY_RULE(int) yy_prefix(yycontext *ctx); /* 16 */
+YY_RULE(int) yy_BAR(yycontext *ctx); /* 15 */
+YY_RULE(int) yy_sequence(yycontext *ctx); /* 14 */
+YY_RULE(int) yy_SEMICOLON(yycontext *ctx); /* 13 */
+YY_RULE(int) yy_expression(yycontext *ctx); /* 12 */
+YY_RULE(int) yy_EQUAL(yycontext *ctx); /* 11 */
+YY_RULE(int) yy_identifier(yycontext *ctx); /* 10 */
+YY_RULE(int) yy_MEMO(yycontext *ctx); /* 9 */
+YY_RULE(int) yy_RPERCENT(yycontext *ctx); /* 8 */
+YY_RULE(int) yy_end_of_file(yycontext *ctx); /* 7 */
+YY_RULE(int) yy_trailer(yycontext *ctx); /* 6 */
+YY_RULE(int) yy_definition(yycontext *ctx); /* 5 */
+YY_RULE(int) yy_memoization(yycontext *ctx); /* 4 */
 YY_RULE(int) yy_declaration(yycontext *ctx); /* 3 */
 YY_RULE(int) yy__(yycontext *ctx); /* 2 */
 YY_RULE(int) yy_grammar(yycontext *ctx); /* 1 */
@@ -531,6 +922,17 @@ YY_ACTION(void) yy_1_trailer(yycontext *ctx, char *yytext, int yyleng)
 #undef yypos
 #undef yy
 }
+YY_ACTION(void) yy_1_memoization(yycontext *ctx, char *yytext, int yyleng)
+{
+#define yy ctx->yy
+#define yypos ctx->pos
+#define yythunkpos ctx->thunkpos
+  yyprintf((stderr, "do yy_1_memoization\n"));
+   Rule_beMemoized(findRule(yytext)); ;
+#undef yythunkpos
+#undef yypos
+#undef yy
+}
 YY_ACTION(void) yy_1_declaration(yycontext *ctx, char *yytext, int yyleng)
 {
 #define yy ctx->yy
@@ -546,11 +948,18 @@ YY_ACTION(void) yy_1_declaration(yycontext *ctx, char *yytext, int yyleng)
 YY_RULE(int) yy_end_of_line(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
   yyprintf((stderr, "%s\n", "end_of_line"));
-  {  int yypos2= ctx->pos, yythunkpos2= ctx->thunkpos;  if (!yymatchString(ctx, "\r\n")) goto l3;  goto l2;
-  l3:;	  ctx->pos= yypos2; ctx->thunkpos= yythunkpos2;  if (!yymatchChar(ctx, '\n')) goto l4;  goto l2;
-  l4:;	  ctx->pos= yypos2; ctx->thunkpos= yythunkpos2;  if (!yymatchChar(ctx, '\r')) goto l1;
+  {  int yypos4= ctx->pos, yythunkpos4= ctx->thunkpos;  int yyc5= yypeek(ctx);
+  switch (yyc5)
+    {
+     case 13:  goto l2;
+     case 10:  goto l3;
+    default:  goto l1;
+    }
+  l2:;	  if (!yymatchString(ctx, "\r\n")) goto l6;  goto l4;
+  l6:;	  ctx->pos= yypos4; ctx->thunkpos= yythunkpos4;
+  l3:;	  if (!yyfirst(yyc5, (unsigned char *)"\000\044\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l1;  if (!yymatchClass(ctx, (unsigned char *)"\000\044\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l1;
   }
-  l2:;	
+  l4:;	
   yyprintf((stderr, "  ok   %s @ %s\n", "end_of_line", ctx->buf+ctx->pos));
   return 1;
   l1:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
@@ -559,468 +968,617 @@ YY_RULE(int) yy_end_of_line(yycontext *ctx)
 }
 YY_RULE(int) yy_comment(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
-  yyprintf((stderr, "%s\n", "comment"));  if (!yymatchChar(ctx, '#')) goto l5;
-  l6:;	
-  {  int yypos7= ctx->pos, yythunkpos7= ctx->thunkpos;
-  {  int yypos8= ctx->pos, yythunkpos8= ctx->thunkpos;  if (!yy_end_of_line(ctx)) goto l8;  goto l7;
-  l8:;	  ctx->pos= yypos8; ctx->thunkpos= yythunkpos8;
-  }  if (!yymatchDot(ctx)) goto l7;  goto l6;
-  l7:;	  ctx->pos= yypos7; ctx->thunkpos= yythunkpos7;
-  }  if (!yy_end_of_line(ctx)) goto l5;
+  yyprintf((stderr, "%s\n", "comment"));  if (!yymatchChar(ctx, '#')) goto l7;
+  l8:;	
+  {  int yypos9= ctx->pos, yythunkpos9= ctx->thunkpos;
+  {  int yypos10= ctx->pos, yythunkpos10= ctx->thunkpos;  if (!yy_end_of_line(ctx)) goto l10;  goto l9;
+  l10:;	  ctx->pos= yypos10; ctx->thunkpos= yythunkpos10;
+  }  if (!yymatchDot(ctx)) goto l9;  goto l8;
+  l9:;	  ctx->pos= yypos9; ctx->thunkpos= yythunkpos9;
+  }  if (!yy_end_of_line(ctx)) goto l7;
   yyprintf((stderr, "  ok   %s @ %s\n", "comment", ctx->buf+ctx->pos));
   return 1;
-  l5:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l7:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "comment", ctx->buf+ctx->pos));
   return 0;
 }
 YY_RULE(int) yy_space(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
   yyprintf((stderr, "%s\n", "space"));
-  {  int yypos10= ctx->pos, yythunkpos10= ctx->thunkpos;  if (!yymatchChar(ctx, ' ')) goto l11;  goto l10;
-  l11:;	  ctx->pos= yypos10; ctx->thunkpos= yythunkpos10;  if (!yymatchChar(ctx, '\t')) goto l12;  goto l10;
-  l12:;	  ctx->pos= yypos10; ctx->thunkpos= yythunkpos10;  if (!yy_end_of_line(ctx)) goto l9;
+  {  int yypos14= ctx->pos, yythunkpos14= ctx->thunkpos;  int yyc15= yypeek(ctx);
+  switch (yyc15)
+    {
+     case 9: case 32:  goto l12;
+     case 10: case 13:  goto l13;
+    default:  goto l11;
+    }
+  l12:;	  if (!yymatchClass(ctx, (unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l16;  goto l14;
+  l16:;	  ctx->pos= yypos14; ctx->thunkpos= yythunkpos14;
+  l13:;	  if (!yyfirst(yyc15, (unsigned char *)"\000\044\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l11;  if (!yy_end_of_line(ctx)) goto l11;
   }
-  l10:;	
+  l14:;	
   yyprintf((stderr, "  ok   %s @ %s\n", "space", ctx->buf+ctx->pos));
   return 1;
-  l9:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l11:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "space", ctx->buf+ctx->pos));
   return 0;
 }
 YY_RULE(int) yy_braces(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
   yyprintf((stderr, "%s\n", "braces"));
-  {  int yypos14= ctx->pos, yythunkpos14= ctx->thunkpos;  if (!yymatchChar(ctx, '{')) goto l15;
-  l16:;	
-  {  int yypos17= ctx->pos, yythunkpos17= ctx->thunkpos;  if (!yy_braces(ctx)) goto l17;  goto l16;
-  l17:;	  ctx->pos= yypos17; ctx->thunkpos= yythunkpos17;
-  }  if (!yymatchChar(ctx, '}')) goto l15;  goto l14;
-  l15:;	  ctx->pos= yypos14; ctx->thunkpos= yythunkpos14;
-  {  int yypos18= ctx->pos, yythunkpos18= ctx->thunkpos;  if (!yymatchChar(ctx, '}')) goto l18;  goto l13;
-  l18:;	  ctx->pos= yypos18; ctx->thunkpos= yythunkpos18;
-  }  if (!yymatchDot(ctx)) goto l13;
+  {  int yypos20= ctx->pos, yythunkpos20= ctx->thunkpos;  int yyc21= yypeek(ctx);
+  switch (yyc21)
+    {
+     case 123:  goto l18;
+    default:  goto l19;
+    }
+  l18:;	  if (!yymatchChar(ctx, '{')) goto l22;
+  l23:;	
+  {  int yypos24= ctx->pos, yythunkpos24= ctx->thunkpos;  if (!yy_braces(ctx)) goto l24;  goto l23;
+  l24:;	  ctx->pos= yypos24; ctx->thunkpos= yythunkpos24;
+  }  if (!yymatchChar(ctx, '}')) goto l22;  goto l20;
+  l22:;	  ctx->pos= yypos20; ctx->thunkpos= yythunkpos20;
+  l19:;	
+  {  int yypos25= ctx->pos, yythunkpos25= ctx->thunkpos;  if (!yymatchChar(ctx, '}')) goto l25;  goto l17;
+  l25:;	  ctx->pos= yypos25; ctx->thunkpos= yythunkpos25;
+  }  if (!yymatchDot(ctx)) goto l17;
   }
-  l14:;	
+  l20:;	
   yyprintf((stderr, "  ok   %s @ %s\n", "braces", ctx->buf+ctx->pos));
   return 1;
-  l13:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l17:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "braces", ctx->buf+ctx->pos));
   return 0;
 }
 YY_RULE(int) yy_range(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
   yyprintf((stderr, "%s\n", "range"));
-  {  int yypos20= ctx->pos, yythunkpos20= ctx->thunkpos;  if (!yy_char(ctx)) goto l21;  if (!yymatchChar(ctx, '-')) goto l21;  if (!yy_char(ctx)) goto l21;  goto l20;
-  l21:;	  ctx->pos= yypos20; ctx->thunkpos= yythunkpos20;  if (!yy_char(ctx)) goto l19;
+  {  int yypos29= ctx->pos, yythunkpos29= ctx->thunkpos;  if (!yy_char(ctx)) goto l30;  if (!yymatchChar(ctx, '-')) goto l30;  if (!yy_char(ctx)) goto l30;  goto l29;
+  l30:;	  ctx->pos= yypos29; ctx->thunkpos= yythunkpos29;  if (!yy_char(ctx)) goto l26;
   }
-  l20:;	
+  l29:;	
   yyprintf((stderr, "  ok   %s @ %s\n", "range", ctx->buf+ctx->pos));
   return 1;
-  l19:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l26:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "range", ctx->buf+ctx->pos));
   return 0;
 }
 YY_RULE(int) yy_char(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
   yyprintf((stderr, "%s\n", "char"));
-  {  int yypos23= ctx->pos, yythunkpos23= ctx->thunkpos;  if (!yymatchChar(ctx, '\\')) goto l24;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\204\040\000\000\000\000\000\070\146\100\124\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l24;  goto l23;
-  l24:;	  ctx->pos= yypos23; ctx->thunkpos= yythunkpos23;  if (!yymatchChar(ctx, '\\')) goto l25;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\000\017\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l25;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l25;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l25;  goto l23;
-  l25:;	  ctx->pos= yypos23; ctx->thunkpos= yythunkpos23;  if (!yymatchChar(ctx, '\\')) goto l26;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l26;
-  {  int yypos27= ctx->pos, yythunkpos27= ctx->thunkpos;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l27;  goto l28;
-  l27:;	  ctx->pos= yypos27; ctx->thunkpos= yythunkpos27;
+  {  int yypos36= ctx->pos, yythunkpos36= ctx->thunkpos;  int yyc37= yypeek(ctx);
+  switch (yyc37)
+    {
+     case 92:  goto l32;
+    default:  goto l35;
+    }
+  l32:;	  if (!yymatchChar(ctx, '\\')) goto l38;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\204\040\000\000\000\000\000\070\146\100\124\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l38;  goto l36;
+  l38:;	  ctx->pos= yypos36; ctx->thunkpos= yythunkpos36;  if (!yyfirst(yyc37, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l34;  if (!yymatchChar(ctx, '\\')) goto l39;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\000\017\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l39;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l39;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l39;  goto l36;
+  l39:;	  ctx->pos= yypos36; ctx->thunkpos= yythunkpos36;
+  l34:;	  if (!yyfirst(yyc37, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l35;  if (!yymatchChar(ctx, '\\')) goto l40;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l40;
+  {  int yypos41= ctx->pos, yythunkpos41= ctx->thunkpos;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l41;  goto l42;
+  l41:;	  ctx->pos= yypos41; ctx->thunkpos= yythunkpos41;
   }
-  l28:;	  goto l23;
-  l26:;	  ctx->pos= yypos23; ctx->thunkpos= yythunkpos23;
-  {  int yypos29= ctx->pos, yythunkpos29= ctx->thunkpos;  if (!yymatchChar(ctx, '\\')) goto l29;  goto l22;
-  l29:;	  ctx->pos= yypos29; ctx->thunkpos= yythunkpos29;
-  }  if (!yymatchDot(ctx)) goto l22;
+  l42:;	  goto l36;
+  l40:;	  ctx->pos= yypos36; ctx->thunkpos= yythunkpos36;
+  l35:;	
+  {  int yypos43= ctx->pos, yythunkpos43= ctx->thunkpos;  if (!yymatchChar(ctx, '\\')) goto l43;  goto l31;
+  l43:;	  ctx->pos= yypos43; ctx->thunkpos= yythunkpos43;
+  }  if (!yymatchDot(ctx)) goto l31;
   }
-  l23:;	
+  l36:;	
   yyprintf((stderr, "  ok   %s @ %s\n", "char", ctx->buf+ctx->pos));
   return 1;
-  l22:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l31:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "char", ctx->buf+ctx->pos));
   return 0;
 }
 YY_RULE(int) yy_END(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
-  yyprintf((stderr, "%s\n", "END"));  if (!yymatchChar(ctx, '>')) goto l30;  if (!yy__(ctx)) goto l30;
+  yyprintf((stderr, "%s\n", "END"));  if (!yymatchChar(ctx, '>')) goto l44;  if (!yy__(ctx)) goto l44;
   yyprintf((stderr, "  ok   %s @ %s\n", "END", ctx->buf+ctx->pos));
   return 1;
-  l30:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l44:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "END", ctx->buf+ctx->pos));
   return 0;
 }
 YY_RULE(int) yy_BEGIN(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
-  yyprintf((stderr, "%s\n", "BEGIN"));  if (!yymatchChar(ctx, '<')) goto l31;  if (!yy__(ctx)) goto l31;
+  yyprintf((stderr, "%s\n", "BEGIN"));  if (!yymatchChar(ctx, '<')) goto l45;  if (!yy__(ctx)) goto l45;
   yyprintf((stderr, "  ok   %s @ %s\n", "BEGIN", ctx->buf+ctx->pos));
   return 1;
-  l31:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l45:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "BEGIN", ctx->buf+ctx->pos));
   return 0;
 }
 YY_RULE(int) yy_DOT(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
-  yyprintf((stderr, "%s\n", "DOT"));  if (!yymatchChar(ctx, '.')) goto l32;  if (!yy__(ctx)) goto l32;
+  yyprintf((stderr, "%s\n", "DOT"));  if (!yymatchChar(ctx, '.')) goto l46;  if (!yy__(ctx)) goto l46;
   yyprintf((stderr, "  ok   %s @ %s\n", "DOT", ctx->buf+ctx->pos));
   return 1;
-  l32:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l46:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "DOT", ctx->buf+ctx->pos));
   return 0;
 }
 YY_RULE(int) yy_class(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
-  yyprintf((stderr, "%s\n", "class"));  if (!yymatchChar(ctx, '[')) goto l33;  yyText(ctx, ctx->begin, ctx->end);  if (!(YY_BEGIN)) goto l33;
-  l34:;	
-  {  int yypos35= ctx->pos, yythunkpos35= ctx->thunkpos;
-  {  int yypos36= ctx->pos, yythunkpos36= ctx->thunkpos;  if (!yymatchChar(ctx, ']')) goto l36;  goto l35;
-  l36:;	  ctx->pos= yypos36; ctx->thunkpos= yythunkpos36;
-  }  if (!yy_range(ctx)) goto l35;  goto l34;
-  l35:;	  ctx->pos= yypos35; ctx->thunkpos= yythunkpos35;
-  }  yyText(ctx, ctx->begin, ctx->end);  if (!(YY_END)) goto l33;  if (!yymatchChar(ctx, ']')) goto l33;  if (!yy__(ctx)) goto l33;
+  yyprintf((stderr, "%s\n", "class"));  if (!yymatchChar(ctx, '[')) goto l47;  if (!(YY_BEGIN)) goto l47;
+  l48:;	
+  {  int yypos49= ctx->pos, yythunkpos49= ctx->thunkpos;
+  {  int yypos50= ctx->pos, yythunkpos50= ctx->thunkpos;  if (!yymatchChar(ctx, ']')) goto l50;  goto l49;
+  l50:;	  ctx->pos= yypos50; ctx->thunkpos= yythunkpos50;
+  }  if (!yy_range(ctx)) goto l49;  goto l48;
+  l49:;	  ctx->pos= yypos49; ctx->thunkpos= yythunkpos49;
+  }  if (!(YY_END)) goto l47;  if (!yymatchChar(ctx, ']')) goto l47;  if (!yy__(ctx)) goto l47;
   yyprintf((stderr, "  ok   %s @ %s\n", "class", ctx->buf+ctx->pos));
   return 1;
-  l33:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l47:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "class", ctx->buf+ctx->pos));
   return 0;
 }
 YY_RULE(int) yy_literal(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
   yyprintf((stderr, "%s\n", "literal"));
-  {  int yypos38= ctx->pos, yythunkpos38= ctx->thunkpos;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l39;  yyText(ctx, ctx->begin, ctx->end);  if (!(YY_BEGIN)) goto l39;
-  l40:;	
-  {  int yypos41= ctx->pos, yythunkpos41= ctx->thunkpos;
-  {  int yypos42= ctx->pos, yythunkpos42= ctx->thunkpos;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l42;  goto l41;
-  l42:;	  ctx->pos= yypos42; ctx->thunkpos= yythunkpos42;
-  }  if (!yy_char(ctx)) goto l41;  goto l40;
-  l41:;	  ctx->pos= yypos41; ctx->thunkpos= yythunkpos41;
-  }  yyText(ctx, ctx->begin, ctx->end);  if (!(YY_END)) goto l39;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l39;  if (!yy__(ctx)) goto l39;  goto l38;
-  l39:;	  ctx->pos= yypos38; ctx->thunkpos= yythunkpos38;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l37;  yyText(ctx, ctx->begin, ctx->end);  if (!(YY_BEGIN)) goto l37;
-  l43:;	
-  {  int yypos44= ctx->pos, yythunkpos44= ctx->thunkpos;
-  {  int yypos45= ctx->pos, yythunkpos45= ctx->thunkpos;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l45;  goto l44;
-  l45:;	  ctx->pos= yypos45; ctx->thunkpos= yythunkpos45;
-  }  if (!yy_char(ctx)) goto l44;  goto l43;
-  l44:;	  ctx->pos= yypos44; ctx->thunkpos= yythunkpos44;
-  }  yyText(ctx, ctx->begin, ctx->end);  if (!(YY_END)) goto l37;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l37;  if (!yy__(ctx)) goto l37;
+  {  int yypos54= ctx->pos, yythunkpos54= ctx->thunkpos;  int yyc55= yypeek(ctx);
+  switch (yyc55)
+    {
+     case 39:  goto l52;
+     case 34:  goto l53;
+    default:  goto l51;
+    }
+  l52:;	  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l56;  if (!(YY_BEGIN)) goto l56;
+  l57:;	
+  {  int yypos58= ctx->pos, yythunkpos58= ctx->thunkpos;
+  {  int yypos59= ctx->pos, yythunkpos59= ctx->thunkpos;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l59;  goto l58;
+  l59:;	  ctx->pos= yypos59; ctx->thunkpos= yythunkpos59;
+  }  if (!yy_char(ctx)) goto l58;  goto l57;
+  l58:;	  ctx->pos= yypos58; ctx->thunkpos= yythunkpos58;
+  }  if (!(YY_END)) goto l56;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l56;  if (!yy__(ctx)) goto l56;  goto l54;
+  l56:;	  ctx->pos= yypos54; ctx->thunkpos= yythunkpos54;
+  l53:;	  if (!yyfirst(yyc55, (unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l51;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l51;  if (!(YY_BEGIN)) goto l51;
+  l60:;	
+  {  int yypos61= ctx->pos, yythunkpos61= ctx->thunkpos;
+  {  int yypos62= ctx->pos, yythunkpos62= ctx->thunkpos;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l62;  goto l61;
+  l62:;	  ctx->pos= yypos62; ctx->thunkpos= yythunkpos62;
+  }  if (!yy_char(ctx)) goto l61;  goto l60;
+  l61:;	  ctx->pos= yypos61; ctx->thunkpos= yythunkpos61;
+  }  if (!(YY_END)) goto l51;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l51;  if (!yy__(ctx)) goto l51;
   }
-  l38:;	
+  l54:;	
   yyprintf((stderr, "  ok   %s @ %s\n", "literal", ctx->buf+ctx->pos));
   return 1;
-  l37:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l51:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "literal", ctx->buf+ctx->pos));
   return 0;
 }
 YY_RULE(int) yy_CLOSE(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
-  yyprintf((stderr, "%s\n", "CLOSE"));  if (!yymatchChar(ctx, ')')) goto l46;  if (!yy__(ctx)) goto l46;
+  yyprintf((stderr, "%s\n", "CLOSE"));  if (!yymatchChar(ctx, ')')) goto l63;  if (!yy__(ctx)) goto l63;
   yyprintf((stderr, "  ok   %s @ %s\n", "CLOSE", ctx->buf+ctx->pos));
   return 1;
-  l46:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l63:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "CLOSE", ctx->buf+ctx->pos));
   return 0;
 }
 YY_RULE(int) yy_OPEN(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
-  yyprintf((stderr, "%s\n", "OPEN"));  if (!yymatchChar(ctx, '(')) goto l47;  if (!yy__(ctx)) goto l47;
+  yyprintf((stderr, "%s\n", "OPEN"));  if (!yymatchChar(ctx, '(')) goto l64;  if (!yy__(ctx)) goto l64;
   yyprintf((stderr, "  ok   %s @ %s\n", "OPEN", ctx->buf+ctx->pos));
   return 1;
-  l47:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l64:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "OPEN", ctx->buf+ctx->pos));
   return 0;
 }
 YY_RULE(int) yy_COLON(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
-  yyprintf((stderr, "%s\n", "COLON"));  if (!yymatchChar(ctx, ':')) goto l48;  if (!yy__(ctx)) goto l48;
+  yyprintf((stderr, "%s\n", "COLON"));  if (!yymatchChar(ctx, ':')) goto l65;  if (!yy__(ctx)) goto l65;
   yyprintf((stderr, "  ok   %s @ %s\n", "COLON", ctx->buf+ctx->pos));
   return 1;
-  l48:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l65:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "COLON", ctx->buf+ctx->pos));
   return 0;
 }
 YY_RULE(int) yy_PLUS(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
-  yyprintf((stderr, "%s\n", "PLUS"));  if (!yymatchChar(ctx, '+')) goto l49;  if (!yy__(ctx)) goto l49;
+  yyprintf((stderr, "%s\n", "PLUS"));  if (!yymatchChar(ctx, '+')) goto l66;  if (!yy__(ctx)) goto l66;
   yyprintf((stderr, "  ok   %s @ %s\n", "PLUS", ctx->buf+ctx->pos));
   return 1;
-  l49:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l66:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "PLUS", ctx->buf+ctx->pos));
   return 0;
 }
 YY_RULE(int) yy_STAR(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
-  yyprintf((stderr, "%s\n", "STAR"));  if (!yymatchChar(ctx, '*')) goto l50;  if (!yy__(ctx)) goto l50;
+  yyprintf((stderr, "%s\n", "STAR"));  if (!yymatchChar(ctx, '*')) goto l67;  if (!yy__(ctx)) goto l67;
   yyprintf((stderr, "  ok   %s @ %s\n", "STAR", ctx->buf+ctx->pos));
   return 1;
-  l50:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l67:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "STAR", ctx->buf+ctx->pos));
   return 0;
 }
 YY_RULE(int) yy_QUESTION(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
-  yyprintf((stderr, "%s\n", "QUESTION"));  if (!yymatchChar(ctx, '?')) goto l51;  if (!yy__(ctx)) goto l51;
+  yyprintf((stderr, "%s\n", "QUESTION"));  if (!yymatchChar(ctx, '?')) goto l68;  if (!yy__(ctx)) goto l68;
   yyprintf((stderr, "  ok   %s @ %s\n", "QUESTION", ctx->buf+ctx->pos));
   return 1;
-  l51:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l68:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "QUESTION", ctx->buf+ctx->pos));
   return 0;
 }
 YY_RULE(int) yy_primary(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
   yyprintf((stderr, "%s\n", "primary"));
-  {  int yypos53= ctx->pos, yythunkpos53= ctx->thunkpos;  if (!yy_identifier(ctx)) goto l54;  yyDo(ctx, yy_1_primary, ctx->begin, ctx->end);  if (!yy_COLON(ctx)) goto l54;  if (!yy_identifier(ctx)) goto l54;
-  {  int yypos55= ctx->pos, yythunkpos55= ctx->thunkpos;  if (!yy_EQUAL(ctx)) goto l55;  goto l54;
-  l55:;	  ctx->pos= yypos55; ctx->thunkpos= yythunkpos55;
-  }  yyDo(ctx, yy_2_primary, ctx->begin, ctx->end);  goto l53;
-  l54:;	  ctx->pos= yypos53; ctx->thunkpos= yythunkpos53;  if (!yy_identifier(ctx)) goto l56;
-  {  int yypos57= ctx->pos, yythunkpos57= ctx->thunkpos;  if (!yy_EQUAL(ctx)) goto l57;  goto l56;
-  l57:;	  ctx->pos= yypos57; ctx->thunkpos= yythunkpos57;
-  }  yyDo(ctx, yy_3_primary, ctx->begin, ctx->end);  goto l53;
-  l56:;	  ctx->pos= yypos53; ctx->thunkpos= yythunkpos53;  if (!yy_OPEN(ctx)) goto l58;  if (!yy_expression(ctx)) goto l58;  if (!yy_CLOSE(ctx)) goto l58;  goto l53;
-  l58:;	  ctx->pos= yypos53; ctx->thunkpos= yythunkpos53;  if (!yy_literal(ctx)) goto l59;  yyDo(ctx, yy_4_primary, ctx->begin, ctx->end);  goto l53;
-  l59:;	  ctx->pos= yypos53; ctx->thunkpos= yythunkpos53;  if (!yy_class(ctx)) goto l60;  yyDo(ctx, yy_5_primary, ctx->begin, ctx->end);  goto l53;
-  l60:;	  ctx->pos= yypos53; ctx->thunkpos= yythunkpos53;  if (!yy_DOT(ctx)) goto l61;  yyDo(ctx, yy_6_primary, ctx->begin, ctx->end);  goto l53;
-  l61:;	  ctx->pos= yypos53; ctx->thunkpos= yythunkpos53;  if (!yy_action(ctx)) goto l62;  yyDo(ctx, yy_7_primary, ctx->begin, ctx->end);  goto l53;
-  l62:;	  ctx->pos= yypos53; ctx->thunkpos= yythunkpos53;  if (!yy_BEGIN(ctx)) goto l63;  yyDo(ctx, yy_8_primary, ctx->begin, ctx->end);  goto l53;
-  l63:;	  ctx->pos= yypos53; ctx->thunkpos= yythunkpos53;  if (!yy_END(ctx)) goto l52;  yyDo(ctx, yy_9_primary, ctx->begin, ctx->end);
+  {  int yypos79= ctx->pos, yythunkpos79= ctx->thunkpos;  int yyc80= yypeek(ctx);
+  switch (yyc80)
+    {
+     case 45: case 65: case 66: case 67: case 68: case 69: case 70: case 71:
+     case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79:
+     case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87:
+     case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100:
+     case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108:
+     case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116:
+     case 117: case 118: case 119: case 120: case 121: case 122:  goto l70;
+     case 40:  goto l72;
+     case 34: case 39:  goto l73;
+     case 91:  goto l74;
+     case 46:  goto l75;
+     case 123:  goto l76;
+     case 60:  goto l77;
+     case 62:  goto l78;
+    default:  goto l69;
+    }
+  l70:;	  if (!yy_identifier(ctx)) goto l81;  yyDo(ctx, yy_1_primary, ctx->begin, ctx->end);  if (!yy_COLON(ctx)) goto l81;  if (!yy_identifier(ctx)) goto l81;
+  {  int yypos82= ctx->pos, yythunkpos82= ctx->thunkpos;  if (!yy_EQUAL(ctx)) goto l82;  goto l81;
+  l82:;	  ctx->pos= yypos82; ctx->thunkpos= yythunkpos82;
+  }  yyDo(ctx, yy_2_primary, ctx->begin, ctx->end);  goto l79;
+  l81:;	  ctx->pos= yypos79; ctx->thunkpos= yythunkpos79;  if (!yyfirst(yyc80, (unsigned char *)"\000\000\000\000\000\040\000\000\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l72;  if (!yy_identifier(ctx)) goto l83;
+  {  int yypos84= ctx->pos, yythunkpos84= ctx->thunkpos;  if (!yy_EQUAL(ctx)) goto l84;  goto l83;
+  l84:;	  ctx->pos= yypos84; ctx->thunkpos= yythunkpos84;
+  }  yyDo(ctx, yy_3_primary, ctx->begin, ctx->end);  goto l79;
+  l83:;	  ctx->pos= yypos79; ctx->thunkpos= yythunkpos79;
+  l72:;	  if (!yyfirst(yyc80, (unsigned char *)"\000\000\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l73;  if (!yy_OPEN(ctx)) goto l85;  if (!yy_expression(ctx)) goto l85;  if (!yy_CLOSE(ctx)) goto l85;  goto l79;
+  l85:;	  ctx->pos= yypos79; ctx->thunkpos= yythunkpos79;
+  l73:;	  if (!yyfirst(yyc80, (unsigned char *)"\000\000\000\000\204\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l74;  if (!yy_literal(ctx)) goto l86;  yyDo(ctx, yy_4_primary, ctx->begin, ctx->end);  goto l79;
+  l86:;	  ctx->pos= yypos79; ctx->thunkpos= yythunkpos79;
+  l74:;	  if (!yyfirst(yyc80, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l75;  if (!yy_class(ctx)) goto l87;  yyDo(ctx, yy_5_primary, ctx->begin, ctx->end);  goto l79;
+  l87:;	  ctx->pos= yypos79; ctx->thunkpos= yythunkpos79;
+  l75:;	  if (!yyfirst(yyc80, (unsigned char *)"\000\000\000\000\000\100\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l76;  if (!yy_DOT(ctx)) goto l88;  yyDo(ctx, yy_6_primary, ctx->begin, ctx->end);  goto l79;
+  l88:;	  ctx->pos= yypos79; ctx->thunkpos= yythunkpos79;
+  l76:;	  if (!yyfirst(yyc80, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l77;  if (!yy_action(ctx)) goto l89;  yyDo(ctx, yy_7_primary, ctx->begin, ctx->end);  goto l79;
+  l89:;	  ctx->pos= yypos79; ctx->thunkpos= yythunkpos79;
+  l77:;	  if (!yyfirst(yyc80, (unsigned char *)"\000\000\000\000\000\000\000\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l78;  if (!yy_BEGIN(ctx)) goto l90;  yyDo(ctx, yy_8_primary, ctx->begin, ctx->end);  goto l79;
+  l90:;	  ctx->pos= yypos79; ctx->thunkpos= yythunkpos79;
+  l78:;	  if (!yyfirst(yyc80, (unsigned char *)"\000\000\000\000\000\000\000\100\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l69;  if (!yy_END(ctx)) goto l69;  yyDo(ctx, yy_9_primary, ctx->begin, ctx->end);
   }
-  l53:;	
+  l79:;	
   yyprintf((stderr, "  ok   %s @ %s\n", "primary", ctx->buf+ctx->pos));
   return 1;
-  l52:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l69:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "primary", ctx->buf+ctx->pos));
   return 0;
 }
 YY_RULE(int) yy_NOT(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
-  yyprintf((stderr, "%s\n", "NOT"));  if (!yymatchChar(ctx, '!')) goto l64;  if (!yy__(ctx)) goto l64;
+  yyprintf((stderr, "%s\n", "NOT"));  if (!yymatchChar(ctx, '!')) goto l91;  if (!yy__(ctx)) goto l91;
   yyprintf((stderr, "  ok   %s @ %s\n", "NOT", ctx->buf+ctx->pos));
   return 1;
-  l64:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l91:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "NOT", ctx->buf+ctx->pos));
   return 0;
 }
 YY_RULE(int) yy_suffix(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
-  yyprintf((stderr, "%s\n", "suffix"));  if (!yy_primary(ctx)) goto l65;
-  {  int yypos66= ctx->pos, yythunkpos66= ctx->thunkpos;
-  {  int yypos68= ctx->pos, yythunkpos68= ctx->thunkpos;  if (!yy_QUESTION(ctx)) goto l69;  yyDo(ctx, yy_1_suffix, ctx->begin, ctx->end);  goto l68;
-  l69:;	  ctx->pos= yypos68; ctx->thunkpos= yythunkpos68;  if (!yy_STAR(ctx)) goto l70;  yyDo(ctx, yy_2_suffix, ctx->begin, ctx->end);  goto l68;
-  l70:;	  ctx->pos= yypos68; ctx->thunkpos= yythunkpos68;  if (!yy_PLUS(ctx)) goto l66;  yyDo(ctx, yy_3_suffix, ctx->begin, ctx->end);
+  yyprintf((stderr, "%s\n", "suffix"));  if (!yy_primary(ctx)) goto l92;
+  {  int yypos93= ctx->pos, yythunkpos93= ctx->thunkpos;
+  {  int yypos98= ctx->pos, yythunkpos98= ctx->thunkpos;  int yyc99= yypeek(ctx);
+  switch (yyc99)
+    {
+     case 63:  goto l95;
+     case 42:  goto l96;
+     case 43:  goto l97;
+    default:  goto l93;
+    }
+  l95:;	  if (!yy_QUESTION(ctx)) goto l100;  yyDo(ctx, yy_1_suffix, ctx->begin, ctx->end);  goto l98;
+  l100:;	  ctx->pos= yypos98; ctx->thunkpos= yythunkpos98;
+  l96:;	  if (!yyfirst(yyc99, (unsigned char *)"\000\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l97;  if (!yy_STAR(ctx)) goto l101;  yyDo(ctx, yy_2_suffix, ctx->begin, ctx->end);  goto l98;
+  l101:;	  ctx->pos= yypos98; ctx->thunkpos= yythunkpos98;
+  l97:;	  if (!yyfirst(yyc99, (unsigned char *)"\000\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l93;  if (!yy_PLUS(ctx)) goto l93;  yyDo(ctx, yy_3_suffix, ctx->begin, ctx->end);
   }
-  l68:;	  goto l67;
-  l66:;	  ctx->pos= yypos66; ctx->thunkpos= yythunkpos66;
+  l98:;	  goto l94;
+  l93:;	  ctx->pos= yypos93; ctx->thunkpos= yythunkpos93;
   }
-  l67:;	
+  l94:;	
   yyprintf((stderr, "  ok   %s @ %s\n", "suffix", ctx->buf+ctx->pos));
   return 1;
-  l65:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l92:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "suffix", ctx->buf+ctx->pos));
   return 0;
 }
 YY_RULE(int) yy_action(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
-  yyprintf((stderr, "%s\n", "action"));  if (!yymatchChar(ctx, '{')) goto l71;  yyText(ctx, ctx->begin, ctx->end);  if (!(YY_BEGIN)) goto l71;
-  l72:;	
-  {  int yypos73= ctx->pos, yythunkpos73= ctx->thunkpos;  if (!yy_braces(ctx)) goto l73;  goto l72;
-  l73:;	  ctx->pos= yypos73; ctx->thunkpos= yythunkpos73;
-  }  yyText(ctx, ctx->begin, ctx->end);  if (!(YY_END)) goto l71;  if (!yymatchChar(ctx, '}')) goto l71;  if (!yy__(ctx)) goto l71;
+  yyprintf((stderr, "%s\n", "action"));  if (!yymatchChar(ctx, '{')) goto l102;  if (!(YY_BEGIN)) goto l102;
+  l103:;	
+  {  int yypos104= ctx->pos, yythunkpos104= ctx->thunkpos;  if (!yy_braces(ctx)) goto l104;  goto l103;
+  l104:;	  ctx->pos= yypos104; ctx->thunkpos= yythunkpos104;
+  }  if (!(YY_END)) goto l102;  if (!yymatchChar(ctx, '}')) goto l102;  if (!yy__(ctx)) goto l102;
   yyprintf((stderr, "  ok   %s @ %s\n", "action", ctx->buf+ctx->pos));
   return 1;
-  l71:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l102:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "action", ctx->buf+ctx->pos));
   return 0;
 }
 YY_RULE(int) yy_AND(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
-  yyprintf((stderr, "%s\n", "AND"));  if (!yymatchChar(ctx, '&')) goto l74;  if (!yy__(ctx)) goto l74;
+  yyprintf((stderr, "%s\n", "AND"));  if (!yymatchChar(ctx, '&')) goto l105;  if (!yy__(ctx)) goto l105;
   yyprintf((stderr, "  ok   %s @ %s\n", "AND", ctx->buf+ctx->pos));
   return 1;
-  l74:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l105:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "AND", ctx->buf+ctx->pos));
   return 0;
 }
 YY_RULE(int) yy_prefix(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
   yyprintf((stderr, "%s\n", "prefix"));
-  {  int yypos76= ctx->pos, yythunkpos76= ctx->thunkpos;  if (!yy_AND(ctx)) goto l77;  if (!yy_action(ctx)) goto l77;  yyDo(ctx, yy_1_prefix, ctx->begin, ctx->end);  goto l76;
-  l77:;	  ctx->pos= yypos76; ctx->thunkpos= yythunkpos76;  if (!yy_AND(ctx)) goto l78;  if (!yy_suffix(ctx)) goto l78;  yyDo(ctx, yy_2_prefix, ctx->begin, ctx->end);  goto l76;
-  l78:;	  ctx->pos= yypos76; ctx->thunkpos= yythunkpos76;  if (!yy_NOT(ctx)) goto l79;  if (!yy_suffix(ctx)) goto l79;  yyDo(ctx, yy_3_prefix, ctx->begin, ctx->end);  goto l76;
-  l79:;	  ctx->pos= yypos76; ctx->thunkpos= yythunkpos76;  if (!yy_suffix(ctx)) goto l75;
+  {  int yypos111= ctx->pos, yythunkpos111= ctx->thunkpos;  int yyc112= yypeek(ctx);
+  switch (yyc112)
+    {
+     case 38:  goto l107;
+     case 33:  goto l109;
+     case 34: case 39: case 40: case 45: case 46: case 60: case 62: case 65:
+     case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73:
+     case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81:
+     case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89:
+     case 90: case 91: case 95: case 97: case 98: case 99: case 100: case 101:
+     case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109:
+     case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117:
+     case 118: case 119: case 120: case 121: case 122: case 123:  goto l110;
+    default:  goto l106;
+    }
+  l107:;	  if (!yy_AND(ctx)) goto l113;  if (!yy_action(ctx)) goto l113;  yyDo(ctx, yy_1_prefix, ctx->begin, ctx->end);  goto l111;
+  l113:;	  ctx->pos= yypos111; ctx->thunkpos= yythunkpos111;  if (!yyfirst(yyc112, (unsigned char *)"\000\000\000\000\100\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l109;  if (!yy_AND(ctx)) goto l114;  if (!yy_suffix(ctx)) goto l114;  yyDo(ctx, yy_2_prefix, ctx->begin, ctx->end);  goto l111;
+  l114:;	  ctx->pos= yypos111; ctx->thunkpos= yythunkpos111;
+  l109:;	  if (!yyfirst(yyc112, (unsigned char *)"\000\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l110;  if (!yy_NOT(ctx)) goto l115;  if (!yy_suffix(ctx)) goto l115;  yyDo(ctx, yy_3_prefix, ctx->begin, ctx->end);  goto l111;
+  l115:;	  ctx->pos= yypos111; ctx->thunkpos= yythunkpos111;
+  l110:;	  if (!yyfirst(yyc112, (unsigned char *)"\000\000\000\000\204\141\000\120\376\377\377\217\376\377\377\017\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l106;  if (!yy_suffix(ctx)) goto l106;
   }
-  l76:;	
+  l111:;	
   yyprintf((stderr, "  ok   %s @ %s\n", "prefix", ctx->buf+ctx->pos));
   return 1;
-  l75:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l106:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "prefix", ctx->buf+ctx->pos));
   return 0;
 }
 YY_RULE(int) yy_BAR(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
-  yyprintf((stderr, "%s\n", "BAR"));  if (!yymatchChar(ctx, '|')) goto l80;  if (!yy__(ctx)) goto l80;
+  yyprintf((stderr, "%s\n", "BAR"));  if (!yymatchChar(ctx, '|')) goto l116;  if (!yy__(ctx)) goto l116;
   yyprintf((stderr, "  ok   %s @ %s\n", "BAR", ctx->buf+ctx->pos));
   return 1;
-  l80:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l116:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "BAR", ctx->buf+ctx->pos));
   return 0;
 }
 YY_RULE(int) yy_sequence(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
-  yyprintf((stderr, "%s\n", "sequence"));  if (!yy_prefix(ctx)) goto l81;
-  l82:;	
-  {  int yypos83= ctx->pos, yythunkpos83= ctx->thunkpos;  if (!yy_prefix(ctx)) goto l83;  yyDo(ctx, yy_1_sequence, ctx->begin, ctx->end);  goto l82;
-  l83:;	  ctx->pos= yypos83; ctx->thunkpos= yythunkpos83;
+  yyprintf((stderr, "%s\n", "sequence"));  if (!yy_prefix(ctx)) goto l117;
+  l118:;	
+  {  int yypos119= ctx->pos, yythunkpos119= ctx->thunkpos;  if (!yy_prefix(ctx)) goto l119;  yyDo(ctx, yy_1_sequence, ctx->begin, ctx->end);  goto l118;
+  l119:;	  ctx->pos= yypos119; ctx->thunkpos= yythunkpos119;
   }
   yyprintf((stderr, "  ok   %s @ %s\n", "sequence", ctx->buf+ctx->pos));
   return 1;
-  l81:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l117:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "sequence", ctx->buf+ctx->pos));
   return 0;
 }
 YY_RULE(int) yy_SEMICOLON(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
-  yyprintf((stderr, "%s\n", "SEMICOLON"));  if (!yymatchChar(ctx, ';')) goto l84;  if (!yy__(ctx)) goto l84;
+  yyprintf((stderr, "%s\n", "SEMICOLON"));  if (!yymatchChar(ctx, ';')) goto l120;  if (!yy__(ctx)) goto l120;
   yyprintf((stderr, "  ok   %s @ %s\n", "SEMICOLON", ctx->buf+ctx->pos));
   return 1;
-  l84:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l120:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "SEMICOLON", ctx->buf+ctx->pos));
   return 0;
 }
 YY_RULE(int) yy_expression(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
-  yyprintf((stderr, "%s\n", "expression"));  if (!yy_sequence(ctx)) goto l85;
-  l86:;	
-  {  int yypos87= ctx->pos, yythunkpos87= ctx->thunkpos;  if (!yy_BAR(ctx)) goto l87;  if (!yy_sequence(ctx)) goto l87;  yyDo(ctx, yy_1_expression, ctx->begin, ctx->end);  goto l86;
-  l87:;	  ctx->pos= yypos87; ctx->thunkpos= yythunkpos87;
+  yyprintf((stderr, "%s\n", "expression"));  if (!yy_sequence(ctx)) goto l121;
+  l122:;	
+  {  int yypos123= ctx->pos, yythunkpos123= ctx->thunkpos;  if (!yy_BAR(ctx)) goto l123;  if (!yy_sequence(ctx)) goto l123;  yyDo(ctx, yy_1_expression, ctx->begin, ctx->end);  goto l122;
+  l123:;	  ctx->pos= yypos123; ctx->thunkpos= yythunkpos123;
   }
   yyprintf((stderr, "  ok   %s @ %s\n", "expression", ctx->buf+ctx->pos));
   return 1;
-  l85:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l121:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "expression", ctx->buf+ctx->pos));
   return 0;
 }
 YY_RULE(int) yy_EQUAL(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
-  yyprintf((stderr, "%s\n", "EQUAL"));  if (!yymatchChar(ctx, '=')) goto l88;  if (!yy__(ctx)) goto l88;
+  yyprintf((stderr, "%s\n", "EQUAL"));  if (!yymatchChar(ctx, '=')) goto l124;  if (!yy__(ctx)) goto l124;
   yyprintf((stderr, "  ok   %s @ %s\n", "EQUAL", ctx->buf+ctx->pos));
   return 1;
-  l88:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l124:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "EQUAL", ctx->buf+ctx->pos));
   return 0;
 }
 YY_RULE(int) yy_identifier(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
-  yyprintf((stderr, "%s\n", "identifier"));  yyText(ctx, ctx->begin, ctx->end);  if (!(YY_BEGIN)) goto l89;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\040\000\000\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l89;
-  l90:;	
-  {  int yypos91= ctx->pos, yythunkpos91= ctx->thunkpos;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\040\377\003\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l91;  goto l90;
-  l91:;	  ctx->pos= yypos91; ctx->thunkpos= yythunkpos91;
-  }  yyText(ctx, ctx->begin, ctx->end);  if (!(YY_END)) goto l89;  if (!yy__(ctx)) goto l89;
+  yyprintf((stderr, "%s\n", "identifier"));  if (!(YY_BEGIN)) goto l125;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\040\000\000\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l125;
+  l126:;	
+  {  int yypos127= ctx->pos, yythunkpos127= ctx->thunkpos;  if (!yymatchClass(ctx, (unsigned char *)"\000\000\000\000\000\040\377\003\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l127;  goto l126;
+  l127:;	  ctx->pos= yypos127; ctx->thunkpos= yythunkpos127;
+  }  if (!(YY_END)) goto l125;  if (!yy__(ctx)) goto l125;
   yyprintf((stderr, "  ok   %s @ %s\n", "identifier", ctx->buf+ctx->pos));
   return 1;
-  l89:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l125:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "identifier", ctx->buf+ctx->pos));
   return 0;
 }
+YY_RULE(int) yy_MEMO(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "MEMO"));  if (!yymatchString(ctx, "%memo")) goto l128;  if (!yy__(ctx)) goto l128;
+  yyprintf((stderr, "  ok   %s @ %s\n", "MEMO", ctx->buf+ctx->pos));
+  return 1;
+  l128:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "MEMO", ctx->buf+ctx->pos));
+  return 0;
+}
 YY_RULE(int) yy_RPERCENT(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
-  yyprintf((stderr, "%s\n", "RPERCENT"));  if (!yymatchString(ctx, "%}")) goto l92;  if (!yy__(ctx)) goto l92;
+  yyprintf((stderr, "%s\n", "RPERCENT"));  if (!yymatchString(ctx, "%}")) goto l129;  if (!yy__(ctx)) goto l129;
   yyprintf((stderr, "  ok   %s @ %s\n", "RPERCENT", ctx->buf+ctx->pos));
   return 1;
-  l92:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l129:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "RPERCENT", ctx->buf+ctx->pos));
   return 0;
 }
 YY_RULE(int) yy_end_of_file(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
   yyprintf((stderr, "%s\n", "end_of_file"));
-  {  int yypos94= ctx->pos, yythunkpos94= ctx->thunkpos;  if (!yymatchDot(ctx)) goto l94;  goto l93;
-  l94:;	  ctx->pos= yypos94; ctx->thunkpos= yythunkpos94;
+  {  int yypos131= ctx->pos, yythunkpos131= ctx->thunkpos;  if (!yymatchDot(ctx)) goto l131;  goto l130;
+  l131:;	  ctx->pos= yypos131; ctx->thunkpos= yythunkpos131;
   }
   yyprintf((stderr, "  ok   %s @ %s\n", "end_of_file", ctx->buf+ctx->pos));
   return 1;
-  l93:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l130:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "end_of_file", ctx->buf+ctx->pos));
   return 0;
 }
 YY_RULE(int) yy_trailer(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
-  yyprintf((stderr, "%s\n", "trailer"));  if (!yymatchString(ctx, "%%")) goto l95;  yyText(ctx, ctx->begin, ctx->end);  if (!(YY_BEGIN)) goto l95;
-  l96:;	
-  {  int yypos97= ctx->pos, yythunkpos97= ctx->thunkpos;  if (!yymatchDot(ctx)) goto l97;  goto l96;
-  l97:;	  ctx->pos= yypos97; ctx->thunkpos= yythunkpos97;
-  }  yyText(ctx, ctx->begin, ctx->end);  if (!(YY_END)) goto l95;  yyDo(ctx, yy_1_trailer, ctx->begin, ctx->end);
+  yyprintf((stderr, "%s\n", "trailer"));  if (!yymatchString(ctx, "%%")) goto l132;  if (!(YY_BEGIN)) goto l132;
+  l133:;	
+  {  int yypos134= ctx->pos, yythunkpos134= ctx->thunkpos;  if (!yymatchDot(ctx)) goto l134;  goto l133;
+  l134:;	  ctx->pos= yypos134; ctx->thunkpos= yythunkpos134;
+  }  if (!(YY_END)) goto l132;  yyDo(ctx, yy_1_trailer, ctx->begin, ctx->end);
   yyprintf((stderr, "  ok   %s @ %s\n", "trailer", ctx->buf+ctx->pos));
   return 1;
-  l95:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l132:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "trailer", ctx->buf+ctx->pos));
   return 0;
 }
 YY_RULE(int) yy_definition(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
-  yyprintf((stderr, "%s\n", "definition"));  if (!yy_identifier(ctx)) goto l98;  yyDo(ctx, yy_1_definition, ctx->begin, ctx->end);  if (!yy_EQUAL(ctx)) goto l98;  if (!yy_expression(ctx)) goto l98;  yyDo(ctx, yy_2_definition, ctx->begin, ctx->end);
-  {  int yypos99= ctx->pos, yythunkpos99= ctx->thunkpos;  if (!yy_SEMICOLON(ctx)) goto l99;  goto l100;
-  l99:;	  ctx->pos= yypos99; ctx->thunkpos= yythunkpos99;
+  yyprintf((stderr, "%s\n", "definition"));  if (!yy_identifier(ctx)) goto l135;  yyDo(ctx, yy_1_definition, ctx->begin, ctx->end);  if (!yy_EQUAL(ctx)) goto l135;  if (!yy_expression(ctx)) goto l135;  yyDo(ctx, yy_2_definition, ctx->begin, ctx->end);
+  {  int yypos136= ctx->pos, yythunkpos136= ctx->thunkpos;  if (!yy_SEMICOLON(ctx)) goto l136;  goto l137;
+  l136:;	  ctx->pos= yypos136; ctx->thunkpos= yythunkpos136;
   }
-  l100:;	
+  l137:;	
   yyprintf((stderr, "  ok   %s @ %s\n", "definition", ctx->buf+ctx->pos));
   return 1;
-  l98:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l135:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "definition", ctx->buf+ctx->pos));
   return 0;
 }
+YY_RULE(int) yy_memoization(yycontext *ctx)
+{  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
+  yyprintf((stderr, "%s\n", "memoization"));  if (!yy_MEMO(ctx)) goto l138;  if (!yy_identifier(ctx)) goto l138;
+  {  int yypos141= ctx->pos, yythunkpos141= ctx->thunkpos;  if (!yy_EQUAL(ctx)) goto l141;  goto l138;
+  l141:;	  ctx->pos= yypos141; ctx->thunkpos= yythunkpos141;
+  }  yyDo(ctx, yy_1_memoization, ctx->begin, ctx->end);
+  l139:;	
+  {  int yypos140= ctx->pos, yythunkpos140= ctx->thunkpos;  if (!yy_identifier(ctx)) goto l140;
+  {  int yypos142= ctx->pos, yythunkpos142= ctx->thunkpos;  if (!yy_EQUAL(ctx)) goto l142;  goto l140;
+  l142:;	  ctx->pos= yypos142; ctx->thunkpos= yythunkpos142;
+  }  yyDo(ctx, yy_1_memoization, ctx->begin, ctx->end);  goto l139;
+  l140:;	  ctx->pos= yypos140; ctx->thunkpos= yythunkpos140;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "memoization", ctx->buf+ctx->pos));
+  return 1;
+  l138:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "memoization", ctx->buf+ctx->pos));
+  return 0;
+}
 YY_RULE(int) yy_declaration(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
-  yyprintf((stderr, "%s\n", "declaration"));  if (!yymatchString(ctx, "%{")) goto l101;  yyText(ctx, ctx->begin, ctx->end);  if (!(YY_BEGIN)) goto l101;
-  l102:;	
-  {  int yypos103= ctx->pos, yythunkpos103= ctx->thunkpos;
-  {  int yypos104= ctx->pos, yythunkpos104= ctx->thunkpos;  if (!yymatchString(ctx, "%}")) goto l104;  goto l103;
-  l104:;	  ctx->pos= yypos104; ctx->thunkpos= yythunkpos104;
-  }  if (!yymatchDot(ctx)) goto l103;  goto l102;
-  l103:;	  ctx->pos= yypos103; ctx->thunkpos= yythunkpos103;
-  }  yyText(ctx, ctx->begin, ctx->end);  if (!(YY_END)) goto l101;  if (!yy_RPERCENT(ctx)) goto l101;  yyDo(ctx, yy_1_declaration, ctx->begin, ctx->end);
+  yyprintf((stderr, "%s\n", "declaration"));  if (!yymatchString(ctx, "%{")) goto l143;  if (!(YY_BEGIN)) goto l143;
+  l144:;	
+  {  int yypos145= ctx->pos, yythunkpos145= ctx->thunkpos;
+  {  int yypos146= ctx->pos, yythunkpos146= ctx->thunkpos;  if (!yymatchString(ctx, "%}")) goto l146;  goto l145;
+  l146:;	  ctx->pos= yypos146; ctx->thunkpos= yythunkpos146;
+  }  if (!yymatchDot(ctx)) goto l145;  goto l144;
+  l145:;	  ctx->pos= yypos145; ctx->thunkpos= yythunkpos145;
+  }  if (!(YY_END)) goto l143;  if (!yy_RPERCENT(ctx)) goto l143;  yyDo(ctx, yy_1_declaration, ctx->begin, ctx->end);
   yyprintf((stderr, "  ok   %s @ %s\n", "declaration", ctx->buf+ctx->pos));
   return 1;
-  l101:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l143:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "declaration", ctx->buf+ctx->pos));
   return 0;
 }
 YY_RULE(int) yy__(yycontext *ctx)
 {
   yyprintf((stderr, "%s\n", "_"));
-  l106:;	
-  {  int yypos107= ctx->pos, yythunkpos107= ctx->thunkpos;
-  {  int yypos108= ctx->pos, yythunkpos108= ctx->thunkpos;  if (!yy_space(ctx)) goto l109;  goto l108;
-  l109:;	  ctx->pos= yypos108; ctx->thunkpos= yythunkpos108;  if (!yy_comment(ctx)) goto l107;
+  l148:;	
+  {  int yypos149= ctx->pos, yythunkpos149= ctx->thunkpos;
+  {  int yypos152= ctx->pos, yythunkpos152= ctx->thunkpos;  int yyc153= yypeek(ctx);
+  switch (yyc153)
+    {
+     case 9: case 10: case 13: case 32:  goto l150;
+     case 35:  goto l151;
+    default:  goto l149;
+    }
+  l150:;	  if (!yy_space(ctx)) goto l154;  goto l152;
+  l154:;	  ctx->pos= yypos152; ctx->thunkpos= yythunkpos152;
+  l151:;	  if (!yyfirst(yyc153, (unsigned char *)"\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l149;  if (!yy_comment(ctx)) goto l149;
   }
-  l108:;	  goto l106;
-  l107:;	  ctx->pos= yypos107; ctx->thunkpos= yythunkpos107;
+  l152:;	  goto l148;
+  l149:;	  ctx->pos= yypos149; ctx->thunkpos= yythunkpos149;
   }
   yyprintf((stderr, "  ok   %s @ %s\n", "_", ctx->buf+ctx->pos));
   return 1;
 }
 YY_RULE(int) yy_grammar(yycontext *ctx)
 {  int yypos0= ctx->pos, yythunkpos0= ctx->thunkpos;
-  yyprintf((stderr, "%s\n", "grammar"));  if (!yy__(ctx)) goto l110;
-  {  int yypos113= ctx->pos, yythunkpos113= ctx->thunkpos;  if (!yy_declaration(ctx)) goto l114;  goto l113;
-  l114:;	  ctx->pos= yypos113; ctx->thunkpos= yythunkpos113;  if (!yy_definition(ctx)) goto l110;
+  yyprintf((stderr, "%s\n", "grammar"));  if (!yy__(ctx)) goto l155;
+  {  int yypos161= ctx->pos, yythunkpos161= ctx->thunkpos;  int yyc162= yypeek(ctx);
+  switch (yyc162)
+    {
+     case 37:  goto l158;
+     case 45: case 65: case 66: case 67: case 68: case 69: case 70: case 71:
+     case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79:
+     case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87:
+     case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100:
+     case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108:
+     case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116:
+     case 117: case 118: case 119: case 120: case 121: case 122:  goto l160;
+    default:  goto l155;
+    }
+  l158:;	  if (!yy_declaration(ctx)) goto l163;  goto l161;
+  l163:;	  ctx->pos= yypos161; ctx->thunkpos= yythunkpos161;  if (!yyfirst(yyc162, (unsigned char *)"\000\000\000\000\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l160;  if (!yy_memoization(ctx)) goto l164;  goto l161;
+  l164:;	  ctx->pos= yypos161; ctx->thunkpos= yythunkpos161;
+  l160:;	  if (!yyfirst(yyc162, (unsigned char *)"\000\000\000\000\000\040\000\000\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l155;  if (!yy_definition(ctx)) goto l155;
   }
-  l113:;	
-  l111:;	
-  {  int yypos112= ctx->pos, yythunkpos112= ctx->thunkpos;
-  {  int yypos115= ctx->pos, yythunkpos115= ctx->thunkpos;  if (!yy_declaration(ctx)) goto l116;  goto l115;
-  l116:;	  ctx->pos= yypos115; ctx->thunkpos= yythunkpos115;  if (!yy_definition(ctx)) goto l112;
+  l161:;	
+  l156:;	
+  {  int yypos157= ctx->pos, yythunkpos157= ctx->thunkpos;
+  {  int yypos168= ctx->pos, yythunkpos168= ctx->thunkpos;  int yyc169= yypeek(ctx);
+  switch (yyc169)
+    {
+     case 37:  goto l165;
+     case 45: case 65: case 66: case 67: case 68: case 69: case 70: case 71:
+     case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79:
+     case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87:
+     case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100:
+     case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108:
+     case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116:
+     case 117: case 118: case 119: case 120: case 121: case 122:  goto l167;
+    default:  goto l157;
+    }
+  l165:;	  if (!yy_declaration(ctx)) goto l170;  goto l168;
+  l170:;	  ctx->pos= yypos168; ctx->thunkpos= yythunkpos168;  if (!yyfirst(yyc169, (unsigned char *)"\000\000\000\000\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l167;  if (!yy_memoization(ctx)) goto l171;  goto l168;
+  l171:;	  ctx->pos= yypos168; ctx->thunkpos= yythunkpos168;
+  l167:;	  if (!yyfirst(yyc169, (unsigned char *)"\000\000\000\000\000\040\000\000\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l157;  if (!yy_definition(ctx)) goto l157;
   }
-  l115:;	  goto l111;
-  l112:;	  ctx->pos= yypos112; ctx->thunkpos= yythunkpos112;
+  l168:;	  goto l156;
+  l157:;	  ctx->pos= yypos157; ctx->thunkpos= yythunkpos157;
   }
-  {  int yypos117= ctx->pos, yythunkpos117= ctx->thunkpos;  if (!yy_trailer(ctx)) goto l117;  goto l118;
-  l117:;	  ctx->pos= yypos117; ctx->thunkpos= yythunkpos117;
+  {  int yypos172= ctx->pos, yythunkpos172= ctx->thunkpos;  if (!yy_trailer(ctx)) goto l172;  goto l173;
+  l172:;	  ctx->pos= yypos172; ctx->thunkpos= yythunkpos172;
   }
-  l118:;	  if (!yy_end_of_file(ctx)) goto l110;
+  l173:;	  if (!yy_end_of_file(ctx)) goto l155;
   yyprintf((stderr, "  ok   %s @ %s\n", "grammar", ctx->buf+ctx->pos));
   return 1;
-  l110:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
+  l155:;	  ctx->pos= yypos0; ctx->thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "grammar", ctx->buf+ctx->pos));
   return 0;
 }
@@ -1032,25 +1590,69 @@ typedef int (*yyrule)(yycontext *ctx);
 YY_PARSE(int) YYPARSEFROM(YY_CTX_PARAM_ yyrule yystart)
 {
   int yyok;
-  if (!yyctx->buflen)
+  if (!yyctx->textlen)
     {
+#ifndef YY_BUFFER_INPUT
+      yyctx->buf= (char *)YY_MALLOC(yyctx, 1024);
+      yyctx->pos= yyctx->limit= 0;
+#endif
+      yyctx->text= (char *)YY_MALLOC(yyctx, 1024);
+      yyctx->thunks= (yythunk *)YY_MALLOC(yyctx, sizeof(yythunk) * 32);
+      yyctx->vals= (YYSTYPE *)YY_MALLOC(yyctx, sizeof(YYSTYPE) * 32);
+#if YYMEMOCOUNT
+      yyctx->memos= (yymemo *)YY_MALLOC(yyctx, sizeof(yymemo) * YY_MEMO_SIZE);
+      yyctx->shared= yyctx->spare= yyctx->mark= 0;
+#endif
+      if (!yyctx->text || !yyctx->thunks || !yyctx->vals
+#ifndef YY_BUFFER_INPUT
+	  || !yyctx->buf
+#endif
+#if YYMEMOCOUNT
+	  || !yyctx->memos
+#endif
+	  )
+	{
+#ifndef YY_BUFFER_INPUT
+	  YY_FREE(yyctx, yyctx->buf);
+#endif
+	  YY_FREE(yyctx, yyctx->text);
+	  YY_FREE(yyctx, yyctx->thunks);
+	  YY_FREE(yyctx, yyctx->vals);
+#if YYMEMOCOUNT
+	  YY_FREE(yyctx, yyctx->memos);
+#endif
+	  return 0;
+	}
+#ifndef YY_BUFFER_INPUT
       yyctx->buflen= 1024;
-      yyctx->buf= (char *)malloc(yyctx->buflen);
+#endif
+#if YYMEMOCOUNT
+      memset(yyctx->memos, 0, sizeof(yymemo) * YY_MEMO_SIZE);
+      yyctx->memosize= YY_MEMO_SIZE;
+      yyctx->memobytes= sizeof(yymemo) * YY_MEMO_SIZE;
+      yyctx->sharedbytes= 0;
+#endif
       yyctx->textlen= 1024;
-      yyctx->text= (char *)malloc(yyctx->textlen);
       yyctx->thunkslen= 32;
-      yyctx->thunks= (yythunk *)malloc(sizeof(yythunk) * yyctx->thunkslen);
       yyctx->valslen= 32;
-      yyctx->vals= (YYSTYPE *)malloc(sizeof(YYSTYPE) * yyctx->valslen);
-      yyctx->begin= yyctx->end= yyctx->pos= yyctx->limit= yyctx->thunkpos= 0;
+      yyctx->begin= yyctx->end= yyctx->thunkpos= 0;
     }
+#if YYMEMOCOUNT
+  ++yyctx->memogen;
+  yyctx->marked= 0;
+  yyctx->memokeep= 0;
+  yyctx->keptbytes= 0;
+  yyctx->keptfrom= yyctx->keptto= -1;
+  yyctx->memodepth= 0;
+#endif
+  yyctx->nomem= 0;
   yyctx->begin= yyctx->end= yyctx->pos;
   yyctx->thunkpos= 0;
   yyctx->val= yyctx->vals;
   yyok= yystart(yyctx);
-  if (yyok) yyDone(yyctx);
+  if (yyok && !yyctx->nomem) yyDone(yyctx);
   yyCommit(yyctx);
-  return yyok;
+  return yyok && !yyctx->nomem;
 }
 
 YY_PARSE(int) YYPARSE(YY_CTX_PARAM)
@@ -1058,6 +1660,53 @@ YY_PARSE(int) YYPARSE(YY_CTX_PARAM)
   return YYPARSEFROM(YY_CTX_ARG_ yy_grammar);
 }
 
+#ifdef YY_BUFFER_INPUT
+YY_PARSE(void) YYSETBUFFER(YY_CTX_PARAM_ char *yybuffer, int yylength)
+{
+  yyctx->buf= yybuffer;
+  yyctx->limit= yylength;
+  yyctx->begin= yyctx->end= yyctx->pos= yyctx->thunkpos= 0;
+}
+#endif
+
+YY_PARSE(void) YYRELEASE(YY_CTX_PARAM)
+{
+  if (yyctx->buflen)
+    {
+      yyctx->buflen= 0;
+      YY_FREE(yyctx, yyctx->buf);
+    }
+  if (yyctx->textlen)
+    {
+      yyctx->textlen= 0;
+      YY_FREE(yyctx, yyctx->text);
+      YY_FREE(yyctx, yyctx->thunks);
+      YY_FREE(yyctx, yyctx->vals);
+#if YYMEMOCOUNT
+      {
+	yyshared *s, *next;
+	int i;
+	for (i= 0;  i < yyctx->memosize;  ++i)
+	  YY_FREE(yyctx, yyctx->memos[i].thunks);
+	YY_FREE(yyctx, yyctx->memos);
+	for (s= yyctx->shared;  s;  s= next)
+	  {
+	    next= s->next;
+	    YY_FREE(yyctx, s->thunks);
+	    YY_FREE(yyctx, s);
+	  }
+	for (s= yyctx->spare;  s;  s= next)
+	  {
+	    next= s->next;
+	    YY_FREE(yyctx, s->thunks);
+	    YY_FREE(yyctx, s);
+	  }
+	yyctx->shared= yyctx->spare= yyctx->mark= 0;
+      }
+#endif
+    }
+}
+
 #endif
 
 
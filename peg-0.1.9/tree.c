@@ -32,6 +32,7 @@ FILE *output= 0;
 
 int actionCount= 0;
 int ruleCount= 0;
+int memoCount= 0;
 int lastToken= -1;
 
 static inline Node *_newNode(int type, int size)
@@ -86,6 +87,17 @@ void Rule_setExpression(Node *node, Node *expression)
     start= node;
 }
 
+Node *Rule_beMemoized(Node *rule)
+{
+  assert(Rule == rule->type);
+  if (!(RuleMemo & rule->rule.flags))
+    {
+      rule->rule.flags |= RuleMemo;
+      rule->rule.memo= memoCount++;
+    }
+  return rule;
+}
+
 Node *makeVariable(char *name)
 {
   Node *node;
@@ -341,6 +353,8 @@ static void Rule_fprint(FILE *stream, Node *node)
 {
   assert(node);
   assert(Rule == node->type);
+  if (RuleMemo & node->rule.flags)
+    fprintf(stream, "%%memo %s\n", node->rule.name);
   fprintf(stream, "%s.%d =", node->rule.name, node->rule.id);
   if (node->rule.expression)
     Node_fprint(stream, node->rule.expression);
@@ -23,11 +23,12 @@ enum { Unknown= 0, Rule, Variable, Name, Dot, Character, String, Class, Action,
 enum {
   RuleUsed	= 1<<0,
   RuleReached	= 1<<1,
+  RuleMemo	= 1<<2,
 };
 
 typedef union Node Node;
 
-struct Rule	 { int type;  Node *next;   char *name;	 Node *variables;  Node *expression;  int id;  int flags;	};
+struct Rule	 { int type;  Node *next;   char *name;	 Node *variables;  Node *expression;  int id;  int flags;  int memo;	};
 struct Variable	 { int type;  Node *next;   char *name;  Node *value;  int offset;					};
 struct Name	 { int type;  Node *next;   Node *rule;  Node *variable;						};
 struct Dot	 { int type;  Node *next;										};
@@ -72,6 +73,7 @@ extern Node *rules;
 extern Node *start;
 
 extern int   ruleCount;
+extern int   memoCount;
 
 extern FILE *output;
 
@@ -80,6 +82,7 @@ extern Node *findRule(char *name);
 extern Node *beginRule(Node *rule);
 extern void  Rule_setExpression(Node *rule, Node *expression);
 extern Node *Rule_beToken(Node *rule);
+extern Node *Rule_beMemoized(Node *rule);
 extern Node *makeVariable(char *name);
 extern Node *makeName(Node *rule);
 extern Node *makeDot(void);
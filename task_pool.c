@@ -0,0 +1,177 @@
+/**********************************************************************
+
+  task_pool.c - A work-stealing pool of threads.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License or the MIT
+  license.  See LICENSE for details.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+ ***********************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "task_pool.h"
+
+/* Tasks are whole blocks to be parsed, so a single lock guarding all
+ * the deques is cheap next to the work done per task. */
+
+struct task_deque {
+    void  **tasks;
+    int     top;        /* Oldest task, taken by thieves. */
+    int     bottom;     /* One past the newest task, taken by the owner. */
+    int     size;
+};
+
+struct task_pool {
+    pthread_mutex_t     lock;
+    pthread_cond_t      wake;       /* Signalled when a task is pushed or all are done. */
+    int                 workers;
+    struct task_deque  *deques;
+    int                 pending;    /* Tasks pushed and not yet finished. */
+    task_func           func;
+    void               *data;
+};
+
+struct task_worker {
+    task_pool  *pool;
+    int         worker;
+};
+
+task_pool * task_pool_new(int workers, task_func func, void *data) {
+    task_pool *pool;
+    if (workers < 1)
+        workers = 1;
+    pool = malloc(sizeof(task_pool));
+    if (pool == NULL)
+        return NULL;
+    pool->deques = malloc(workers * sizeof(struct task_deque));
+    if (pool->deques == NULL) {
+        free(pool);
+        return NULL;
+    }
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    pool->workers = workers;
+    memset(pool->deques, 0, workers * sizeof(struct task_deque));
+    pool->pending = 0;
+    pool->func = func;
+    pool->data = data;
+    return pool;
+}
+
+void task_pool_free(task_pool *pool) {
+    int i;
+    for (i = 0; i < pool->workers; i++)
+        free(pool->deques[i].tasks);
+    free(pool->deques);
+    pthread_cond_destroy(&pool->wake);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool);
+}
+
+void task_pool_push(task_pool *pool, int worker, void *task) {
+    struct task_deque *d;
+    void **tasks;
+    pthread_mutex_lock(&pool->lock);
+    d = &pool->deques[worker];
+    if (d->bottom == d->size) {
+        if (d->top > 0) {
+            memmove(d->tasks, d->tasks + d->top, (d->bottom - d->top) * sizeof(void *));
+            d->bottom -= d->top;
+            d->top = 0;
+        } else {
+            tasks = realloc(d->tasks, (d->size ? 2 * d->size : 16) * sizeof(void *));
+            if (tasks == NULL) {
+                /* The task is run here instead of being queued. */
+                pthread_mutex_unlock(&pool->lock);
+                pool->func(pool, worker, task, pool->data);
+                return;
+            }
+            d->tasks = tasks;
+            d->size = d->size ? 2 * d->size : 16;
+        }
+    }
+    d->tasks[d->bottom++] = task;
+    pool->pending++;
+    pthread_cond_signal(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+/* take_task - pop the newest task of the worker's own deque, or else
+ * steal the oldest task of another worker.  Called with the lock held. */
+static void * take_task(task_pool *pool, int worker) {
+    struct task_deque *d;
+    void *task;
+    int i;
+    d = &pool->deques[worker];
+    if (d->bottom > d->top) {
+        task = d->tasks[--d->bottom];
+        if (d->bottom == d->top)
+            d->top = d->bottom = 0;
+        return task;
+    }
+    for (i = 1; i < pool->workers; i++) {
+        d = &pool->deques[(worker + i) % pool->workers];
+        if (d->bottom > d->top) {
+            task = d->tasks[d->top++];
+            if (d->bottom == d->top)
+                d->top = d->bottom = 0;
+            return task;
+        }
+    }
+    return NULL;
+}
+
+static void run_worker(task_pool *pool, int worker) {
+    void *task;
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        task = take_task(pool, worker);
+        if (task != NULL) {
+            pthread_mutex_unlock(&pool->lock);
+            pool->func(pool, worker, task, pool->data);
+            pthread_mutex_lock(&pool->lock);
+            if (--pool->pending == 0)
+                pthread_cond_broadcast(&pool->wake);
+        } else if (pool->pending == 0) {
+            break;
+        } else {
+            pthread_cond_wait(&pool->wake, &pool->lock);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
+
+static void * worker_thread(void *arg) {
+    struct task_worker *w = arg;
+    run_worker(w->pool, w->worker);
+    return NULL;
+}
+
+void task_pool_run(task_pool *pool) {
+    pthread_t *threads;
+    struct task_worker *args;
+    int started;
+    int i;
+    threads = malloc(pool->workers * sizeof(pthread_t));
+    args = malloc(pool->workers * sizeof(struct task_worker));
+    started = 0;
+    for (i = 1; i < pool->workers && threads != NULL && args != NULL; i++) {
+        args[i].pool = pool;
+        args[i].worker = i;
+        /* If a thread cannot be started, the others take up its share. */
+        if (pthread_create(&threads[started], NULL, worker_thread, &args[i]) == 0)
+            started++;
+    }
+    run_worker(pool, 0);
+    for (i = 0; i < started; i++)
+        pthread_join(threads[i], NULL);
+    free(args);
+    free(threads);
+}
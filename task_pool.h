@@ -0,0 +1,31 @@
+#ifndef TASK_POOL_H
+#define TASK_POOL_H
+
+/* task_pool.h - A work-stealing pool of threads.  Each worker keeps a
+ * deque of tasks: it pushes and pops its own tasks at the bottom, and
+ * a worker that runs out of tasks steals the oldest one from the top of
+ * another worker's deque.  A task may push further tasks, which go to
+ * the deque of the worker running it. */
+
+typedef struct task_pool task_pool;
+
+/* task_func - run one task on the given worker */
+typedef void (*task_func)(task_pool *pool, int worker, void *task, void *data);
+
+/* task_pool_new - create a pool of 'workers' workers that run tasks
+ * with func, passing it data; NULL if out of memory */
+task_pool * task_pool_new(int workers, task_func func, void *data);
+
+/* task_pool_push - add a task to the deque of the given worker.  If the
+ * deque cannot grow, the task is run at once by the caller instead. */
+void task_pool_push(task_pool *pool, int worker, void *task);
+
+/* task_pool_run - run tasks until none are left.  The calling thread
+ * is worker 0; the others are started here and joined before return.
+ * Workers that cannot be started leave their share to the others. */
+void task_pool_run(task_pool *pool);
+
+/* task_pool_free - free a pool that is not running */
+void task_pool_free(task_pool *pool);
+
+#endif
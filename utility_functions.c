@@ -3,8 +3,10 @@
 
 #include "utility_functions.h"
 #include "markdown_peg.h"
+#include "arena.h"
 
 #include <string.h>
+#include <ctype.h>
 #include <assert.h>
 
 
@@ -33,35 +35,6 @@ element *reverse(element *list) {
     return new;
 }
 
-/* concat_string_list - concatenates string contents of list of STR elements.
- * Frees STR elements as they are added to the concatenation. */
-GString *concat_string_list(element *list) {
-    GString *result;
-    element *next;
-    result = g_string_new("");
-    while (list != NULL) {
-        assert(list->key == STR);
-        assert(list->contents.str != NULL);
-        g_string_append(result, list->contents.str);
-        next = list->next;
-        free_element(list);
-        list = next;
-    }
-    return result;
-}
-
-/**********************************************************************
-
-  Global variables used in parsing
-
- ***********************************************************************/
-
-char *charbuf = "";     /* Buffer of characters to be parsed. */
-element *references = NULL;    /* List of link references found. */
-element *notes = NULL;         /* List of footnotes found. */
-element *parse_result;  /* Results of parse. */
-int syntax_extensions;  /* Syntax extensions selected. */
-
 /**********************************************************************
 
   Auxiliary functions for parsing actions.
@@ -71,63 +44,86 @@ int syntax_extensions;  /* Syntax extensions selected. */
  ***********************************************************************/
 
 /* mk_element - generic constructor for element */
-element * mk_element(int key) {
-    element *result = malloc(sizeof(element));
+element * mk_element(markdown_arena *arena, int key) {
+    element *result = arena_alloc(arena, sizeof(element));
     result->key = key;
     result->children = NULL;
     result->next = NULL;
     result->contents.str = NULL;
+    result->len = 0;
     return result;
 }
 
 /* mk_str - constructor for STR element */
-element * mk_str(char *string) {
-    element *result;
+element * mk_str(markdown_arena *arena, char *string) {
     assert(string != NULL);
-    result = mk_element(STR);
-    result->contents.str = strdup(string);
+    return mk_str_slice(arena, string, strlen(string));
+}
+
+/* mk_str_slice - constructor for STR element from a slice of the input */
+element * mk_str_slice(markdown_arena *arena, char *start, size_t len) {
+    element *result;
+    result = mk_element(arena, STR);
+    result->contents.str = start;
+    result->len = len;
     return result;
 }
 
 /* mk_str_from_list - makes STR element by concatenating a
  * reversed list of strings, adding optional extra newline */
-element * mk_str_from_list(element *list, bool extra_newline) {
+element * mk_str_from_list(markdown_arena *arena, element *list, bool extra_newline) {
     element *result;
-    GString *c = concat_string_list(reverse(list));
+    element *cur;
+    size_t len = 0;
+    bool adjacent = true;
+    char *str;
+    list = reverse(list);
+    for (cur = list; cur != NULL; cur = cur->next) {
+        assert(cur->key == STR);
+        assert(cur->contents.str != NULL);
+        if (cur->next != NULL && cur->contents.str + cur->len != cur->next->contents.str)
+            adjacent = false;
+        len += cur->len;
+    }
+    result = mk_element(arena, STR);
+    if (list != NULL && adjacent && !extra_newline) {
+        /* The pieces form one contiguous slice of the input. */
+        result->contents.str = list->contents.str;
+        result->len = len;
+        return result;
+    }
+    result->len = extra_newline ? len + 1 : len;
+    result->contents.str = str = arena_alloc(arena, result->len);
+    for (cur = list; cur != NULL; cur = cur->next) {
+        memcpy(str, cur->contents.str, cur->len);
+        str += cur->len;
+    }
     if (extra_newline)
-        g_string_append(c, "\n");
-    result = mk_element(STR);
-    result->contents.str = c->str;
-    g_string_free(c, false);
+        *str = '\n';
     return result;
 }
 
 /* mk_list - makes new list with key 'key' and children the reverse of 'lst'.
  * This is designed to be used with cons to build lists in a parser action.
  * The reversing is necessary because cons adds to the head of a list. */
-element * mk_list(int key, element *lst) {
+element * mk_list(markdown_arena *arena, int key, element *lst) {
     element *result;
-    result = mk_element(key);
+    result = mk_element(arena, key);
     result->children = reverse(lst);
     return result;
 }
 
 /* mk_link - constructor for LINK element */
-element * mk_link(element *label, char *url, char *title) {
+element * mk_link(markdown_arena *arena, element *label, char *url, char *title) {
     element *result;
-    result = mk_element(LINK);
-    result->contents.link = malloc(sizeof(link));
+    result = mk_element(arena, LINK);
+    result->contents.link = arena_alloc(arena, sizeof(link));
     result->contents.link->label = label;
-    result->contents.link->url = strdup(url);
-    result->contents.link->title = strdup(title);
+    result->contents.link->url = url;
+    result->contents.link->title = title;
     return result;
 }
 
-/* extension = returns true if extension is selected */
-bool extension(int ext) {
-    return (syntax_extensions & ext);
-}
-
 /* match_inlines - returns true if inline lists match (case-insensitive...) */
 bool match_inlines(element *l1, element *l2) {
     while (l1 != NULL && l2 != NULL) {
@@ -144,7 +140,8 @@ bool match_inlines(element *l1, element *l2) {
         case CODE:
         case STR:
         case HTML:
-            if (strcasecmp(l1->contents.str, l2->contents.str) == 0)
+            if (l1->len == l2->len &&
+                strncasecmp(l1->contents.str, l2->contents.str, l1->len) == 0)
                 break;
             else
                 return false;
@@ -171,19 +168,147 @@ bool match_inlines(element *l1, element *l2) {
     return (l1 == NULL && l2 == NULL);  /* return true if both lists exhausted */
 }
 
+/**********************************************************************
+
+  Label indexes.
+  References and notes are hashed on their labels once per pass, so
+  that each link or note reference is resolved in constant time.
+
+ ***********************************************************************/
+
+struct label_entry {
+    unsigned int        hash;
+    element            *elt;
+    struct label_entry *next;
+};
+
+struct label_index {
+    unsigned int        mask;       /* Number of buckets, less one. */
+    int                 count;      /* Entries. */
+    struct label_entry **buckets;
+};
+
+/* Elements and bytes of a label that are hashed.  A label is looked up
+ * at each level of the brackets nested in it, so hashing all of it would
+ * make deeply nested labels quadratic; match_inlines compares the rest. */
+#define LABEL_HASH_LIMIT 64
+
+/* hash_inlines - hash the first *budget elements and bytes of an inline
+ * list so that lists accepted by match_inlines hash equally */
+static unsigned int hash_inlines(element *list, unsigned int h, int *budget) {
+    size_t i;
+    while (list != NULL && *budget > 0) {
+        h = h * 31 + list->key;
+        (*budget)--;
+        switch (list->key) {
+        case CODE:
+        case STR:
+        case HTML:
+            for (i = 0; i < list->len && *budget > 0; i++, (*budget)--)
+                h = h * 31 + tolower((unsigned char) list->contents.str[i]);
+            break;
+        case EMPH:
+        case STRONG:
+        case LIST:
+        case SINGLEQUOTED:
+        case DOUBLEQUOTED:
+            h = hash_inlines(list->children, h, budget) * 31 + 1;
+            break;
+        default:
+            break;
+        }
+        list = list->next;
+    }
+    return h;
+}
+
+/* hash_label - hash a link label, as hash_inlines */
+static unsigned int hash_label(element *label) {
+    int budget = LABEL_HASH_LIMIT;
+    return hash_inlines(label, 0, &budget);
+}
+
+/* hash_bytes - hash a note label */
+static unsigned int hash_bytes(char *str, size_t len) {
+    unsigned int h = 0;
+    size_t i;
+    for (i = 0; i < len; i++)
+        h = h * 31 + (unsigned char) str[i];
+    return h;
+}
+
+/* new_index - make an empty index with room for 'count' labels */
+static label_index * new_index(markdown_arena *arena, int count) {
+    label_index *index = arena_alloc(arena, sizeof(label_index));
+    unsigned int size = 16;
+    while (size < 2 * count)
+        size *= 2;
+    index->mask = size - 1;
+    index->count = 0;
+    index->buckets = arena_alloc(arena, size * sizeof(struct label_entry *));
+    memset(index->buckets, 0, size * sizeof(struct label_entry *));
+    return index;
+}
+
+/* index_add - add an entry after those already in its bucket, so that
+ * lookups find the first of several elements with the same label */
+static void index_add(markdown_arena *arena, label_index *index, unsigned int hash, element *elt) {
+    struct label_entry **slot = &index->buckets[hash & index->mask];
+    struct label_entry *entry = arena_alloc(arena, sizeof(struct label_entry));
+    entry->hash = hash;
+    entry->elt = elt;
+    entry->next = NULL;
+    index->count++;
+    while (*slot != NULL)
+        slot = &(*slot)->next;
+    *slot = entry;
+}
+
+static int list_length(element *list) {
+    int count = 0;
+    for (; list != NULL; list = list->next)
+        count++;
+    return count;
+}
+
+/* index_references - index a list of REFERENCE elements on their labels */
+label_index * index_references(markdown_arena *arena, element *references) {
+    label_index *index = new_index(arena, list_length(references));
+    element *cur;
+    for (cur = references; cur != NULL; cur = cur->next)
+        index_add(arena, index, hash_label(cur->contents.link->label), cur);
+    return index;
+}
+
+/* index_notes - index a list of NOTE elements on their labels */
+label_index * index_notes(markdown_arena *arena, element *notes) {
+    label_index *index = new_index(arena, list_length(notes));
+    element *cur;
+    for (cur = notes; cur != NULL; cur = cur->next)
+        index_add(arena, index, hash_bytes(cur->contents.str, cur->len), cur);
+    return index;
+}
+
 /* find_reference - return true if link found in references matching label.
- * 'link' is modified with the matching url and title. */
-bool find_reference(link *result, element *label) {
-    element *cur = references;  /* pointer to walk up list of references */
+ * 'link' is modified with the matching url and title.  A NULL index,
+ * as before the references of a document are collected, is empty, and
+ * an empty index is answered without hashing the label. */
+bool find_reference(link *result, element *label, label_index *references) {
+    unsigned int hash;
+    struct label_entry *entry;
     link *curitem;
-    while (cur != NULL) {
-        curitem = cur->contents.link;
-        if (match_inlines(label, curitem->label)) {
+    if (references == NULL || references->count == 0)
+        return false;
+    hash = hash_label(label);
+    entry = references->buckets[hash & references->mask];
+    while (entry != NULL) {
+        curitem = entry->elt->contents.link;
+        if (entry->hash == hash && match_inlines(label, curitem->label)) {
             *result = *curitem;
             return true;
         }
         else
-            cur = cur->next;
+            entry = entry->next;
     }
     return false;
 }
@@ -191,16 +316,23 @@ bool find_reference(link *result, element *label) {
 /* find_note - return true if note found in notes matching label.
 if found, 'result' is set to point to matched note. */
 
-bool find_note(element **result, char *label) {
-   element *cur = notes;  /* pointer to walk up list of notes */
-   while (cur != NULL) {
-       if (strcmp(label, cur->contents.str) == 0) {
+bool find_note(element **result, element *label, label_index *notes) {
+   unsigned int hash;
+   struct label_entry *entry;
+   element *cur;
+   if (notes == NULL || notes->count == 0)
+       return false;
+   hash = hash_bytes(label->contents.str, label->len);
+   entry = notes->buckets[hash & notes->mask];
+   while (entry != NULL) {
+       cur = entry->elt;
+       if (entry->hash == hash && label->len == cur->len &&
+           memcmp(label->contents.str, cur->contents.str, label->len) == 0) {
            *result = cur;
            return true;
        }
        else
-           cur = cur->next;
+           entry = entry->next;
    }
    return false;
 }
-
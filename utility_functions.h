@@ -15,60 +15,61 @@ element * cons(element *new, element *list);
 
 /* reverse - reverse a list, returning pointer to new list */
 element *reverse(element *list);
-/* concat_string_list - concatenates string contents of list of STR elements.
- * Frees STR elements as they are added to the concatenation. */
-GString *concat_string_list(element *list);
-/**********************************************************************
-
-  Global variables used in parsing
-
- ***********************************************************************/
-
-extern char *charbuf;          /* Buffer of characters to be parsed. */
-extern element *references;    /* List of link references found. */
-extern element *notes;         /* List of footnotes found. */
-extern element *parse_result;  /* Results of parse. */
-extern int syntax_extensions;  /* Syntax extensions selected. */
-
 /**********************************************************************
 
   Auxiliary functions for parsing actions.
   These make it easier to build up data structures (including lists)
-  in the parsing actions.
+  in the parsing actions.  Elements, links and their strings are
+  allocated from the arena passed as the first argument.
 
  ***********************************************************************/
 
 /* mk_element - generic constructor for element */
-element * mk_element(int key);
+element * mk_element(markdown_arena *arena, int key);
 
-/* mk_str - constructor for STR element */
-element * mk_str(char *string);
+/* mk_str - constructor for STR element.  The string is not copied, so
+ * it must be a literal or live in the arena. */
+element * mk_str(markdown_arena *arena, char *string);
+
+/* mk_str_slice - constructor for STR element holding 'len' bytes of
+ * the input, such as yytext */
+element * mk_str_slice(markdown_arena *arena, char *start, size_t len);
 
 /* mk_str_from_list - makes STR element by concatenating a
- * reversed list of strings, adding optional extra newline */
-element * mk_str_from_list(element *list, bool extra_newline);
+ * reversed list of strings, adding optional extra newline.
+ * Strings that are adjacent in the input are not copied. */
+element * mk_str_from_list(markdown_arena *arena, element *list, bool extra_newline);
 
 /* mk_list - makes new list with key 'key' and children the reverse of 'lst'.
  * This is designed to be used with cons to build lists in a parser action.
  * The reversing is necessary because cons adds to the head of a list. */
-element * mk_list(int key, element *lst);
-
-/* mk_link - constructor for LINK element */
-element * mk_link(element *label, char *url, char *title);
-/* extension = returns true if extension is selected */
-bool extension(int ext);
+element * mk_list(markdown_arena *arena, int key, element *lst);
 
+/* mk_link - constructor for LINK element.  The url and title are
+ * null-terminated strings that are not copied. */
+element * mk_link(markdown_arena *arena, element *label, char *url, char *title);
 /* match_inlines - returns true if inline lists match (case-insensitive...) */
 bool match_inlines(element *l1, element *l2);
 
+/* label_index - hash table of references or notes keyed on their labels */
+typedef struct label_index label_index;
+
+/* index_references - index a list of REFERENCE elements on their labels */
+label_index * index_references(markdown_arena *arena, element *references);
+
+/* index_notes - index a list of NOTE elements on their labels */
+label_index * index_notes(markdown_arena *arena, element *notes);
+
 /* find_reference - return true if link found in references matching label.
- * 'link' is modified with the matching url and title. */
-bool find_reference(link *result, element *label);
+ * 'link' is modified with the matching url and title.  A NULL index,
+ * as before the references of a document are collected, is empty, and
+ * an empty index is answered without hashing the label. */
+bool find_reference(link *result, element *label, label_index *references);
 
 /* find_note - return true if note found in notes matching label.
 if found, 'result' is set to point to matched note. */
 
-bool find_note(element **result, char *label);
+bool find_note(element **result, element *label, label_index *notes);
 
 #endif
 